@@ -0,0 +1,36 @@
+#ifndef ATLAS_H
+#define ATLAS_H
+
+#include <GL/glut.h>
+
+// Tile di atlas tekstur dunia statis
+enum AtlasTile {
+    ATLAS_QUARTZ,               // Dinding, atap, tangga, gedung (quartz-block.bmp)
+    ATLAS_STONE,                // Batu (stone.bmp)
+    ATLAS_TILE_COUNT
+};
+
+// Satu tekstur berisi semua tile. Dinding, atap, tangga, pagar, scenery dan
+// chunk dunia digambar dengan tekstur ini ter-bind (lihat renderScene),
+// tanpa glBindTexture di antara objek.
+extern GLuint atlasTexture;
+
+// Decode file tile dan susun atlas di memori. Tanpa GL, jadi dijalankan
+// di worker thread loader; setelah itu uploadTextureAtlas() di thread GL.
+void composeTextureAtlas();
+void uploadTextureAtlas();
+
+// glTexCoord untuk posisi (s, t) di dalam satu ulangan tile, 0 <= s, t <= 1
+void atlasTexCoord(AtlasTile tile, float s, float t);
+
+// Koordinat tekstur konstan (pusat tile) untuk geometri tanpa texcoord
+// sendiri seperti glutSolidSphere/gluCylinder
+void atlasSolidTexCoord(AtlasTile tile);
+
+// Pengganti satu GL_QUADS bertekstur berulang: corners[0..3] berurutan
+// dengan texcoord asli (0,0), (repeatS,0), (repeatS,repeatT), (0,repeatT).
+// Atlas tidak bisa GL_REPEAT, jadi quad dipecah di setiap batas ulangan
+// dan tiap potongan dipetakan ke tile-nya. Normal di-set oleh pemanggil.
+void atlasQuad(AtlasTile tile, const GLfloat corners[4][3], float repeatS, float repeatT);
+
+#endif // ATLAS_H
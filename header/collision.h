@@ -1,8 +1,18 @@
 #ifndef COLLISION_H
 #define COLLISION_H
  
+#include <vector>
 #include "object.h"
   
+// Area pintu yang boleh dilewati (lihat isDoorwayArea)
+struct Doorway {
+    float x1, z1, x2, z2;
+    float baseY;
+};
+
+// Default rumah bawaan; diganti isi level saat loadLevel() berhasil
+extern std::vector<Doorway> doorways;
+
 struct CollisionResult {
     bool collided;    
     bool blockX;       
@@ -13,5 +23,13 @@ bool checkCollision(float newX, float newZ);
 bool checkAABBCollision(const BoundingBox& a, const BoundingBox& b);
 float getGroundLevel(float x, float z);
 CollisionResult checkWallCollision(float newX, float newZ, float oldX, float oldZ);
+
+// Versi thread-safe: tidak membaca player/keys global, hanya data level
+CollisionResult checkWallCollisionAt(float newX, float newZ, float oldX, float oldZ,
+                                     float entityY, bool debug);
+bool checkCollisionAt(float newX, float newZ, float entityY);
+// Hanya dinding, pagar dan data level lain; tanpa collider chunk dunia
+bool checkLevelCollisionAt(float newX, float newZ, float entityY);
+float getGroundLevelAt(float x, float z, float entityY);
 bool checkEnemySceneryCollision(float x, float z, float radius = 0.5f);
 #endif
\ No newline at end of file
@@ -33,8 +33,11 @@ void checkBulletHits();
 // Draw pistol
 void drawPistol(bool isRightHand);
 
-// Check if player is attacking an enemy
-bool checkPlayerAttack(const Player& player, Enemy& enemy);
+// Check if player is attacking the enemy at dense index in enemyPool
+bool checkPlayerAttack(const Player& player, size_t index);
+
+// Serangan jarak dekat ke semua musuh dalam ENEMY_ATTACK_RANGE (query spatial hash)
+void checkPlayerMeleeHits(const Player& player);
 
 extern const float BULLET_SPEED;
 extern const float BULLET_MAX_DISTANCE;
@@ -3,47 +3,93 @@
 
 #include <GL/glut.h>
 #include <vector>
+#include <cstddef>
 #include "object.h"
- 
-// Enemy structure 
-struct Enemy {
+#include "random.h"
+#include "navigation.h"
+#include "spatialhash.h"
+
+// Handle stabil untuk mereferensikan musuh dari luar pool.
+// Index dense bisa berubah saat musuh lain dihapus (swap-remove),
+// tetapi handle tetap valid sampai musuh tersebut dihapus.
+struct EnemyHandle {
+    unsigned int slot;        // Slot handle (tidak berubah selama musuh hidup)
+    unsigned int generation;  // Generasi slot saat handle dibuat
+};
+
+// Data dingin musuh - jarang diakses di loop per-frame
+struct EnemyColdData {
     char name[50];           // Enemy name
-    float health;            // Current health
     float maxHealth;         // Maximum health
-    Position position;       // Position in 3D space
-    float rotationY;         // Rotation around Y axis
-    float scale;             // Size scale
-    bool isAlive;            // Is the enemy alive
-    
-    // AI parameters
-    float moveSpeed;            // Kecepatan gerakan
-    float moveDirection;        // Arah gerakan dalam derajat (0-359)
-    float moveDuration;         // Durasi bergerak ke arah tertentu
-    float moveTimer;            // Timer untuk pergantian arah
-    bool isMoving;              // Apakah sedang bergerak
-    float idleDuration;         // Durasi diam
-    float idleTimer;            // Timer untuk waktu diam
-
-    
-    // Animation parameters (similar to player)
-    float leftArmRotation;
-    float rightArmRotation;
-    float leftLegRotation;
-    float rightLegRotation;
+};
+
+// Penyimpanan musuh dalam bentuk SoA (structure of arrays).
+// Semua entri di [0, size()) adalah musuh yang hidup; musuh yang mati
+// langsung dihapus dengan swap-remove sehingga loop AI, render dan
+// hit test berjalan di memori yang padat tanpa entri mati.
+struct EnemyPool {
+    // Hot data - dibaca/ditulis setiap frame
+    std::vector<Position> position;      // Position in 3D space
+    std::vector<float> rotationY;        // Rotation around Y axis
+    std::vector<float> scale;            // Size scale
+    std::vector<float> health;           // Current health
+    std::vector<float> moveSpeed;        // Kecepatan gerakan
+    std::vector<float> moveDirection;    // Arah gerakan dalam derajat (0-359)
+    std::vector<float> moveDuration;     // Durasi bergerak ke arah tertentu
+    std::vector<float> moveTimer;        // Timer untuk pergantian arah
+    std::vector<float> idleDuration;     // Durasi diam
+    std::vector<float> idleTimer;        // Timer untuk waktu diam
+    std::vector<unsigned char> isMoving; // Apakah sedang bergerak
+    std::vector<float> limbSwing;        // Ayunan lengan/kaki (lengan kiri & kaki kanan = +, sisanya = -)
+    std::vector<float> animTime;         // Waktu animasi jalan milik musuh ini
+    std::vector<RandomStream> rng;       // Stream RNG_ENEMY_AI milik musuh ini
+    std::vector<unsigned char> isChasing; // Sedang mengejar player lewat path navigasi
+    std::vector<NavPathRef> navPath;     // Path yang sedang diikuti (di cache navigasi)
+    std::vector<int> navWaypoint;        // Index sel berikutnya di path
+    std::vector<int> navGoalCell;        // Sel tujuan saat path direncanakan
+    std::vector<unsigned char> lodTier;  // Tier LOD simulasi (ENEMY_LOD_*)
+    std::vector<float> lodPending;       // Waktu yang belum disimulasikan (tier jarang)
+
+    // Cold data
+    std::vector<EnemyColdData> cold;
+
+    // Pemetaan handle <-> index dense
+    std::vector<unsigned int> slotOfIndex;   // index dense -> slot
+    std::vector<unsigned int> indexOfSlot;   // slot -> index dense
+    std::vector<unsigned int> generation;    // slot -> generasi saat ini
+    std::vector<unsigned int> freeSlots;     // slot yang bisa dipakai ulang
+
+    size_t size() const { return position.size(); }
+    bool empty() const { return position.empty(); }
+
+    // Tambah musuh baru di akhir array, kembalikan handle-nya
+    EnemyHandle add(const char* name, const Position& pos, float maxHealth);
+
+    // Hapus musuh di index dense (swap-remove, O(1))
+    void remove(size_t index);
+
+    // Hapus semua musuh (semua handle lama menjadi tidak valid)
+    void clear();
+
+    // Handle untuk musuh di index dense
+    EnemyHandle handleOf(size_t index) const;
+
+    // Ubah handle menjadi index dense; false jika musuh sudah dihapus
+    bool resolve(EnemyHandle handle, size_t& index) const;
 };
 
 
 // Initialize enemy system
 void initEnemySystem();
 
-// Create a new enemy
-Enemy createEnemy(const char* name, float x, float y, float z, float maxHealth);
+// Create a new enemy and add it to the pool
+EnemyHandle createEnemy(const char* name, float x, float y, float z, float maxHealth);
 
-// Draw an enemy
-void drawEnemy(const Enemy& enemy);
+// Draw the enemy at dense index
+void drawEnemy(size_t index);
 
 // Draw enemy health bar
-void drawEnemyHealthBar(const Enemy& enemy);
+void drawEnemyHealthBar(size_t index);
 
 // Display enemy information on screen
 void displayEnemyInfo();
@@ -51,6 +97,9 @@ void displayEnemyInfo();
 // Spawn a new enemy at random position
 void spawnEnemy();
 
+// Remove a killed enemy from the pool
+void killEnemy(size_t index);
+
 // Update all enemies
 void updateEnemies(float deltaTime);
 // New functions for wave-based enemy spawning
@@ -58,21 +107,35 @@ extern void spawnWaveEnemies(int count);
 extern int getAliveEnemyCount();
 extern void clearAllEnemies();
 
+// Buang kandidat titik spawn; dibangun ulang saat spawn berikutnya
+// (dipanggil setelah level di-reload)
+void invalidateEnemySpawnPoints();
+
 
 // Draw crosshair
 void drawCrosshair(int width, int height);
 
 
-// Deklarasi fungsi baru
-void updateEnemyAI(Enemy& enemy, float deltaTime);
+// Update AI satu musuh. Hanya menulis data musuh di index tersebut dan hanya
+// membaca data level serta grid/path navigasi, jadi aman dipanggil paralel
+// untuk index berbeda (path disiapkan lebih dulu oleh updateEnemies).
+void updateEnemyAI(size_t index, float deltaTime);
+
+// Spatial hash musuh (id = index dense) ditambah player (SPATIAL_ID_PLAYER).
+// Dibangun ulang dari posisi terbaru jika pool berubah sejak build terakhir.
+// Index di dalamnya hanya valid sampai pool berubah lagi.
+const SpatialHash& getEnemySpatialHash();
 
 // Global variables
-extern std::vector<Enemy> enemies;
+extern EnemyPool enemyPool;
 
 extern const int MAX_ENEMIES;
 extern const float ENEMY_SPAWN_AREA;
 extern const float ENEMY_MIN_DISTANCE;
 extern const float ENEMY_ATTACK_RANGE;
 extern const float ENEMY_DAMAGE;
+extern const float ENEMY_AGGRO_RANGE;
+extern const float ENEMY_STOP_DISTANCE;
+extern const float ENEMY_SEPARATION_RADIUS;
 
-#endif // ENEMY_H
\ No newline at end of file
+#endif // ENEMY_H
@@ -0,0 +1,12 @@
+#ifndef FRUSTUM_H
+#define FRUSTUM_H
+
+// Ambil 6 bidang frustum dari matriks PROJECTION x MODELVIEW yang aktif.
+// Dipanggil sekali per frame setelah kamera di-set (awal renderScene).
+void updateFrustum();
+
+// true jika kotak AABB (koordinat dunia) mungkin terlihat. Konservatif:
+// kotak yang hanya menyentuh sudut frustum tetap dianggap terlihat.
+bool frustumBoxVisible(float minX, float minY, float minZ, float maxX, float maxY, float maxZ);
+
+#endif // FRUSTUM_H
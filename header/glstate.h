@@ -0,0 +1,77 @@
+#ifndef GLSTATE_H
+#define GLSTATE_H
+
+#include <GL/glut.h>
+
+// Statistik cache state GL sejak resetGLStateStats() (sekali per frame)
+struct GLStateStats {
+    unsigned issued;            // Panggilan yang diteruskan ke driver
+    unsigned skipped;           // Panggilan yang dilewati karena state sudah sama
+};
+extern GLStateStats glStateStats;
+
+// Pengganti glEnable/glDisable. Capability yang dilacak (lighting, tekstur,
+// blend, depth test, cull face, polygon offset, clip plane 0, ...) hanya
+// diteruskan jika berubah; capability lain selalu diteruskan.
+void glsEnable(GLenum cap);
+void glsDisable(GLenum cap);
+
+void glsBlendFunc(GLenum src, GLenum dst);
+void glsDepthMask(GLboolean flag);
+
+// Bind GL_TEXTURE_2D di unit tekstur 0
+void glsBindTexture(GLuint texture);
+
+// Warna saat ini (= material, karena GL_COLOR_MATERIAL aktif)
+void glsColor3f(GLfloat r, GLfloat g, GLfloat b);
+void glsColor4f(GLfloat r, GLfloat g, GLfloat b, GLfloat a);
+
+// Baca warna saat ini dari cache (sekali glGetFloatv jika belum diketahui)
+void glsGetColor(GLfloat color[4]);
+
+// Material specular (kekuatan, shininess). Warna ambient/diffuse tetap
+// dari glsColor*; default lihat DEFAULT_SPECULAR di lighting.h
+void glsMaterial(GLfloat specular, GLfloat shininess);
+
+// Selama display list di-compile panggilan gls* diteruskan apa adanya
+// tanpa mengubah cache (GL_COMPILE tidak mengeksekusi perintah).
+void glsNewList(GLuint list);
+void glsEndList();
+
+// glCallList lalu lupakan warna dan material saat ini (diubah isi list). Isi list wajib
+// mengembalikan capability dan bind tekstur seperti semula.
+void glsCallList(GLuint list);
+
+// Lupakan warna saat ini, misalnya setelah glDrawArrays dengan color array
+void glsInvalidateColor();
+
+void resetGLStateStats();
+
+// Blok state eksplisit pengganti glPushAttrib/glPopAttrib: simpan nilai
+// capability yang disebut (dan opsional blend, depth mask, warna) lalu
+// kembalikan lewat cache saat blok berakhir. Nilai yang belum diketahui
+// cache dibaca sekali dari GL.
+class GLStateBlock {
+public:
+    enum Extra {
+        BLEND_FUNC = 1,
+        DEPTH_MASK = 2,
+        COLOR = 4
+    };
+    GLStateBlock(const GLenum* caps, int capCount, unsigned extras = 0);
+    ~GLStateBlock();
+    GLStateBlock(const GLStateBlock&) = delete;
+    GLStateBlock& operator=(const GLStateBlock&) = delete;
+
+private:
+    static const int MAX_CAPS = 8;
+    GLenum savedCaps[MAX_CAPS];
+    bool savedValues[MAX_CAPS];
+    int savedCount;
+    unsigned savedExtras;
+    GLenum blendSrc, blendDst;
+    GLboolean depthMask;
+    GLfloat color[4];
+};
+
+#endif // GLSTATE_H
@@ -0,0 +1,26 @@
+#ifndef JOBS_H
+#define JOBS_H
+
+#include <cstddef>
+#include <functional>
+
+// Fungsi kerja untuk parallelFor: memproses index [begin, end)
+typedef std::function<void(size_t begin, size_t end)> JobRangeFunc;
+
+// Buat worker thread. threadCount = 0 berarti otomatis
+// (std::thread::hardware_concurrency), 1 berarti semua dijalankan serial.
+void initJobSystem(int threadCount);
+
+// Hentikan dan join semua worker thread
+void shutdownJobSystem();
+
+// Jumlah thread yang ikut bekerja (termasuk thread pemanggil)
+int getJobThreadCount();
+
+// Bagi [0, count) menjadi potongan berukuran grain lalu jalankan fn untuk
+// setiap potongan di worker thread. Thread pemanggil ikut bekerja dan fungsi
+// ini baru kembali setelah semua potongan selesai. fn harus hanya menulis ke
+// data milik index-nya sendiri agar hasilnya tidak bergantung pada urutan.
+void parallelFor(size_t count, size_t grain, const JobRangeFunc& fn);
+
+#endif // JOBS_H
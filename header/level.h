@@ -0,0 +1,59 @@
+#ifndef LEVEL_H
+#define LEVEL_H
+
+#include <vector>
+#include <cstdint>
+#include "scenery.h"
+
+// Format biner level (.lvl). Semua field 4 byte little-endian; data setiap
+// section dimulai di offset kelipatan LEVEL_SECTION_ALIGN sehingga record
+// bisa dibaca langsung dari file yang di-mmap.
+const char LEVEL_MAGIC[4] = {'T', 'B', 'L', 'V'};
+const uint32_t LEVEL_VERSION = 1;
+const uint32_t LEVEL_SECTION_ALIGN = 16;
+
+enum LevelSectionType {
+    LEVEL_SECTION_WALLS = 1,        // WallDefinition
+    LEVEL_SECTION_ROOFTOPS = 2,     // Rooftop
+    LEVEL_SECTION_STAIRCASES = 3,   // StaircaseDefinition
+    LEVEL_SECTION_FENCES = 4,       // FenceDefinition
+    LEVEL_SECTION_DOORWAYS = 5,     // Doorway
+    LEVEL_SECTION_SCENERY = 6       // LevelSceneryRecord
+};
+
+struct LevelFileHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t fileSize;          // Ukuran file yang diharapkan (deteksi file terpotong)
+    uint32_t sectionCount;      // Jumlah LevelSectionEntry setelah header
+};
+
+struct LevelSectionEntry {
+    uint32_t type;              // LevelSectionType
+    uint32_t offset;            // Dari awal file, kelipatan LEVEL_SECTION_ALIGN
+    uint32_t count;             // Jumlah record
+    uint32_t stride;            // Ukuran satu record (harus sama dengan sizeof)
+};
+
+// Penempatan scenery authored (bench, lamp post, fountain, ...)
+struct LevelSceneryRecord {
+    float x, y, z;
+    float rotationY;
+    float scale;
+    int32_t type;               // SceneryType
+    uint32_t castShadow;        // 0 / 1
+};
+
+// Muat level biner: walls, rooftops, staircases, fences, doorways dan
+// scenery authored diganti isi file. false (dengan pesan ke stderr) jika
+// file tidak ada, versinya berbeda atau rusak; data lama tidak diubah.
+bool loadLevel(const char* path);
+
+// Ubah level teks (lihat level.cpp untuk formatnya) menjadi file biner
+bool convertLevelText(const char* textPath, const char* binaryPath);
+
+// Scenery authored dari level terakhir yang dimuat; false jika belum ada
+// level yang dimuat (initScenery memakai penempatan bawaan)
+bool getLevelScenery(std::vector<SceneryObject>& out);
+
+#endif // LEVEL_H
@@ -0,0 +1,26 @@
+#ifndef LEVELWATCH_H
+#define LEVELWATCH_H
+
+// Statistik reload terakhir untuk debug/HUD
+struct LevelReloadStats {
+    unsigned int reloads;       // Jumlah reload yang berhasil
+    int changedRecords;         // Record yang ditambah/dihapus pada reload terakhir
+    int navRegions;             // Region grid navigasi yang dihitung ulang
+    float milliseconds;         // Waktu reload terakhir (load + rebuild)
+};
+extern LevelReloadStats levelReloadStats;
+
+// Mulai memantau file level (inotify di Linux, change notification di
+// Windows). Dipanggil setelah loadLevel() berhasil.
+void initLevelWatcher(const char* path);
+
+// Dipanggil sekali per frame dari thread utama, sebelum update musuh.
+// Jika file berubah, level dimuat ulang lewat reloadLevel().
+void pollLevelWatcher();
+
+// Muat ulang level dan perbarui hanya data turunan yang terpengaruh:
+// sel grid navigasi di sekitar record yang berubah, path/flow field yang
+// melewatinya, titik spawn musuh dan scenery authored.
+bool reloadLevel(const char* path);
+
+#endif // LEVELWATCH_H
@@ -1,7 +1,16 @@
 #ifndef LIGHTING_H
 #define LIGHTING_H
 #include <GL/glut.h>
+
+// Arah ke matahari (koordinat dunia); dipakai lighting shader dan shadow map
+const GLfloat SUN_DIRECTION[3] = {50.0f, 100.0f, -30.0f};
+
+// Material specular default (lihat glsMaterial)
+const GLfloat DEFAULT_SPECULAR = 1.0f;
+const GLfloat DEFAULT_SHININESS = 100.0f;
+
+// Lighting per-pixel lewat shader jika didukung (--glsl), selain itu
+// GL_LIGHT0 fixed-function
 void initLighting();
  
 #endif
-              
\ No newline at end of file
@@ -0,0 +1,33 @@
+#ifndef LIGHTS_H
+#define LIGHTS_H
+
+// Batas cahaya titik per frame dan per cluster (loop shader di shader.cpp)
+const int MAX_POINT_LIGHTS = 1024;
+const int MAX_CLUSTER_LIGHTS = 32;
+
+// Statistik grid cluster frame terakhir untuk HUD
+struct LightStats {
+    int lights;                 // Cahaya titik dalam jangkauan kamera
+    int clusters;               // Cluster yang berisi minimal satu cahaya
+    int indices;                // Total entri index cahaya di semua cluster
+    float buildMs;              // Waktu binning CPU + upload
+};
+extern LightStats lightStats;
+
+// Buat tekstur data cluster. Butuh shader lighting (initShaders) dan
+// tekstur float; false = hanya cahaya matahari. Thread GL saja.
+bool initLights();
+
+// Cahaya sesaat (muzzle flash, impact) yang memudar ke nol dalam duration detik
+void spawnTransientLight(float x, float y, float z, float radius,
+                         float r, float g, float b, float duration);
+
+// Umur cahaya sesaat; dipanggil sekali per tick game
+void updateLights(float deltaTime);
+
+// Kumpulkan cahaya titik (lampu jalan, peluru, cahaya sesaat), bin ke
+// grid froxel view space lalu upload ke shader. Dipanggil di renderScene()
+// setelah updateFrustum(), saat MODELVIEW = matriks kamera.
+void buildLightClusters();
+
+#endif // LIGHTS_H
@@ -0,0 +1,19 @@
+#ifndef LOADER_H
+#define LOADER_H
+
+// Mulai memuat aset dan dunia di worker thread (dipanggil dari init()).
+// Menu langsung tampil; tombol Start aktif setelah assetsReady().
+void startAssetLoading();
+
+// Dipanggil setiap frame dari thread GL: upload hasil worker (tekstur,
+// mesh chunk) dari completion queue dalam batas waktu per frame, lalu
+// menyelesaikan inisialisasi saat semua pekerjaan selesai.
+void updateAssetLoading();
+
+// true setelah semua aset dimuat dan sistem game diinisialisasi
+bool assetsReady();
+
+// Progres 0..1 untuk progress bar di menu
+float getAssetLoadProgress();
+
+#endif // LOADER_H
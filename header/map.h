@@ -45,9 +45,16 @@ extern std::vector<Rooftop> rooftops;
 // Initialize the map layout
 void initMap();
 
-// Draw the entire map
+// Draw the entire map (di-bake ke display list saat pertama dipanggil)
 void drawMap();
 
+// Buang mesh peta agar di-bake ulang dari data level saat drawMap berikutnya
+void invalidateMapMesh();
+
+// Bake mesh peta sekarang jika belum ada (dipakai loader agar frame pertama
+// gameplay tidak menanggung bake)
+void bakeMapMesh();
+
 void drawBorderMap();
 
 // Make walls accessible from other files
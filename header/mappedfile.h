@@ -0,0 +1,20 @@
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+#include <cstddef>
+
+// File read-only yang dipetakan ke memori (mmap / MapViewOfFile).
+// Handle disimpan sebagai void* agar header tidak perlu windows.h.
+struct MappedFile {
+    const unsigned char* data;  // nullptr = tidak terpetakan
+    size_t size;
+    void* fileHandle;           // Windows: HANDLE file dan mapping
+    void* mappingHandle;
+    int fd;                     // POSIX: file descriptor
+};
+
+// false jika file tidak ada, kosong atau gagal dipetakan
+bool mapFile(const char* path, MappedFile& file);
+void unmapFile(MappedFile& file);
+
+#endif // MAPPEDFILE_H
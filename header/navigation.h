@@ -0,0 +1,104 @@
+#ifndef NAVIGATION_H
+#define NAVIGATION_H
+
+#include <vector>
+#include <cstddef>
+
+// Grid navigasi 2D untuk musuh di lantai dasar.
+// Sel yang diblokir: dinding/pagar (diperbesar sebesar radius agen) dan
+// area tangga. Area pintu selalu bisa dilewati.
+struct NavGrid {
+    float originX, originZ;     // Sudut minimum grid di world space
+    float cellSize;             // Ukuran satu sel (world units)
+    int width, height;          // Jumlah sel pada sumbu X dan Z
+    std::vector<unsigned char> blocked;   // 1 = tidak bisa dilewati
+};
+
+// Path hasil A* yang disimpan di cache dan bisa dipakai banyak musuh
+struct NavPath {
+    unsigned int id;            // Id unik; 0 = slot kosong
+    int startRegion;            // Region (kumpulan sel) tempat path dimulai
+    int goalCell;               // Sel tujuan
+    unsigned int lastUsed;      // Tick terakhir path ini dipakai (untuk LRU)
+    std::vector<int> cells;     // Sel dari start sampai goal
+};
+
+// Referensi musuh ke path di cache
+struct NavPathRef {
+    int slot;                   // Slot di cache, -1 = tidak ada path
+    unsigned int id;            // Harus sama dengan NavPath::id agar valid
+};
+
+// Bangun grid dari walls, fences, staircases dan doorways.
+// Dipanggil setelah initMap() dan drawBorderMap().
+void initNavigation();
+
+// Sama dengan initNavigation() tetapi sel blocked disalin dari cache dunia.
+// false jika jumlah sel tidak cocok dengan grid (panggil initNavigation()).
+bool initNavigationFromCache(const unsigned char* blocked, size_t count);
+
+// Hitung ulang sel di kotak world [minX,maxX] x [minZ,maxZ] (diperbesar ke
+// batas region) setelah data level berubah. Path di cache yang melewati
+// area itu dibuang dan flow field dibangun ulang. Mengembalikan jumlah
+// region yang dihitung ulang. Thread utama saja.
+int navRebuildArea(float minX, float minZ, float maxX, float maxZ);
+
+// Konversi koordinat
+int navCellAt(float x, float z);                 // -1 jika di luar grid
+void navCellCenter(int cell, float& x, float& z);
+bool navIsWalkable(int cell);
+bool navIsWalkableAt(float x, float z);
+
+// Sel walkable terdekat (pencarian cincin sampai maxRadius sel); -1 jika tidak ada
+int navNearestWalkable(int cell, int maxRadius);
+
+// true jika garis lurus antara dua titik hanya melewati sel walkable
+bool navLineOfSight(float x0, float z0, float x1, float z1);
+
+// Minta path dari (x, z) ke goalCell. Path diambil dari cache jika ada path
+// ke sel tujuan yang sama yang dimulai di region yang sama dan bisa dicapai
+// dengan garis lurus; jika tidak, A* dijalankan dan hasilnya disimpan.
+// waypoint diisi index sel pertama yang harus dituju.
+// TIDAK thread-safe: panggil dari thread utama (fase plan).
+bool navRequestPath(float x, float z, int goalCell, NavPathRef& ref, int& waypoint);
+
+// Ambil path dari cache; nullptr jika ref sudah tidak valid (di-evict).
+// Read-only, aman dipanggil dari worker thread.
+const NavPath* navGetPath(const NavPathRef& ref);
+
+// Tandai path masih dipakai (LRU); false jika sudah di-evict. Thread utama saja.
+bool navRetainPath(const NavPathRef& ref);
+
+// Naikkan tick LRU cache (dipanggil sekali per update)
+void navBeginTick();
+
+// ---- Flow field (Dijkstra dari sel player) ----
+// Untuk gelombang besar: satu field dipakai semua musuh, jadi biaya
+// pathfinding tidak bergantung pada jumlah musuh. Field dibangun di buffer
+// belakang dengan batas ekspansi per tick lalu ditukar saat selesai.
+// Jika tujuan berganti saat membangun, build selesai dulu lalu build baru
+// dimulai untuk tujuan terakhir.
+
+// Lanjutkan build field ke goalCell dengan maksimal budget ekspansi sel.
+// Thread utama saja (fase plan).
+void navFlowUpdate(int goalCell, int budget);
+
+// Sel berikutnya menuju tujuan dari cell (field depan). Mengembalikan cell
+// itu sendiri jika cell adalah tujuan, -1 jika field tidak mencapai cell.
+// O(1) dan read-only, aman dari worker thread.
+int navFlowNext(int cell);
+
+// Sel tujuan dari field depan (-1 jika belum ada field)
+int navFlowGoal();
+
+// Statistik untuk debug/HUD
+struct NavStats {
+    unsigned int searches;      // Jumlah A* yang dijalankan
+    unsigned int cacheHits;     // Permintaan yang dilayani dari cache
+    unsigned int failures;      // Permintaan tanpa path
+    unsigned int flowBuilds;    // Flow field yang selesai dibangun
+};
+extern NavStats navStats;
+extern NavGrid navGrid;
+
+#endif // NAVIGATION_H
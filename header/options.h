@@ -0,0 +1,30 @@
+#ifndef OPTIONS_H
+#define OPTIONS_H
+
+// Opsi yang bisa diatur dari command line
+struct GameOptions {
+    int aiThreads;              // --ai-threads N : 0 = otomatis, 1 = serial
+    unsigned long long seed;    // --seed N : master seed untuk semua stream RNG
+    bool seedSet;               // false = seed diambil dari waktu startup
+    float lodNearDistance;      // --lod-bands NEAR,FAR : di bawah NEAR musuh selalu update penuh
+    float lodFarDistance;       // di atas FAR musuh update paling jarang (lihat enemy.cpp)
+    float sceneryDensity;       // --scenery-density F : pengali jumlah pohon/semak/batu
+    float chunkRadius;          // --chunk-radius R : jarak muat chunk dunia dari player
+    int chunkBudgetMB;          // --chunk-budget-mb N : batas memori chunk dunia
+    int anisotropy;             // --anisotropy N : filter anisotropik tekstur (1 = mati)
+    const char* levelPath;      // --level PATH : file level biner (.lvl)
+    const char* convertInput;   // --convert-level IN OUT : konversi level teks lalu keluar
+    const char* convertOutput;
+    const char* worldCachePath; // --world-cache PATH / --no-world-cache : cache dunia hasil generate
+    bool startupReport;         // --startup-report : cetak waktu task startup dan critical path
+    int shadowQuality;          // --shadow-quality N : 0 = blob shadow, 1..3 = shadow map 1024..4096
+    int glslVersion;            // --glsl N : 330, 120 atau 0 (fixed-function); -1 = otomatis
+};
+
+// Baca argumen command line (setelah glutInit membuang argumen GLUT).
+// Argumen yang tidak dikenal dilaporkan ke stderr lalu diabaikan.
+void parseOptions(int argc, char** argv);
+
+extern GameOptions gameOptions;
+
+#endif // OPTIONS_H
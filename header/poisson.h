@@ -0,0 +1,24 @@
+#ifndef POISSON_H
+#define POISSON_H
+
+#include <vector>
+#include <functional>
+#include "random.h"
+
+// Titik hasil sampling di bidang XZ
+struct PoissonPoint {
+    float x, z;
+};
+
+// Filter titik: false = titik ditolak (di dalam dinding, area terlarang, dll)
+typedef std::function<bool(float x, float z)> PoissonAcceptFunc;
+
+// Poisson-disk sampling (Bridson, 2007) di persegi [minX,maxX] x [minZ,maxZ]:
+// setiap pasangan titik berjarak minimal radius. Titik awal disebar di
+// beberapa sel kasar sehingga area yang terpisah oleh dinding tetap terisi.
+// Hasil ditambahkan ke out dan hanya bergantung pada isi rng.
+void poissonDiskSample(float minX, float minZ, float maxX, float maxZ, float radius,
+                       RandomStream& rng, const PoissonAcceptFunc& accept,
+                       std::vector<PoissonPoint>& out, int attemptsPerPoint = 30);
+
+#endif // POISSON_H
@@ -0,0 +1,40 @@
+#ifndef RANDOM_H
+#define RANDOM_H
+
+#include <cstdint>
+
+// Stream bernama. Setiap stream menghasilkan deret angka sendiri sehingga
+// menambah/mengurangi pemakaian di satu sistem tidak menggeser sistem lain.
+enum RandomStreamId {
+    RNG_SCENERY = 1,    // Penempatan scenery saat init
+    RNG_SPAWN,          // Posisi & atribut musuh saat spawn (sub = nomor musuh)
+    RNG_ENEMY_AI,       // Keputusan AI per musuh (sub = nomor musuh)
+    RNG_COSMETIC,       // Detail visual (bunga, dll), tidak mempengaruhi gameplay
+    RNG_SPAWN_POINTS    // Kandidat titik spawn musuh (dibangun sekali)
+};
+
+// RNG counter-based (Philox4x32-10). Key = master seed, counter =
+// {nomor blok (64-bit), sub-stream, id stream}. Tidak ada state global,
+// jadi aman dipakai dari banyak thread selama tiap thread punya stream sendiri.
+struct RandomStream {
+    uint32_t counter[4];    // {blok lo, blok hi, sub, stream id}
+    uint32_t block[4];      // Output blok terakhir
+    int used;               // Jumlah word di block yang sudah dipakai
+
+    uint32_t nextU32();
+    float nextFloat();                  // [0, 1)
+    float range(float lo, float hi);    // [lo, hi)
+    int nextInt(int n);                 // [0, n)
+};
+
+// Set master seed (dipanggil sekali saat startup, sebelum stream dibuat)
+void initRandom(uint64_t masterSeed);
+uint64_t getMasterSeed();
+
+// Buat stream baru yang dimulai dari blok 0
+RandomStream makeRandomStream(RandomStreamId id, uint32_t sub = 0);
+
+// Akses langsung tanpa state: word ke-index dari stream (id, sub)
+uint32_t randomU32At(RandomStreamId id, uint32_t sub, uint64_t index);
+
+#endif // RANDOM_H
@@ -2,7 +2,8 @@
 #define RENDER_H
 #include <GL/glut.h>
  
-void Grid();
+// Kirim tile tanah yang terlihat ke render queue
+void submitGround();
 void renderScene();
 void drawWall(GLfloat x1, GLfloat y1, GLfloat x2, GLfloat y2, GLfloat z, GLfloat thickness);
 void KotakKayu();
@@ -12,24 +13,21 @@ void makeCheckImage(void);
 void makeWallImage(void);
 void makeRoofImage(void);
 void loadTexture(void);  
-void drawText(const char* text, int x, int y, void* font = GLUT_BITMAP_HELVETICA_18); // Default value here
 float calculateFPS();
 void updatePlayerAnimation(Player& player, float deltaTime, bool isMoving);
 void updatePunchAnimation(Player& player, float deltaTime);
-// Tambahkan deklarasi fungsi baru untuk bayangan
-void calculateShadowMatrix(GLfloat shadowMat[16], GLfloat groundplane[4], GLfloat lightpos[4]);
-void drawPlayerShadow(const Player& player);
-// Tambahkan ini di bagian deklarasi fungsi
-void drawPlayerShadowSilhouette(const Player& player);
-extern GLuint woodTexture;
 extern GLuint grassTexture; // Grass texture
 // textures
 extern GLuint texture[3]; 
-GLuint loadBMP(const char* filename);
+
+// Statistik tile tanah frame terakhir (lihat submitGround)
+struct GroundStats {
+    int tilesInRange;           // Tile dalam radius tanah
+    int tilesDrawn;             // Tile yang lolos frustum culling
+};
+extern GroundStats groundStats;
 
 void drawSkybox();
 void drawDistantScenery();
-void drawTreeShadow(float x, float z, float scale);
-void drawPineTreeShadow(float x, float z, float scale);
 
 #endif       
@@ -0,0 +1,50 @@
+#ifndef RENDERQUEUE_H
+#define RENDERQUEUE_H
+
+#include <cstdint>
+#include <GL/glut.h>
+
+// Urutan pass (2 bit teratas sort key)
+enum RenderPass {
+    RENDER_PASS_BACKGROUND = 0,     // Langit dan gunung, tanpa bayangan
+    RENDER_PASS_OPAQUE = 1,         // Depan ke belakang (early-Z)
+    RENDER_PASS_TRANSLUCENT = 2     // Belakang ke depan, blending aktif
+};
+
+// State GL yang diatur queue sebelum item digambar. Fungsi gambar boleh
+// mengubahnya di tengah jalan tapi harus mengembalikannya di akhir.
+enum RenderState {
+    RENDER_LIGHTING = 1,            // GL_LIGHTING
+    RENDER_TEXTURE = 2,             // GL_TEXTURE_2D di unit 0
+    RENDER_BLEND = 4,               // GL_BLEND, SRC_ALPHA / ONE_MINUS_SRC_ALPHA
+    RENDER_SHADOWED = 8             // Menerima shadow map (beginShadowReceivers)
+};
+
+// Gambar satu item; index = data yang diberikan saat submit
+typedef void (*RenderDrawFn)(int index);
+
+// Statistik queue frame terakhir untuk HUD
+struct RenderQueueStats {
+    int items;                  // Item yang digambar
+    int stateChanges;           // glEnable/glDisable yang benar-benar dipanggil
+    int textureBinds;           // glBindTexture yang benar-benar dipanggil
+    int skippedChanges;         // Item tanpa perubahan state/bind dari item sebelumnya
+    float sortMs;               // Waktu radix sort
+};
+extern RenderQueueStats renderQueueStats;
+
+// Sort key 64 bit: pass | state | tekstur (0 = tidak peduli) | kedalaman.
+// distanceSq = kuadrat jarak ke kamera (lihat renderDistanceSq).
+uint64_t makeRenderKey(RenderPass pass, unsigned state, GLuint texture, float distanceSq);
+
+// Kuadrat jarak titik dunia ke posisi kamera frame ini
+float renderDistanceSq(float x, float y, float z);
+
+// Tambah item untuk frame ini
+void submitRenderItem(uint64_t key, RenderDrawFn draw, int index);
+
+// Urutkan (radix sort), gambar dengan perubahan state minimal lalu kosongkan
+// queue. State dikembalikan ke lighting aktif, tekstur mati, blend mati.
+void executeRenderQueue();
+
+#endif // RENDERQUEUE_H
@@ -39,12 +39,20 @@ struct Building {
     int numFloors;
     Color baseColor;
     Color roofColor;
-    GLuint texture;
 };
 
 // Define functions
 void initScenery();
-void drawScenery();
+// Kirim scenery authored dan gedung ke render queue
+void submitScenery();
+void drawSceneryObject(const SceneryObject& obj);
+
+// Pohon, semak dan batu untuk satu chunk dunia (chunkX, chunkZ). Hasil hanya
+// bergantung pada seed dan koordinat chunk; aman dipanggil dari worker thread.
+void generateSceneryChunk(int chunkX, int chunkZ, float chunkSize, std::vector<SceneryObject>& out);
+
+// Collider lingkaran (radius, tinggi) untuk objek chunk; false = tidak menghalangi
+bool getSceneryCollider(const SceneryObject& obj, float& radius, float& height);
 void drawTree(float x, float y, float z, float scale);
 void drawPineTree(float x, float y, float z, float scale);
 void drawBush(float x, float y, float z, float scale);
@@ -0,0 +1,59 @@
+#ifndef SHADER_H
+#define SHADER_H
+
+#include <GL/glut.h>
+
+// Jalur lighting yang aktif, untuk HUD
+struct ShaderStats {
+    int glslVersion;            // 330, 120 atau 0 (fixed-function)
+    bool uniformBuffers;        // Kamera dan cahaya lewat uniform buffer
+};
+extern ShaderStats shaderStats;
+
+// Alamat fungsi GL di luar OpenGL 1.1 (wglGetProcAddress / glXGetProcAddressARB)
+void* getGLProcAddress(const char* name);
+
+// Compile program lighting per-pixel sesuai --glsl. false = driver tidak
+// mendukung atau compile gagal; lighting tetap fixed-function.
+bool initShaders();
+
+// true jika program lighting aktif dipakai untuk scene
+bool shadersEnabled();
+
+// Cahaya matahari: arah (ke matahari, koordinat dunia), ambient total,
+// diffuse dan specular. Dipanggil sekali dari initLighting().
+void setShaderLight(const GLfloat direction[3], const GLfloat ambient[4],
+                    const GLfloat diffuse[4], const GLfloat specular[4]);
+
+// Bind program untuk seluruh renderScene() (termasuk pass kedalaman).
+// begin dipanggil saat MODELVIEW = matriks kamera.
+void beginShaderFrame();
+void endShaderFrame();
+
+// Matriks posisi mata kamera -> koordinat shadow map, ukuran texel dan PCF
+void setShaderShadowMap(const GLfloat eyeToShadow[16], float texelSize, bool pcf);
+
+// Sampling shadow map (unit tekstur 1) untuk geometri penerima
+void setShaderShadowing(bool enable);
+
+// Grid cluster cahaya titik dari lights.cpp. Tekstur di unit 2 (data
+// cahaya), 3 (offset dan jumlah per cluster) dan 4 (index cahaya).
+struct ShaderClusterGrid {
+    int tilesX, tilesY, slices;         // Ukuran grid froxel
+    float viewportX, viewportY;         // Pojok kiri bawah viewport (piksel)
+    float tileWidth, tileHeight;        // Ukuran tile layar (piksel)
+    float sliceNear, sliceFar;          // Ujung slice 0 dan slice terakhir (jarak view space)
+    int lightTextureWidth;
+    int clusterTextureWidth, clusterTextureHeight;
+    int indexTextureWidth, indexTextureHeight;
+};
+// nullptr = tanpa cahaya titik frame ini
+void setShaderClusters(const ShaderClusterGrid* grid);
+
+// Dipanggil glstate.cpp: perubahan GL_LIGHTING / GL_TEXTURE_2D dan material
+// diteruskan sebagai uniform. Saat compile display list uniform ikut
+// direkam ke list.
+void shaderCapabilityChanged(GLenum cap, bool enable, bool compiling);
+void shaderMaterialChanged(GLfloat specular, GLfloat shininess, bool compiling);
+
+#endif // SHADER_H
@@ -0,0 +1,34 @@
+#ifndef SHADOW_H
+#define SHADOW_H
+
+// Statistik shadow map frame terakhir untuk HUD
+struct ShadowStats {
+    int mapSize;                // Resolusi shadow map (0 = shadow map mati)
+    int casters;                // Objek/batch yang digambar di pass kedalaman
+    bool framebuffer;           // true = FBO, false = salin dari back buffer
+    int blobs;                  // Blob shadow yang digambar (mode tanpa shadow map)
+};
+extern ShadowStats shadowStats;
+
+// Cek extension dan buat tekstur kedalaman sesuai --shadow-quality.
+// Thread GL saja, setelah window dibuat.
+void initShadows();
+
+// true jika shadow map aktif; false = pakai blob shadow
+bool shadowsEnabled();
+
+// Pass kedalaman dari arah matahari untuk semua caster. Dipanggil di awal
+// renderScene() sebelum layar di-clear, dengan matriks kamera aktif.
+void renderShadowPass();
+
+// Aktifkan/matikan sampling shadow map di unit tekstur 1 dan 2 untuk
+// geometri penerima. begin dipanggil saat MODELVIEW = matriks kamera.
+void beginShadowReceivers();
+void endShadowReceivers();
+
+// Blob shadow untuk semua caster dekat player dalam satu draw call
+// (mode low-end). Item translucent render queue: blending sudah aktif,
+// lighting dan tekstur mati.
+void drawBlobShadows();
+
+#endif // SHADOW_H
@@ -0,0 +1,57 @@
+#ifndef SPATIALHASH_H
+#define SPATIALHASH_H
+
+#include <vector>
+#include <cmath>
+
+// Id khusus untuk player di spatial hash (musuh memakai index dense >= 0)
+const int SPATIAL_ID_PLAYER = -1;
+
+// Spatial hash 2D (XZ) untuk entitas yang bergerak. Setiap entri menyimpan
+// salinan posisi, jadi query membaca snapshot yang tidak berubah selama
+// update paralel berjalan. Bucket berupa linked list (head/next) di dalam
+// array sehingga rebuild per tick tidak mengalokasi memori.
+struct SpatialHash {
+    float cellSize;
+    unsigned int mask;              // tableSize - 1 (tableSize pangkat 2)
+    std::vector<int> head;          // bucket -> entri pertama (-1 = kosong)
+    std::vector<int> next;          // entri -> entri berikutnya di bucket
+    std::vector<int> id;
+    std::vector<int> cellX, cellZ;  // Sel entri (membedakan sel yang berbagi bucket)
+    std::vector<float> x, z;
+
+    SpatialHash() : cellSize(1.0f), mask(0) {}
+
+    // Kosongkan dan siapkan tabel untuk kira-kira expectedCount entri
+    void reset(float newCellSize, size_t expectedCount);
+    void insert(int entryId, float px, float pz);
+    size_t size() const { return id.size(); }
+
+    int cellOf(float v) const { return (int)std::floor(v / cellSize); }
+    unsigned int bucketOf(int cx, int cz) const {
+        return ((unsigned int)cx * 73856093u ^ (unsigned int)cz * 19349663u) & mask;
+    }
+
+    // Panggil fn(id, px, pz, distSq) untuk setiap entri dalam radius
+    template <typename Fn>
+    void forEachNear(float px, float pz, float radius, Fn fn) const {
+        if (head.empty()) return;
+        float radiusSq = radius * radius;
+        int cx0 = cellOf(px - radius), cx1 = cellOf(px + radius);
+        int cz0 = cellOf(pz - radius), cz1 = cellOf(pz + radius);
+        for (int cz = cz0; cz <= cz1; cz++) {
+            for (int cx = cx0; cx <= cx1; cx++) {
+                for (int e = head[bucketOf(cx, cz)]; e >= 0; e = next[e]) {
+                    if (cellX[e] != cx || cellZ[e] != cz) continue;
+                    float dx = x[e] - px, dz = z[e] - pz;
+                    float distSq = dx * dx + dz * dz;
+                    if (distSq <= radiusSq) {
+                        fn(id[e], x[e], z[e], distSq);
+                    }
+                }
+            }
+        }
+    }
+};
+
+#endif // SPATIALHASH_H
@@ -0,0 +1,30 @@
+#ifndef TEXT_H
+#define TEXT_H
+
+#include <GL/glut.h>
+
+// Statistik teks frame terakhir untuk HUD
+struct TextStats {
+    int glyphs;                 // Quad glyph yang digambar
+    int draws;                  // Draw call teks (0 atau 1 jika atlas aktif)
+    bool atlas;                 // false = glutBitmapCharacter per karakter
+};
+extern TextStats textStats;
+
+// Rasterisasi glyph font GLUT yang dipakai game ke satu tekstur atlas.
+// Thread GL saja, setelah window dibuat. Gagal = tetap glutBitmapCharacter.
+void initText();
+
+// Tambahkan teks ke batch frame ini dengan warna saat ini. (x, y) = titik
+// baseline dalam koordinat pixel window, seperti glRasterPos2i di bawah
+// gluOrtho2D(0, width, 0, height).
+void drawText(const char* text, int x, int y, void* font = GLUT_BITMAP_HELVETICA_18);
+
+// Lebar teks dalam pixel (sama dengan jumlah glutBitmapWidth), di-cache per string
+int textWidth(const char* text, void* font = GLUT_BITMAP_HELVETICA_18);
+
+// Gambar semua teks yang terkumpul dengan satu draw call, di atas isi
+// layar. Dipanggil sekali sebelum glutSwapBuffers().
+void flushText(int width, int height);
+
+#endif // TEXT_H
@@ -0,0 +1,45 @@
+#ifndef TEXTURE_H
+#define TEXTURE_H
+
+#include <cstddef>
+#include <vector>
+#include <GL/glut.h>
+
+// Gambar hasil decode, siap di-upload
+struct TextureImage {
+    int width, height;
+    int channels;               // 3 atau 4
+    GLenum format;              // GL_RGB, GL_RGBA, GL_BGR atau GL_BGRA
+    std::vector<unsigned char> pixels;  // Rapat (tanpa padding), baris atas dulu
+};
+
+// Statistik texture manager untuk HUD
+struct TextureStats {
+    int loaded;                 // Tekstur unik yang berhasil dimuat
+    int missing;                // Path yang gagal (memakai tekstur fallback)
+    int cacheHits;              // Permintaan yang dilayani dari cache
+    size_t bytes;               // Perkiraan memori GPU (semua level mipmap)
+    float loadMs;               // Total waktu decode + upload
+};
+extern TextureStats textureStats;
+
+// Muat tekstur BMP (24/32 bit) atau PNG (8 bit per channel) dengan mipmap.
+// Path yang sama hanya dimuat sekali; file yang tidak ada atau tidak
+// didukung mendapat tekstur fallback (kotak-kotak magenta), bukan 0.
+GLuint loadTextureFile(const char* path);
+
+// Decode file BMP/PNG ke memori tanpa membuat tekstur GL. Tidak menyentuh
+// GL maupun cache, jadi aman dari worker thread.
+bool loadTextureImage(const char* path, TextureImage& image);
+
+// Bagian GL dari loadTextureFile: upload hasil loadTextureImage (atau
+// fallback jika decoded = false) dan simpan di cache path. Thread GL saja.
+GLuint uploadTextureFile(const char* path, const TextureImage& image, bool decoded, float decodeMs);
+
+// Upload gambar sebagai tekstur baru dengan mipmap 0..maxLevel (-1 = penuh)
+GLuint createTexture(const TextureImage& image, int maxLevel);
+
+// Kotak-kotak magenta 8x8 (RGB) yang dipakai untuk file yang gagal dimuat
+void makeFallbackImage(TextureImage& image);
+
+#endif // TEXTURE_H
@@ -0,0 +1,80 @@
+#ifndef WORLD_H
+#define WORLD_H
+
+#include <vector>
+#include <cstddef>
+#include <functional>
+#include <GL/glut.h>
+#include "scenery.h"
+#include "spatialhash.h"
+
+// Ukuran satu chunk dunia (world units, persegi di bidang XZ)
+const float WORLD_CHUNK_SIZE = 64.0f;
+
+// Collider lingkaran untuk batang pohon dan batu
+struct WorldCollider {
+    float x, z;
+    float radius;
+    float height;       // Entitas di atas tinggi ini tidak tertahan
+};
+
+// Satu chunk yang sudah dibangkitkan. Dibuat di thread background lalu
+// diserahkan ke thread utama; setelah itu hanya thread utama yang mengubahnya.
+struct WorldChunk {
+    int chunkX, chunkZ;
+    std::vector<SceneryObject> scenery;
+    std::vector<WorldCollider> colliders;
+    SpatialHash colliderHash;       // id = index di colliders
+    GLuint displayList;             // Mesh hasil bake (0 = belum di-bake)
+    size_t memoryBytes;             // Perkiraan memori (data + display list)
+    unsigned int lastUsedFrame;
+};
+
+// Statistik streaming untuk debug/HUD
+struct WorldStats {
+    int residentChunks;         // Chunk di memori
+    int pendingChunks;          // Chunk di antrian/sedang dibangkitkan
+    size_t memoryBytes;         // Total perkiraan memori chunk
+    unsigned int generated;     // Total chunk yang selesai dibangkitkan
+    unsigned int evicted;       // Total chunk yang dibuang
+    int visibleChunks;          // Chunk yang lolos frustum culling frame terakhir
+};
+extern WorldStats worldStats;
+
+// Pemuatan awal, dijalankan bertahap oleh loader (lihat loader.cpp):
+// beginWorldLoad() di thread GL menentukan chunk dalam radius (x, z) dan
+// mengembalikan jumlahnya; generateInitialChunk(i) mengambil chunk dari
+// cache dunia atau membangkitkannya dan boleh dipanggil paralel dari
+// worker thread; addInitialChunk() (thread GL) menyimpan dan mem-bake
+// hasilnya; finishWorldLoad() menjalankan thread generator background.
+int beginWorldLoad(float x, float z);
+WorldChunk* generateInitialChunk(int index);
+void addInitialChunk(WorldChunk* chunk);
+void finishWorldLoad();
+
+// Hentikan thread generator dan buang semua chunk (dipanggil lewat atexit)
+void shutdownWorld();
+
+// Dipanggil sekali per frame dari thread utama: ambil chunk yang selesai,
+// minta chunk baru di dalam radius, bake beberapa mesh, buang chunk di luar
+// radius atau yang melebihi batas memori.
+void updateWorldStreaming(float x, float z);
+
+// Gambar mesh chunk yang sudah di-bake dan berada di frustum (updateFrustum).
+// Dipakai pass kedalaman shadow map; pass utama memakai submitWorldChunks().
+void drawWorldChunks();
+
+// Kirim chunk yang sudah di-bake dan berada di frustum ke render queue
+void submitWorldChunks();
+
+// Panggil fn untuk setiap objek scenery chunk dalam jarak radius dari (x, z)
+// yang chunk-nya ada di frustum saat ini. Thread GL saja.
+void forEachWorldSceneryNear(float x, float z, float radius,
+                             const std::function<void(const SceneryObject&)>& fn);
+
+// true jika kotak [minX,maxX] x [minZ,maxZ] setinggi entityY menabrak
+// collider scenery di chunk yang dimuat. Read-only, aman dari worker thread
+// selama tidak bersamaan dengan updateWorldStreaming.
+bool worldCheckCollision(float minX, float minZ, float maxX, float maxZ, float entityY);
+
+#endif // WORLD_H
@@ -0,0 +1,71 @@
+#ifndef WORLDCACHE_H
+#define WORLDCACHE_H
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include "world.h"
+
+// Cache dunia hasil generate (.cache). Dibaca dengan mmap; record disalin
+// apa adanya (layout struct di memori), jadi file hanya berlaku untuk build
+// yang menulisnya. Perubahan generator atau struct wajib menaikkan versi.
+const char WORLD_CACHE_MAGIC[4] = {'T', 'B', 'W', 'C'};
+const uint32_t WORLD_CACHE_VERSION = 2;      // 2: grid navigasi tanpa collider chunk
+const uint32_t WORLD_CACHE_SECTION_ALIGN = 16;
+
+enum WorldCacheSectionType {
+    WORLD_CACHE_BUILDINGS = 1,      // Building
+    WORLD_CACHE_SCENERY = 2,        // SceneryObject (sceneryObjects)
+    WORLD_CACHE_CHUNKS = 3,         // WorldCacheChunk
+    WORLD_CACHE_CHUNK_SCENERY = 4,  // SceneryObject milik chunk
+    WORLD_CACHE_CHUNK_COLLIDERS = 5, // WorldCollider milik chunk
+    WORLD_CACHE_NAV_CELLS = 6       // unsigned char (navGrid.blocked)
+};
+
+struct WorldCacheHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t fileSize;
+    uint32_t sectionCount;
+    uint64_t seed;              // Master seed RNG
+    uint64_t contentHash;       // Hash data level + parameter generator
+};
+
+struct WorldCacheSection {
+    uint32_t type;              // WorldCacheSectionType
+    uint32_t offset;            // Dari awal file, kelipatan WORLD_CACHE_SECTION_ALIGN
+    uint32_t count;
+    uint32_t stride;
+};
+
+// Satu chunk: range di section CHUNK_SCENERY dan CHUNK_COLLIDERS
+struct WorldCacheChunk {
+    int32_t chunkX, chunkZ;
+    uint32_t firstScenery, sceneryCount;
+    uint32_t firstCollider, colliderCount;
+};
+
+// Coba pakai cache di path untuk seed dan data level saat ini (dipanggil
+// setelah level dimuat). Hit: buildings dan sceneryObjects diisi dari cache
+// dan data chunk/navigasi tersedia lewat fungsi di bawah sampai
+// closeWorldCache(). Miss (tidak ada, versi/kunci beda, rusak): false dan
+// chunk yang dibangkitkan dikumpulkan untuk saveWorldCache().
+bool openWorldCache(const char* path);
+bool worldCacheHit();
+
+// Isi chunk dari cache; false jika chunk tidak ada di cache. Read-only,
+// aman dari worker thread.
+bool getCachedChunk(int chunkX, int chunkZ, std::vector<SceneryObject>& scenery,
+                    std::vector<WorldCollider>& colliders);
+
+// Sel navigasi dari cache (nullptr jika tidak ada)
+const unsigned char* getCachedNavCells(size_t& count);
+
+// Simpan salinan chunk yang baru dibangkitkan (cache miss). Thread-safe.
+void addChunkToWorldCache(const WorldChunk& chunk);
+
+// Miss: tulis scenery, gedung, chunk terkumpul dan grid navigasi ke path.
+// Hit: lepas mapping. Dipanggil sekali setelah semua chunk awal selesai.
+void closeWorldCache(const char* path);
+
+#endif // WORLDCACHE_H
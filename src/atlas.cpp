@@ -0,0 +1,186 @@
+/*
+ * ==========================================================================
+ * TEXTURE ATLAS
+ * ==========================================================================
+ *
+ * File: atlas.cpp
+ * Author: Project Team
+ * Date: June 2025
+ *
+ * DESCRIPTION:
+ * -----------
+ * Mengemas tekstur dunia statis ke satu tekstur saat startup, sehingga
+ * dinding, atap, tangga, pagar, gedung dan scenery digambar dengan satu
+ * glBindTexture per frame (sebelumnya satu bind per dinding/atap/tangga).
+ *
+ * Setiap tile menempati sel 2T x 2T (T = sisi tile, minimal 64 piksel,
+ * sumber lebih kecil diperbesar nearest-neighbour). Isi sel adalah tekstur
+ * yang diulang melingkar dengan satu periode penuh di tengah sel, jadi
+ * setiap sisi punya padding T/2 berisi texel tetangga yang benar. Filter
+ * bilinear dan mipmap di tepi periode tidak mengambil warna tile lain
+ * selama level mipmap dibatasi (GL_TEXTURE_MAX_LEVEL = log2(T/2), padding
+ * tepat 1 texel di level terkecil).
+ *
+ * GL_TEXTURE_2D_ARRAY tidak dipakai karena pipeline fixed-function tidak
+ * bisa mengambil sampel dari texture array.
+ *
+ * Karena GL_REPEAT tidak berlaku di dalam atlas, geometri berulang dipecah
+ * oleh atlasQuad() di setiap batas ulangan. Objek tanpa texcoord (glut /
+ * GLU primitives) memakai texcoord konstan di pusat tile.
+ *
+ * FUNCTIONS:
+ * ---------
+ * composeTextureAtlas() - Decode file tile dan susun sel (tanpa GL)
+ * uploadTextureAtlas()  - Upload atlas dengan mipmap (thread GL)
+ * atlasTexCoord()       - Texcoord di dalam satu periode tile
+ * atlasSolidTexCoord()  - Texcoord konstan untuk geometri tanpa texcoord
+ * atlasQuad()           - Quad berulang yang dipecah per periode
+ *
+ * DEPENDENCIES:
+ * -----------
+ * - atlas.h   - Deklarasi dan enum AtlasTile
+ * - texture.h - loadTextureImage(), createTexture(), makeFallbackImage()
+ *
+ * ==========================================================================
+ */
+
+#include "atlas.h"
+#include "texture.h"
+#include <GL/glext.h>
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+GLuint atlasTexture = 0;
+
+// Sisi minimum satu periode tile di atlas (piksel)
+static const int ATLAS_MIN_TILE_SIZE = 64;
+
+// File sumber per tile
+static const char* const ATLAS_TILE_FILES[ATLAS_TILE_COUNT] = {
+    "texture/quartz-block.bmp",     // ATLAS_QUARTZ
+    "texture/stone.bmp"             // ATLAS_STONE
+};
+
+// Satu periode tile dalam koordinat atlas
+struct AtlasRect {
+    float u0, v0;
+    float size;
+};
+static AtlasRect tileRects[ATLAS_TILE_COUNT];
+
+// Hasil composeTextureAtlas() yang menunggu di-upload
+static TextureImage atlasImage;
+static int atlasMaxLevel = 0;
+
+static int nextPowerOfTwo(int v) {
+    int p = 1;
+    while (p < v) p <<= 1;
+    return p;
+}
+
+// Ambil warna RGBA piksel (x, y) dari gambar hasil decode
+static void readPixel(const TextureImage& image, int x, int y, unsigned char rgba[4]) {
+    const unsigned char* p = &image.pixels[((size_t)y * image.width + x) * image.channels];
+    bool bgr = image.format == GL_BGR || image.format == GL_BGRA;
+    rgba[0] = bgr ? p[2] : p[0];
+    rgba[1] = p[1];
+    rgba[2] = bgr ? p[0] : p[2];
+    rgba[3] = image.channels == 4 ? p[3] : 255;
+}
+
+void composeTextureAtlas() {
+    TextureImage sources[ATLAS_TILE_COUNT];
+    int tileSize = ATLAS_MIN_TILE_SIZE;
+    for (int i = 0; i < ATLAS_TILE_COUNT; i++) {
+        TextureImage& source = sources[i];
+        if (!loadTextureImage(ATLAS_TILE_FILES[i], source)) {
+            std::cerr << "Atlas: failed to load " << ATLAS_TILE_FILES[i] << " (using fallback)" << std::endl;
+            makeFallbackImage(source);
+        }
+        tileSize = std::max(tileSize, nextPowerOfTwo(std::max(source.width, source.height)));
+    }
+
+    // Sel 2T x 2T disusun dalam grid persegi berukuran pangkat dua
+    int cellSize = tileSize * 2;
+    int grid = nextPowerOfTwo((int)std::ceil(std::sqrt((float)ATLAS_TILE_COUNT)));
+    int atlasSize = grid * cellSize;
+
+    TextureImage& atlas = atlasImage;
+    atlas.width = atlas.height = atlasSize;
+    atlas.channels = 4;
+    atlas.format = GL_RGBA;
+    atlas.pixels.assign((size_t)atlasSize * atlasSize * 4, 0);
+
+    for (int i = 0; i < ATLAS_TILE_COUNT; i++) {
+        const TextureImage& source = sources[i];
+        int cellX = (i % grid) * cellSize;
+        int cellY = (i / grid) * cellSize;
+        for (int y = 0; y < cellSize; y++) {
+            // Posisi di dalam periode; periode mulai di tengah sel (offset T/2)
+            int periodY = (y + tileSize - tileSize / 2) % tileSize;
+            int sourceY = periodY * source.height / tileSize;
+            unsigned char* row = &atlas.pixels[((size_t)(cellY + y) * atlasSize + cellX) * 4];
+            for (int x = 0; x < cellSize; x++) {
+                int periodX = (x + tileSize - tileSize / 2) % tileSize;
+                readPixel(source, periodX * source.width / tileSize, sourceY, row + x * 4);
+            }
+        }
+        tileRects[i].u0 = (float)(cellX + tileSize / 2) / atlasSize;
+        tileRects[i].v0 = (float)(cellY + tileSize / 2) / atlasSize;
+        tileRects[i].size = (float)tileSize / atlasSize;
+    }
+
+    atlasMaxLevel = 0;
+    while ((tileSize / 2) >> (atlasMaxLevel + 1)) atlasMaxLevel++;
+    std::cout << "Texture atlas: " << atlasSize << "x" << atlasSize << ", " << ATLAS_TILE_COUNT
+              << " tiles of " << tileSize << "px, " << atlasMaxLevel + 1 << " mip levels" << std::endl;
+}
+
+void uploadTextureAtlas() {
+    atlasTexture = createTexture(atlasImage, atlasMaxLevel);
+    atlasImage.pixels.clear();
+    atlasImage.pixels.shrink_to_fit();
+}
+
+void atlasTexCoord(AtlasTile tile, float s, float t) {
+    const AtlasRect& rect = tileRects[tile];
+    glTexCoord2f(rect.u0 + s * rect.size, rect.v0 + t * rect.size);
+}
+
+void atlasSolidTexCoord(AtlasTile tile) {
+    atlasTexCoord(tile, 0.5f, 0.5f);
+}
+
+void atlasQuad(AtlasTile tile, const GLfloat corners[4][3], float repeatS, float repeatT) {
+    if (repeatS <= 0.0f || repeatT <= 0.0f) return;
+
+    // Titik di quad untuk texcoord asli (s, t), interpolasi bilinear sudut
+    auto emit = [&](float s, float t, float cellS, float cellT) {
+        float a = s / repeatS, b = t / repeatT;
+        GLfloat v[3];
+        for (int k = 0; k < 3; k++) {
+            float bottom = corners[0][k] + (corners[1][k] - corners[0][k]) * a;
+            float top = corners[3][k] + (corners[2][k] - corners[3][k]) * a;
+            v[k] = bottom + (top - bottom) * b;
+        }
+        atlasTexCoord(tile, s - cellS, t - cellT);
+        glVertex3fv(v);
+    };
+
+    // Sisa pecahan yang sangat kecil tidak dijadikan potongan sendiri
+    int cellsS = std::max(1, (int)std::ceil(repeatS - 1e-3f));
+    int cellsT = std::max(1, (int)std::ceil(repeatT - 1e-3f));
+    glBegin(GL_QUADS);
+    for (int j = 0; j < cellsT; j++) {
+        float t0 = (float)j, t1 = j == cellsT - 1 ? repeatT : (float)(j + 1);
+        for (int i = 0; i < cellsS; i++) {
+            float s0 = (float)i, s1 = i == cellsS - 1 ? repeatS : (float)(i + 1);
+            emit(s0, t0, s0, t0);
+            emit(s1, t0, s0, t0);
+            emit(s1, t1, s0, t0);
+            emit(s0, t1, s0, t0);
+        }
+    }
+    glEnd();
+}
@@ -39,10 +39,21 @@
  *                        Parameter: x, z (koordinat posisi)
  *                        Mengembalikan nilai float ketinggian tanah
  * 
+ * checkLevelCollisionAt() - Seperti checkCollisionAt() tapi tanpa collider chunk
+ *                        dunia: tidak bergantung pada chunk yang sedang dimuat,
+ *                        dipakai grid navigasi (aman di worker saat startup).
+ * checkWallCollisionAt(), checkCollisionAt(), getGroundLevelAt()
+ *                      - Versi "At" yang menerima tinggi entitas (entityY) sebagai
+ *                        parameter dan tidak membaca global player/keys. Hanya membaca
+ *                        data level (walls, fences, rooftops, staircases) dan collider
+ *                        chunk dunia sehingga aman dipanggil dari beberapa thread
+ *                        sekaligus (dipakai AI musuh) selama chunk tidak sedang diupdate.
+ * 
  * DEPENDENCIES:
  * -----------
  * - collision.h - Header file dengan deklarasi fungsi dan struct BoundingBox
  * - map.h       - Header untuk akses ke struktur walls dan fences
+ * - world.h     - Collider scenery per chunk (worldCheckCollision)
  * - input.h     - Header untuk akses ke array keys (untuk debugging)
  * 
  * HOW TO USE:
@@ -72,15 +83,16 @@
 
 #include "collision.h"
 #include "map.h"
+#include "world.h"
 #include "input.h"
 #include <cmath>
 #include <algorithm>
 #include <bits/stdc++.h>
 
-struct Doorway {
-    float x1, z1, x2, z2;
-    float baseY;
-};
+// Landing tangga menjorok sejauh ini ke samping tangga (sampai dinding)
+static const float STAIR_SIDE_REACH = 0.7f;
+// Beda tinggi maksimum untuk naik ke rooftop dari bawahnya
+static const float ROOF_STEP_UP = 0.5f;
 
 // Daftar pintu dan area yang bisa dilewati
 std::vector<Doorway> doorways = {
@@ -111,12 +123,13 @@ bool checkAABBCollision(const BoundingBox& a, const BoundingBox& b) {
             a.minZ <= b.maxZ && a.maxZ >= b.minZ);
 }
 
-CollisionResult checkWallCollision(float newX, float newZ, float oldX, float oldZ) {
+// includeWorld = false: hanya data level, tanpa collider chunk dunia
+static CollisionResult collideAt(float newX, float newZ, float oldX, float oldZ,
+                                 float entityY, bool debug, bool includeWorld) {
     CollisionResult result = {false, false, false};
 
-    // Get the player's current Y position
-    extern Player player;
-    float playerY = player.position.y;
+    // Tinggi entitas yang dicek (player atau musuh)
+    float playerY = entityY;
     float playerHeight = 2.0f;
     
     // Create bounding boxes for both potential X-only and Z-only movements
@@ -138,7 +151,7 @@ CollisionResult checkWallCollision(float newX, float newZ, float oldX, float old
     };
 
     // Debug info
-    if (keys['l'] || keys['L']) {
+    if (debug) {
         std::cout << "Checking sliding collision for position: (" << newX << "," << newZ << ")" << std::endl;
     }
     
@@ -151,8 +164,6 @@ CollisionResult checkWallCollision(float newX, float newZ, float oldX, float old
             // Prevent mounting stairs from the end (top)
             if (oldZ > stairEndZ && newZ < stairEndZ) {
                 // Check if we're coming from a legitimate rooftop position
-                float playerY = player.position.y;
-                
                 // If player is at proper rooftop height, allow them to enter stairs from top
                 // This fixes the transition from rooftop to stairs
                 if (std::abs(playerY - (stair.baseY + stair.stepHeight * stair.numSteps)) < 0.2f) {
@@ -186,14 +197,6 @@ CollisionResult checkWallCollision(float newX, float newZ, float oldX, float old
         return result; // No collision in doorways
     }
     
-    // Special doorway handling
-    if ((newX >= -2.0f && newX <= 2.0f && newZ >= 9.5f && newZ <= 10.5f) ||  // Front door
-        (newX >= -5.0f && newX <= -2.0f && newZ >= 19.5f && newZ <= 20.5f) || // Left inner door
-        (newX >= 2.0f && newX <= 5.0f && newZ >= 19.5f && newZ <= 20.5f) ||   // Right inner door
-        (newX >= -2.0f && newX <= 2.0f && newZ >= 19.5f && newZ <= 20.5f && getGroundLevel(newX, newZ) >= 4.0f)) { // Rooftop door
-        return result; // No collision in doorways
-    }
-    
     // Check collision with each wall
     for (const auto& wall : walls) {
         float minX = std::min(wall.x1, wall.x2) - wall.thickness / 2.0f;
@@ -224,7 +227,7 @@ CollisionResult checkWallCollision(float newX, float newZ, float oldX, float old
             if (collideX) result.blockX = true;
             if (collideZ) result.blockZ = true;
             
-            if (keys['l'] || keys['L']) {
+            if (debug) {
                 std::cout << "Wall collision detected: blockX=" << result.blockX 
                           << ", blockZ=" << result.blockZ << std::endl;
             }
@@ -239,10 +242,6 @@ CollisionResult checkWallCollision(float newX, float newZ, float oldX, float old
     // Check rooftops for side collisions
     for (const auto& roof : rooftops) {
         // Skip collision check if player is above the rooftop (can walk on it)
-        float playerY = 0.0f;
-        extern Player player;
-        playerY = player.position.y;
-        
         // Only check collision with rooftop sides if player is below the rooftop surface
         if (playerY + 1.8f < roof.y) {
             // Create a bounding box for each side of the rooftop
@@ -325,25 +324,56 @@ CollisionResult checkWallCollision(float newX, float newZ, float oldX, float old
         }
     }
     
+    // Collider scenery (batang pohon, batu) di chunk dunia yang dimuat
+    if (includeWorld
+        && worldCheckCollision(playerBoxFull.minX, playerBoxFull.minZ, playerBoxFull.maxX, playerBoxFull.maxZ, playerY)) {
+        result.collided = true;
+        if (worldCheckCollision(playerBoxXOnly.minX, playerBoxXOnly.minZ, playerBoxXOnly.maxX, playerBoxXOnly.maxZ, playerY)) result.blockX = true;
+        if (worldCheckCollision(playerBoxZOnly.minX, playerBoxZOnly.minZ, playerBoxZOnly.maxX, playerBoxZOnly.maxZ, playerY)) result.blockZ = true;
+    }
+    
     return result;
 }
 
+CollisionResult checkWallCollisionAt(float newX, float newZ, float oldX, float oldZ,
+                                     float entityY, bool debug) {
+    return collideAt(newX, newZ, oldX, oldZ, entityY, debug, true);
+}
+
+bool checkLevelCollisionAt(float newX, float newZ, float entityY) {
+    return collideAt(newX, newZ, newX, newZ, entityY, false, false).collided;
+}
+
+CollisionResult checkWallCollision(float newX, float newZ, float oldX, float oldZ) {
+    extern Player player;
+    return checkWallCollisionAt(newX, newZ, oldX, oldZ, player.position.y,
+                                keys['l'] || keys['L']);
+}
+
+bool checkCollisionAt(float newX, float newZ, float entityY) {
+    CollisionResult result = checkWallCollisionAt(newX, newZ, newX, newZ, entityY, false);
+    return result.collided;
+}
+
 bool checkCollision(float newX, float newZ) {
     CollisionResult result = checkWallCollision(newX, newZ, newX, newZ);
     return result.collided;
 }
 
 float getGroundLevel(float x, float z) {
+    extern Player player;
+    return getGroundLevelAt(x, z, player.position.y);
+}
+
+float getGroundLevelAt(float x, float z, float entityY) {
     float groundLevel = 0.0f;
-    float firstFloorRoofHeight = 6.5f;
-    float secondFloorBaseY = firstFloorRoofHeight;
 
     // Check staircases
     for (const auto& stair : staircases) {
         float stairEndZ = stair.startZ + (stair.stepDepth * stair.numSteps);
         float finalStepHeight = stair.baseY + (stair.stepHeight * stair.numSteps);
         
-        if (x >= stair.startX - 0.5f && x <= -9.8f) {
+        if (x >= stair.startX - 0.5f && x <= stair.startX + stair.width + STAIR_SIDE_REACH) {
             // Area tangga kecuali step terakhir
             for (int i = 0; i < stair.numSteps - 1; i++) {  // Kurangi 1 untuk skip step terakhir
                 float stepZ = stair.startZ + (stair.stepDepth * i);
@@ -369,30 +399,13 @@ float getGroundLevel(float x, float z) {
     }
 
 
-    // Check atap lantai 1
-    if (z >= 10.0f && z <= 30.0f && x >= -10.0f && x <= 10.0f) {
-        extern Player player;
-        if (player.position.y >= firstFloorRoofHeight - 0.5f) {
-            return firstFloorRoofHeight;
-        }
-    }
-
-    // Check doorways (ground level)
-    if (x >= -2.0f && x <= 2.0f && z >= 9.5f && z <= 10.5f) {
-        return 0.0f;
-    }
-    
-    // First floor internal doors
-    if ((x >= -5.0f && x <= -2.0f && z >= 19.5f && z <= 20.5f) ||
-        (x >= 2.0f && x <= 5.0f && z >= 19.5f && z <= 20.5f)) {
-        return 0.0f;
-    }
-
-    // Check lantai 2
-    if (z >= 20.0f && z <= 30.0f && x >= -10.0f && x <= 10.0f) {
-        extern Player player;
-        if (player.position.y >= firstFloorRoofHeight - 0.5f) {
-            return secondFloorBaseY; // Return ground level lantai 2
+    // Rooftop tertinggi yang sudah dicapai entitas (di atasnya atau cukup
+    // dekat untuk naik); di bawahnya entitas tetap di tanah / lewat pintu
+    for (const auto& roof : rooftops) {
+        if (x >= std::min(roof.x1, roof.x2) && x <= std::max(roof.x1, roof.x2) &&
+            z >= std::min(roof.z1, roof.z2) && z <= std::max(roof.z1, roof.z2) &&
+            entityY >= roof.y - ROOF_STEP_UP && roof.y > groundLevel) {
+            groundLevel = roof.y;
         }
     }
 
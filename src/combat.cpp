@@ -41,12 +41,14 @@
  * checkBulletHits() - Memeriksa tabrakan peluru dengan musuh
  * drawPistol()      - Menggambar model pistol
  * checkPlayerAttack() - Memeriksa apakah serangan jarak dekat player mengenai musuh
+ * checkPlayerMeleeHits() - Serangan jarak dekat ke musuh di sekitar player (lewat spatial hash)
  * 
  * DEPENDENCIES:
  * -----------
  * - combat.h  - Header file dengan deklarasi fungsi dan struct Bullet
- * - enemy.h   - Header untuk akses ke struct Enemy dan vector enemies
+ * - enemy.h   - Header untuk akses ke enemyPool
  * - object.h  - Header untuk akses ke struct Position dan Player
+ * - lights.h  - Cahaya muzzle flash dan impact
  * 
  * HOW TO USE:
  * ----------
@@ -54,7 +56,7 @@
  * 2. Panggil updateBullets() di game loop untuk memperbarui peluru
  * 3. Panggil drawBullets() saat rendering untuk menampilkan peluru
  * 4. Panggil drawPistol() untuk menggambar senjata
- * 5. Panggil checkPlayerAttack() untuk memeriksa serangan jarak dekat
+ * 5. Panggil checkPlayerMeleeHits() untuk memeriksa serangan jarak dekat
  * 
  * ==========================================================================
  */
@@ -62,6 +64,8 @@
 #include "combat.h"
 #include "enemy.h"
 #include "gamemanager.h"
+#include "glstate.h"
+#include "lights.h"
 
 #include <bits/stdc++.h>
 using namespace std; 
@@ -77,6 +81,12 @@ const float HEAD_DAMAGE_MULTIPLIER = 2.5f;   // Headshots deal 2.5x damage
 const float BODY_DAMAGE_MULTIPLIER = 1.0f;   // Body shots deal normal damage
 const float LEG_DAMAGE_MULTIPLIER = 0.6f;
 
+// Cahaya sesaat saat menembak dan saat peluru mengenai musuh
+const float MUZZLE_FLASH_RADIUS = 6.0f;
+const float MUZZLE_FLASH_DURATION = 0.08f;
+const float IMPACT_LIGHT_RADIUS = 4.0f;
+const float IMPACT_LIGHT_DURATION = 0.2f;
+
 // Create a new bullet
 void createBullet(const Position& start, const Position& direction) {
     Bullet bullet;
@@ -88,6 +98,7 @@ void createBullet(const Position& start, const Position& direction) {
     bullet.active = true;
     
     bullets.push_back(bullet);
+    spawnTransientLight(start.x, start.y, start.z, MUZZLE_FLASH_RADIUS, 2.0f, 1.6f, 0.9f, MUZZLE_FLASH_DURATION);
 }
 
 // Update all bullets
@@ -126,11 +137,10 @@ void updateBullets(float deltaTime) {
 
 // Draw all bullets
 void drawBullets() {
-    // Save current attributes
-    glPushAttrib(GL_LIGHTING_BIT | GL_CURRENT_BIT);
-    
+    // Hanya warna yang berubah; setiap objek lain menyet warnanya sendiri,
+    // jadi tidak perlu disimpan/dikembalikan
     // Set bullet material properties
-    glColor3f(1.0f, 0.8f, 0.0f); // Yellow bullet
+    glsColor3f(1.0f, 0.8f, 0.0f); // Yellow bullet
     
     for (const auto& bullet : bullets) {
         if (bullet.active) {
@@ -142,9 +152,6 @@ void drawBullets() {
             glPopMatrix();
         }
     }
-    
-    // Restore previous attributes
-    glPopAttrib();
 }
 
 // Replace the existing checkBulletHits function with this improved version
@@ -152,13 +159,13 @@ void checkBulletHits() {
     for (auto& bullet : bullets) {
         if (!bullet.active) continue;
         
-        for (auto& enemy : enemies) {
-            if (!enemy.isAlive) continue;
+        for (size_t i = 0; i < enemyPool.size(); i++) {
+            const Position& enemyPos = enemyPool.position[i];
             
             // Calculate distance from bullet to enemy
-            float dx = bullet.position.x - enemy.position.x;
-            float dy = bullet.position.y - (enemy.position.y + 1.4f); // Add offset for enemy height
-            float dz = bullet.position.z - enemy.position.z;
+            float dx = bullet.position.x - enemyPos.x;
+            float dy = bullet.position.y - (enemyPos.y + 1.4f); // Add offset for enemy height
+            float dz = bullet.position.z - enemyPos.z;
             
             // Calculate squared distance (more efficient than using sqrt)
             float distSquared = dx*dx + dz*dz;
@@ -176,7 +183,7 @@ void checkBulletHits() {
                 // Head: 1.9-2.9 units above ground
                 // Body: 0.8-1.9 units above ground
                 // Legs: 0-0.8 units above ground
-                float enemyHeight = enemy.position.y + 2.4f; // Total height with head
+                float enemyHeight = enemyPos.y + 2.4f; // Total height with head
                 float bulletHeight = bullet.position.y;
                 
                 // Check bullet height relative to enemy position
@@ -184,7 +191,7 @@ void checkBulletHits() {
                     // Headshot
                     damageMultiplier = HEAD_DAMAGE_MULTIPLIER;
                     std::cout << "HEADSHOT!" << std::endl;
-                } else if (bulletHeight >= enemy.position.y + 0.8f) {
+                } else if (bulletHeight >= enemyPos.y + 0.8f) {
                     // Body shot
                     damageMultiplier = BODY_DAMAGE_MULTIPLIER;
                     std::cout << "Body hit" << std::endl;
@@ -196,19 +203,20 @@ void checkBulletHits() {
                 
                 // Apply damage to enemy with appropriate multiplier
                 float finalDamage = BULLET_DAMAGE * damageMultiplier;
-                enemy.health -= finalDamage;
+                enemyPool.health[i] -= finalDamage;
                 
-                std::cout << "Enemy " << enemy.name << " hit for " << finalDamage 
-                          << " damage! Health: " << enemy.health << "/" << enemy.maxHealth << std::endl;
+                std::cout << "Enemy " << enemyPool.cold[i].name << " hit for " << finalDamage 
+                          << " damage! Health: " << enemyPool.health[i] << "/" << enemyPool.cold[i].maxHealth << std::endl;
                 
                 // Check if enemy is killed
-                if (enemy.health <= 0) {
-                    enemy.isAlive = false;
+                if (enemyPool.health[i] <= 0) {
                     registerEnemyKill(); // Update wave system
-                    std::cout << "Enemy " << enemy.name << " killed!" << std::endl;
+                    killEnemy(i);        // Swap-remove; loop berhenti di bawah
                 }
                 
                 // Deactivate bullet
+                spawnTransientLight(bullet.position.x, bullet.position.y, bullet.position.z,
+                                    IMPACT_LIGHT_RADIUS, 1.5f, 0.8f, 0.35f, IMPACT_LIGHT_DURATION);
                 bullet.active = false;
                 break; // Exit the enemy loop - bullet can only hit one enemy
             }
@@ -230,14 +238,14 @@ void drawPistol(bool isRightHand) {
     glPushMatrix();
         glRotatef(-90.0f, 1.0f, 0.0f, 0.0f); // Rotate to face forward
         // Main body (slide) of the pistol - dark metallic gray
-        glColor3f(0.25f, 0.25f, 0.27f);
+        glsColor3f(0.25f, 0.25f, 0.27f);
         glPushMatrix();
             glScalef(0.14f, 0.12f, 0.45f);
             glutSolidCube(1.0f);
         glPopMatrix();
         
         // Slide serrations (grip texture on the slide)
-        glColor3f(0.2f, 0.2f, 0.22f);
+        glsColor3f(0.2f, 0.2f, 0.22f);
         for (int i = 0; i < 6; i++) {
             glPushMatrix();
                 glTranslatef(0.0f, 0.06f, 0.05f - i * 0.04f);
@@ -247,7 +255,7 @@ void drawPistol(bool isRightHand) {
         }
         
         // Frame of the pistol - slightly lighter than slide
-        glColor3f(0.3f, 0.3f, 0.32f);
+        glsColor3f(0.3f, 0.3f, 0.32f);
         glPushMatrix();
             glTranslatef(0.0f, -0.02f, -0.05f);
             glScalef(0.13f, 0.08f, 0.35f);
@@ -255,7 +263,7 @@ void drawPistol(bool isRightHand) {
         glPopMatrix();
         
         // Handle/Grip of the pistol - textured black polymer
-        glColor3f(0.12f, 0.12f, 0.12f);
+        glsColor3f(0.12f, 0.12f, 0.12f);
         glPushMatrix();
             glTranslatef(0.0f, -0.18f, -0.07f);
             glRotatef(75.0f, 1.0f, 0.0f, 0.0f);
@@ -264,7 +272,7 @@ void drawPistol(bool isRightHand) {
         glPopMatrix();
         
         // Enhanced grip texture
-        glColor3f(0.08f, 0.08f, 0.08f);
+        glsColor3f(0.08f, 0.08f, 0.08f);
         for (int row = 0; row < 8; row++) {
             for (int col = 0; col < 3; col++) {
                 glPushMatrix();
@@ -278,7 +286,7 @@ void drawPistol(bool isRightHand) {
         }
         
         // Barrel - dark metal
-        glColor3f(0.15f, 0.15f, 0.15f);
+        glsColor3f(0.15f, 0.15f, 0.15f);
         glPushMatrix();
             glTranslatef(0.0f, 0.01f, 0.25f);
             glRotatef(90.0f, 1.0f, 0.0f, 0.0f);
@@ -289,7 +297,7 @@ void drawPistol(bool isRightHand) {
         glPushMatrix();
             glTranslatef(0.0f, 0.01f, 0.25f);
             glRotatef(90.0f, 1.0f, 0.0f, 0.0f);
-            glColor3f(0.1f, 0.1f, 0.1f);
+            glsColor3f(0.1f, 0.1f, 0.1f);
             gluCylinder(quadric, 0.036f, 0.036f, 0.05f, 12, 1);
         glPopMatrix();
         
@@ -297,16 +305,16 @@ void drawPistol(bool isRightHand) {
         glPushMatrix();
             glTranslatef(0.0f, 0.01f, 0.45f);
             glRotatef(90.0f, 1.0f, 0.0f, 0.0f);
-            glColor3f(0.05f, 0.05f, 0.05f);
+            glsColor3f(0.05f, 0.05f, 0.05f);
             gluDisk(quadric, 0.0f, 0.035f, 12, 1);
             
             // Barrel interior (darker)
-            glColor3f(0.02f, 0.02f, 0.02f);
+            glsColor3f(0.02f, 0.02f, 0.02f);
             gluDisk(quadric, 0.0f, 0.02f, 8, 1);
         glPopMatrix();
         
         // Trigger guard - more ergonomic shape
-        glColor3f(0.2f, 0.2f, 0.2f);
+        glsColor3f(0.2f, 0.2f, 0.2f);
         glPushMatrix();
             // Front of trigger guard
             glTranslatef(0.0f, -0.08f, 0.05f);
@@ -325,7 +333,7 @@ void drawPistol(bool isRightHand) {
         glPopMatrix();
         
         // Enhanced trigger with angled design
-        glColor3f(0.1f, 0.1f, 0.1f);
+        glsColor3f(0.1f, 0.1f, 0.1f);
         glPushMatrix();
             glTranslatef(0.0f, -0.12f, -0.02f);
             glRotatef(-15.0f, 1.0f, 0.0f, 0.0f);
@@ -334,7 +342,7 @@ void drawPistol(bool isRightHand) {
         glPopMatrix();
         
         // Hammer
-        glColor3f(0.18f, 0.18f, 0.18f);
+        glsColor3f(0.18f, 0.18f, 0.18f);
         glPushMatrix();
             glTranslatef(0.0f, 0.07f, -0.16f);
             glRotatef(-30.0f, 1.0f, 0.0f, 0.0f);
@@ -343,7 +351,7 @@ void drawPistol(bool isRightHand) {
         glPopMatrix();
         
         // Front sight (brighter for visibility)
-        glColor3f(0.9f, 0.9f, 0.9f);
+        glsColor3f(0.9f, 0.9f, 0.9f);
         glPushMatrix();
             glTranslatef(0.0f, 0.07f, 0.4f);
             glScalef(0.02f, 0.05f, 0.02f);
@@ -351,7 +359,7 @@ void drawPistol(bool isRightHand) {
         glPopMatrix();
         
         // Rear sight with notch
-        glColor3f(0.2f, 0.2f, 0.2f);
+        glsColor3f(0.2f, 0.2f, 0.2f);
         glPushMatrix();
             glTranslatef(0.0f, 0.07f, -0.14f);
             glScalef(0.1f, 0.04f, 0.02f);
@@ -359,7 +367,7 @@ void drawPistol(bool isRightHand) {
         glPopMatrix();
         
         // Sight notch (black)
-        glColor3f(0.0f, 0.0f, 0.0f);
+        glsColor3f(0.0f, 0.0f, 0.0f);
         glPushMatrix();
             glTranslatef(0.0f, 0.07f, -0.14f);
             glScalef(0.03f, 0.05f, 0.03f);
@@ -367,7 +375,7 @@ void drawPistol(bool isRightHand) {
         glPopMatrix();
         
         // Add ejection port on slide
-        glColor3f(0.1f, 0.1f, 0.1f);
+        glsColor3f(0.1f, 0.1f, 0.1f);
         glPushMatrix();
             glTranslatef(0.07f, 0.06f, -0.05f);
             glScalef(0.01f, 0.01f, 0.15f);
@@ -384,15 +392,17 @@ void drawPistol(bool isRightHand) {
     gluDeleteQuadric(quadric);
 }
 
-// Check if player's attack hits an enemy
-bool checkPlayerAttack(const Player& player, Enemy& enemy) {
-    if (!enemy.isAlive) {
+// Check if player's attack hits the enemy at dense index.
+// Musuh yang terbunuh langsung dihapus dari pool (swap-remove), jadi
+// pemanggil yang melakukan loop harus berjalan dari index terakhir.
+bool checkPlayerAttack(const Player& player, size_t index) {
+    if (index >= enemyPool.size()) {
         return false;
     }
     
     // Calculate distance between player and enemy
-    float dx = player.position.x - enemy.position.x;
-    float dz = player.position.z - enemy.position.z;
+    float dx = player.position.x - enemyPool.position[index].x;
+    float dz = player.position.z - enemyPool.position[index].z;
     float distanceSq = dx * dx + dz * dz;
     
     // Check if enemy is within attack range
@@ -406,15 +416,13 @@ bool checkPlayerAttack(const Player& player, Enemy& enemy) {
         // If player is facing the enemy (within a 90-degree arc)
         if (angleDiff < 45.0f || angleDiff > 315.0f) {
             // Apply damage to enemy
-            enemy.health -= ENEMY_DAMAGE;
+            enemyPool.health[index] -= ENEMY_DAMAGE;
             
             // Check if enemy died
-            if (enemy.health <= 0 && enemy.isAlive) {
-                enemy.isAlive = false;
-                std::cout << "Killed enemy " << enemy.name << "!" << std::endl;
-                
+            if (enemyPool.health[index] <= 0) {
                 // Register the kill with the wave system
                 registerEnemyKill();
+                killEnemy(index);
             }
             
             return true;
@@ -423,3 +431,20 @@ bool checkPlayerAttack(const Player& player, Enemy& enemy) {
     
     return false;
 }
+
+// Hanya musuh dalam jangkauan yang dicek (query spatial hash), bukan seluruh pool.
+// Index diproses dari yang terbesar karena musuh yang mati di-swap-remove.
+void checkPlayerMeleeHits(const Player& player) {
+    std::vector<size_t> nearby;
+    getEnemySpatialHash().forEachNear(player.position.x, player.position.z, ENEMY_ATTACK_RANGE,
+        [&](int id, float, float, float) {
+            if (id != SPATIAL_ID_PLAYER) {
+                nearby.push_back((size_t)id);
+            }
+        });
+    
+    std::sort(nearby.begin(), nearby.end(), std::greater<size_t>());
+    for (size_t k = 0; k < nearby.size(); k++) {
+        checkPlayerAttack(player, nearby[k]);
+    }
+}
@@ -12,15 +12,21 @@
  * Implementasi sistem musuh (enemy) untuk game, termasuk:
  * - Manajemen musuh (enemies)
  * - Sistem spawning musuh baru
- * - AI pergerakan musuh di area permainan
+ * - AI pergerakan musuh di area permainan (diupdate paralel lewat job system)
+ * - LOD simulasi: musuh jauh/di luar pandangan diupdate lebih jarang
  * - Animasi musuh berdasarkan status gerakan
  * - Rendering musuh dan health bar
  * - UI untuk informasi musuh
  * 
  * STRUCTURES:
  * ----------
- * Enemy - Didefinisikan di enemy.h
- *   - Struktur musuh dengan properti posisi, rotasi, status kesehatan, dan parameter AI
+ * EnemyPool - Didefinisikan di enemy.h
+ *   - Penyimpanan musuh SoA: hot data (posisi, timer AI, animasi) di array terpisah,
+ *     cold data (nama, max health) di tabel samping
+ *   - Musuh mati dihapus dengan swap-remove sehingga array selalu padat
+ * 
+ * EnemyHandle - Didefinisikan di enemy.h
+ *   - Handle stabil (slot + generasi) untuk referensi musuh dari luar pool
  * 
  * CONSTANTS: 
  * ---------
@@ -29,32 +35,46 @@
  * ENEMY_MIN_DISTANCE  - Jarak minimum antar musuh (20.0 units)
  * ENEMY_ATTACK_RANGE  - Jarak serangan untuk deteksi serangan player (1.5 units)
  * ENEMY_DAMAGE        - Damage yang diterima musuh dari serangan player (25.0 hit points)
+ * ENEMY_AGGRO_RANGE   - Jarak di mana musuh mulai mengejar player (40.0 units)
+ * ENEMY_STOP_DISTANCE - Jarak berhenti di depan player (1.0 units)
+ * ENEMY_SEPARATION_RADIUS - Jarak di mana pengejar saling menjauh (0.8 units)
  * 
  * GLOBAL VARIABLES:
  * ---------------
- * enemies - Vector yang menyimpan semua musuh aktif di scene
+ * enemyPool - Pool yang menyimpan semua musuh hidup di scene
  * 
  * FUNCTIONS:
  * ---------
  * initEnemySystem()           - Menginisialisasi sistem musuh dan membuat musuh awal
- * createEnemy()               - Membuat musuh baru dengan parameter yang diberikan
+ * createEnemy()               - Membuat musuh baru dan menambahkannya ke pool
+ * killEnemy()                 - Menghapus musuh yang mati dari pool
  * updateEnemyAI()             - Memperbarui pergerakan dan animasi musuh dengan AI
- * getRandomEnemyPosition()    - Menghasilkan posisi acak untuk spawn musuh
+ * getRandomEnemyPosition()    - Memilih titik spawn dari kandidat Poisson-disk yang dihitung sekali
  * spawnEnemy()                - Membuat dan menambahkan musuh baru ke scene
  * drawEnemy()                 - Menggambar model 3D musuh
  * drawEnemyHealthBar()        - Menggambar health bar di atas musuh
  * displayEnemyInfo()          - Menampilkan info musuh di layar
  * drawCrosshair()             - Menggambar crosshair dengan tampilan berbeda untuk mode scope
- * updateEnemies()             - Memperbarui semua musuh dan mengelola spawning
+ * updateEnemies()             - Memperbarui semua musuh (paralel per potongan) dan mengelola spawning
+ * getEnemySpatialHash()       - Spatial hash posisi musuh dan player untuk query tetangga
  * 
  * DEPENDENCIES:
  * -----------
- * - enemy.h     - Header file dengan deklarasi fungsi dan struct Enemy
+ * - enemy.h     - Header file dengan deklarasi fungsi dan struct EnemyPool
  * - object.h    - Header untuk akses ke struct Position dan Player
- * - render.h    - Header untuk fungsi rendering dan drawText
+ * - render.h    - Header untuk fungsi rendering
+ * - text.h      - Header untuk drawText (teks HUD di-batch)
  * - collision.h - Header untuk deteksi tabrakan
  * - map.h       - Header untuk informasi peta
  * - combat.h    - Header untuk akses ke sistem combat dan bullets
+ * - jobs.h      - Header untuk parallelFor (update AI paralel)
+ * - random.h    - Header untuk stream RNG (spawn dan AI per musuh)
+ * - navigation.h - Header untuk grid navigasi dan path A* (lewat enemy.h)
+ * - camera.h    - Header untuk posisi/arah kamera (tier LOD "terlihat")
+ * - options.h   - Header untuk batas jarak LOD (--lod-bands)
+ * - poisson.h   - Header untuk Poisson-disk sampling (kandidat titik spawn)
+ * - spatialhash.h - Header untuk spatial hash tetangga (lewat enemy.h)
+ * - world.h     - Header untuk collider scenery chunk (worldCheckCollision)
  * 
  * AI MOVEMENT BEHAVIOR:
  * -------------------
@@ -63,12 +83,29 @@
  * 3. Setelah durasi idle selesai, musuh akan memilih arah baru dan bergerak kembali
  * 4. Musuh akan mengubah arah jika bertabrakan dengan tembok
  * 5. Musuh tetap berada di dalam area permainan yang dibatasi
+ * 6. Keputusan acak memakai stream RNG_ENEMY_AI milik masing-masing musuh dan
+ *    collision memakai versi "At" yang tidak membaca player global, sehingga
+ *    hasil update identik berapapun jumlah thread yang dipakai
+ * 7. Musuh dalam ENEMY_AGGRO_RANGE mengejar player mengikuti path A* dari
+ *    cache navigasi (lewat pintu rumah). Path direncanakan di fase plan yang
+ *    serial dan hanya diulang jika sel tujuan (sel player) berubah
+ * 8. Saat berkeliaran, langkah dicek dulu ke grid navigasi sehingga langkah
+ *    ke arah dinding ditolak tanpa query collision
+ * 9. Jika pengejar >= ENEMY_FLOW_FIELD_THRESHOLD, semua pengejar memakai satu
+ *    flow field dari sel player (dibangun bertahap) dengan lookup O(1) per musuh
+ * 10. Pengejar saling menjauh (separation) dalam ENEMY_SEPARATION_RADIUS
+ *    berdasarkan snapshot spatial hash yang dibangun sebelum fase paralel,
+ *    dan jarak spawn dicek lewat query hash, bukan loop semua musuh
+ * 11. LOD simulasi (batas dari --lod-bands): musuh yang mengejar, dekat
+ *    player atau terlihat kamera diupdate setiap tick dengan animasi;
+ *    musuh jauh diupdate setiap 4 atau 16 tick dengan langkah waktu yang
+ *    dikumpulkan dan tanpa animasi tungkai
  * 
  * HOW TO USE:
  * ----------
  * 1. Panggil initEnemySystem() saat game dimulai untuk inisialisasi
  * 2. Panggil updateEnemies(deltaTime) di game loop untuk memperbarui musuh
- * 3. Panggil drawEnemy(enemy) dan drawEnemyHealthBar(enemy) saat rendering
+ * 3. Panggil drawEnemy(i) untuk setiap index 0..enemyPool.size()-1 saat rendering
  * 4. Panggil displayEnemyInfo() untuk menampilkan info musuh di layar
  * 5. Gunakan drawCrosshair(width, height) untuk menampilkan crosshair
  * 
@@ -81,6 +118,13 @@
 #include "collision.h"
 #include "map.h"
 #include "combat.h"
+#include "jobs.h"
+#include "camera.h"
+#include "options.h"
+#include "poisson.h"
+#include "glstate.h"
+#include "text.h"
+#include "world.h"
 #include <cstdlib>
 #include <ctime>
 #include <cstring> 
@@ -88,21 +132,280 @@
 #include <bits/stdc++.h>
 using namespace std; 
  
-std::vector<Enemy> enemies;
+EnemyPool enemyPool;
 
 const int MAX_ENEMIES = 5;
 const float ENEMY_SPAWN_AREA = 100.0f;
 const float ENEMY_MIN_DISTANCE = 20.0f;
+const float ENEMY_SEPARATION_RADIUS = 0.8f;
 const float ENEMY_ATTACK_RANGE = 1.5f;
 const float ENEMY_DAMAGE = 25.0f;
+const float ENEMY_AGGRO_RANGE = 40.0f;
+const float ENEMY_STOP_DISTANCE = 1.0f;
+
+// Posisi yang dikejar musuh, diisi di fase plan sebelum update paralel
+static Position chaseTarget = {0.0f, 0.0f, 0.0f};
+
+// Jumlah waypoint ke depan yang dicek line of sight untuk memotong path
+static const int ENEMY_PATH_LOOKAHEAD = 4;
+
+// Mode pengejaran (nilai EnemyPool::isChasing)
+static const unsigned char ENEMY_CHASE_NONE = 0;
+static const unsigned char ENEMY_CHASE_PATH = 1;    // Path A* per musuh (dari cache)
+static const unsigned char ENEMY_CHASE_FLOW = 2;    // Flow field bersama
+
+// Mulai dari jumlah pengejar ini, flow field dipakai sebagai pengganti A*
+static const int ENEMY_FLOW_FIELD_THRESHOLD = 16;
+
+// Batas ekspansi sel flow field per tick (build tersebar di beberapa tick)
+static const int ENEMY_FLOW_FIELD_BUDGET = 20000;
+
+// Jumlah musuh yang sudah di-spawn sejak clear terakhir. Batas MAX_ENEMIES
+// dihitung dari sini (bukan dari jumlah yang hidup) supaya musuh yang
+// terbunuh tidak langsung diganti di tengah wave.
+static int enemiesSpawnedSinceClear = 0;
+
+// Ukuran potongan untuk update AI paralel
+static const size_t ENEMY_AI_GRAIN = 256;
+
+// Nomor stream AI berikutnya. Musuh ke-N selalu mendapat stream yang sama
+// untuk seed yang sama, tidak peduli kapan musuh itu di-spawn.
+static uint32_t nextEnemyStream = 0;
+
+// Stream untuk peluang spawn di updateEnemies (sub 0; spawn musuh ke-N memakai sub N)
+static RandomStream spawnTimerRng = makeRandomStream(RNG_SPAWN, 0);
+
+// Jumlah musuh yang sudah di-spawn (nama dan sub stream spawn)
+static int enemyCount = 0;
+
+// Kembalikan semua stream musuh ke awal, agar seed yang sama menghasilkan
+// spawn dan AI yang sama setelah restart atau wave baru. Juga mengambil
+// master seed terbaru (initializer static di atas berjalan sebelum --seed).
+static void resetEnemyStreams() {
+    nextEnemyStream = 0;
+    enemyCount = 0;
+    spawnTimerRng = makeRandomStream(RNG_SPAWN, 0);
+}
+
+// Spatial hash musuh + player. Sel 2 unit: query separation (0.8) hanya
+// menyentuh 1-4 sel. Dibangun ulang (O(n)) saat diminta setelah dirty.
+static SpatialHash enemyHash;
+static bool enemyHashDirty = true;
+static const float ENEMY_HASH_CELL_SIZE = 2.0f;
+
+// Grid kasar untuk jarak spawn: sel ENEMY_MIN_DISTANCE sehingga query
+// ENEMY_MIN_DISTANCE hanya menyentuh 3x3 sel
+static SpatialHash spawnHash;
+static bool spawnHashDirty = true;
+
+// Kandidat titik spawn (Poisson-disk, dibangun saat pertama dibutuhkan)
+static std::vector<Position> spawnPoints;
+static const float ENEMY_SPAWN_BOUND = 95.0f;          // 5 units dari pagar di +-100
+static const float ENEMY_SPAWN_POINT_SPACING = 2.0f;   // Jarak antar kandidat
+static const float ENEMY_SPAWN_HOUSE_MARGIN = 1.0f;    // Jarak dari footprint rumah
+static const int ENEMY_SPAWN_ATTEMPTS = 8;             // Kandidat yang dicoba per spawn
+
+// Bobot dorongan separation terhadap arah ke target (1.0 = sama kuat)
+static const float ENEMY_SEPARATION_WEIGHT = 1.5f;
+
+// Tier LOD simulasi dan interval update-nya (dalam tick)
+static const unsigned char ENEMY_LOD_FULL = 0;      // Setiap tick + animasi
+static const unsigned char ENEMY_LOD_REDUCED = 1;   // Setiap 4 tick
+static const unsigned char ENEMY_LOD_COARSE = 2;    // Setiap 16 tick
+static const unsigned int ENEMY_LOD_INTERVAL[3] = {1, 4, 16};
+
+// Langkah waktu maksimum satu update agar langkah gerak tidak melompati
+// sel yang diblokir di grid navigasi. Sisa waktu tetap di lodPending dan
+// disimulasikan di tick berikutnya.
+static const float ENEMY_LOD_MAX_STEP = 0.3f;
+
+// Setengah lebar kotak collision musuh (sama dengan checkWallCollisionAt)
+static const float ENEMY_COLLISION_HALF = 0.3f;
+
+// Kecepatan tungkai kembali ke posisi diam di tier LOD jarang (derajat/detik)
+static const float ENEMY_LIMB_REST_SPEED = 120.0f;
+
+// Snapshot kamera untuk tes "terlihat" (diambil sekali per tick, serial)
+static unsigned int lodTick = 0;
+static float lodViewX = 0.0f, lodViewZ = 0.0f;
+static float lodViewDirX = 0.0f, lodViewDirZ = 1.0f;
+static const float ENEMY_LOD_VIEW_COS = 0.5f;  // Setengah sudut pandang ~60 derajat (dengan margin)
+
+// Sudut acak 0-359 dari stream musuh
+static float randomEnemyDirection(RandomStream& rng) {
+    return (float)rng.nextInt(360);
+}
+
+EnemyHandle EnemyPool::add(const char* name, const Position& pos, float maxHealth) {
+    unsigned int slot;
+    if (!freeSlots.empty()) {
+        slot = freeSlots.back();
+        freeSlots.pop_back();
+    } else {
+        slot = static_cast<unsigned int>(indexOfSlot.size());
+        indexOfSlot.push_back(0);
+        generation.push_back(0);
+    }
+    indexOfSlot[slot] = static_cast<unsigned int>(size());
+    slotOfIndex.push_back(slot);
+
+    position.push_back(pos);
+    rotationY.push_back(0.0f);
+    scale.push_back(1.0f);
+    health.push_back(maxHealth);
+    moveSpeed.push_back(0.0f);
+    moveDirection.push_back(0.0f);
+    moveDuration.push_back(0.0f);
+    moveTimer.push_back(0.0f);
+    idleDuration.push_back(0.0f);
+    idleTimer.push_back(0.0f);
+    isMoving.push_back(0);
+    limbSwing.push_back(0.0f);
+    animTime.push_back(0.0f);
+    rng.push_back(makeRandomStream(RNG_ENEMY_AI, 0));
+    isChasing.push_back(0);
+    NavPathRef noPath = {-1, 0};
+    navPath.push_back(noPath);
+    navWaypoint.push_back(0);
+    navGoalCell.push_back(-1);
+    lodTier.push_back(0);
+    lodPending.push_back(0.0f);
+
+    EnemyColdData data;
+    strncpy(data.name, name, sizeof(data.name) - 1);
+    data.name[sizeof(data.name) - 1] = '\0'; // Ensure null termination
+    data.maxHealth = maxHealth;
+    cold.push_back(data);
+
+    EnemyHandle handle = {slot, generation[slot]};
+    return handle;
+}
+
+// Pindahkan elemen terakhir ke posisi index lalu buang elemen terakhir
+template <typename T>
+static void swapRemove(std::vector<T>& v, size_t index) {
+    v[index] = v.back();
+    v.pop_back();
+}
+
+void EnemyPool::remove(size_t index) {
+    if (index >= size()) return;
+
+    // Handle lama untuk slot ini menjadi tidak valid
+    unsigned int slot = slotOfIndex[index];
+    generation[slot]++;
+    freeSlots.push_back(slot);
+
+    // Musuh terakhir pindah ke index yang dikosongkan
+    unsigned int movedSlot = slotOfIndex.back();
+    indexOfSlot[movedSlot] = static_cast<unsigned int>(index);
+
+    swapRemove(slotOfIndex, index);
+    swapRemove(position, index);
+    swapRemove(rotationY, index);
+    swapRemove(scale, index);
+    swapRemove(health, index);
+    swapRemove(moveSpeed, index);
+    swapRemove(moveDirection, index);
+    swapRemove(moveDuration, index);
+    swapRemove(moveTimer, index);
+    swapRemove(idleDuration, index);
+    swapRemove(idleTimer, index);
+    swapRemove(isMoving, index);
+    swapRemove(limbSwing, index);
+    swapRemove(animTime, index);
+    swapRemove(rng, index);
+    swapRemove(isChasing, index);
+    swapRemove(navPath, index);
+    swapRemove(navWaypoint, index);
+    swapRemove(navGoalCell, index);
+    swapRemove(lodTier, index);
+    swapRemove(lodPending, index);
+    swapRemove(cold, index);
+}
+
+void EnemyPool::clear() {
+    // Naikkan generasi semua slot yang masih dipakai
+    for (size_t i = 0; i < slotOfIndex.size(); i++) {
+        generation[slotOfIndex[i]]++;
+        freeSlots.push_back(slotOfIndex[i]);
+    }
+    slotOfIndex.clear();
+    position.clear();
+    rotationY.clear();
+    scale.clear();
+    health.clear();
+    moveSpeed.clear();
+    moveDirection.clear();
+    moveDuration.clear();
+    moveTimer.clear();
+    idleDuration.clear();
+    idleTimer.clear();
+    isMoving.clear();
+    limbSwing.clear();
+    animTime.clear();
+    rng.clear();
+    isChasing.clear();
+    navPath.clear();
+    navWaypoint.clear();
+    navGoalCell.clear();
+    lodTier.clear();
+    lodPending.clear();
+    cold.clear();
+}
+
+EnemyHandle EnemyPool::handleOf(size_t index) const {
+    unsigned int slot = slotOfIndex[index];
+    EnemyHandle handle = {slot, generation[slot]};
+    return handle;
+}
+
+bool EnemyPool::resolve(EnemyHandle handle, size_t& index) const {
+    if (handle.slot >= generation.size() || generation[handle.slot] != handle.generation) {
+        return false;
+    }
+    index = indexOfSlot[handle.slot];
+    return true;
+}
+
+// Isi hash dengan posisi semua musuh ditambah player
+static void buildEnemyHash(SpatialHash& hash, float cellSize) {
+    const EnemyPool& pool = enemyPool;
+    hash.reset(cellSize, pool.size() + 1);
+    for (size_t i = 0; i < pool.size(); i++) {
+        hash.insert((int)i, pool.position[i].x, pool.position[i].z);
+    }
+    hash.insert(SPATIAL_ID_PLAYER, player.position.x, player.position.z);
+}
+
+static void markEnemyHashesDirty() {
+    enemyHashDirty = true;
+    spawnHashDirty = true;
+}
+
+const SpatialHash& getEnemySpatialHash() {
+    if (enemyHashDirty) {
+        buildEnemyHash(enemyHash, ENEMY_HASH_CELL_SIZE);
+        enemyHashDirty = false;
+    }
+    return enemyHash;
+}
+
+static const SpatialHash& getSpawnSpacingHash() {
+    if (spawnHashDirty) {
+        buildEnemyHash(spawnHash, ENEMY_MIN_DISTANCE);
+        spawnHashDirty = false;
+    }
+    return spawnHash;
+}
 
 // Initialize the enemy system
 void initEnemySystem() {
-    // Seed the random number generator
-    std::srand(static_cast<unsigned int>(std::time(nullptr)));
-    
     // Clear any existing enemies
-    enemies.clear();
+    enemyPool.clear();
+    markEnemyHashesDirty();
+    enemiesSpawnedSinceClear = 0;
+    resetEnemyStreams();
     bullets.clear();
     
     // Spawn initial enemies
@@ -112,172 +415,365 @@ void initEnemySystem() {
 }
 
 // Create a new enemy with given parameters
-Enemy createEnemy(const char* name, float x, float y, float z, float maxHealth) {
-    Enemy enemy;
-    strncpy(enemy.name, name, sizeof(enemy.name) - 1);
-    enemy.name[sizeof(enemy.name) - 1] = '\0'; // Ensure null termination
-    enemy.health = maxHealth;
-    enemy.maxHealth = maxHealth;
-    enemy.position.x = x;
-    enemy.position.y = y;
-    enemy.position.z = z;
+EnemyHandle createEnemy(const char* name, float x, float y, float z, float maxHealth) {
+    Position pos = {x, y, z};
+    EnemyHandle handle = enemyPool.add(name, pos, maxHealth);
+    size_t i = enemyPool.size() - 1;
+    
+    // Stream AI milik musuh ini, juga dipakai untuk parameter awal
+    enemyPool.rng[i] = makeRandomStream(RNG_ENEMY_AI, nextEnemyStream++);
+    RandomStream& rng = enemyPool.rng[i];
     
     // Random rotation between 0 and 360 degrees
-    enemy.rotationY = (float)(rand() % 360);
+    enemyPool.rotationY[i] = (float)rng.nextInt(360);
     
-    enemy.scale = 1.0f;
-    enemy.isAlive = true;
+    // Initialize AI parameters
+    enemyPool.moveSpeed[i] = rng.range(1.0f, 3.0f); // Random speed between 1 and 3
+    enemyPool.moveDirection[i] = (float)rng.nextInt(360);
+    enemyPool.moveDuration[i] = rng.range(2.0f, 6.0f); // Move for 2-6 seconds
+    enemyPool.moveTimer[i] = enemyPool.moveDuration[i];
+    enemyPool.isMoving[i] = 1;
+    enemyPool.idleDuration[i] = rng.range(1.0f, 3.0f); // Idle for 1-3 seconds
+    enemyPool.idleTimer[i] = 0.0f;
     
-    // Initialize animation parameters
-    enemy.leftArmRotation = 0.0f;
-    enemy.rightArmRotation = 0.0f;
-    enemy.leftLegRotation = 0.0f;
-    enemy.rightLegRotation = 0.0f;
+    // Musuh baru ada di index terakhir; tambahkan langsung agar spawn
+    // beruntun tidak membangun ulang hash setiap kali
+    if (!enemyHashDirty) {
+        enemyHash.insert((int)i, x, z);
+    }
+    if (!spawnHashDirty) {
+        spawnHash.insert((int)i, x, z);
+    }
     
-    // Initialize AI parameters
-    enemy.moveSpeed = 1.0f + ((float)rand() / RAND_MAX) * 2.0f; // Random speed between 1 and 3
-    enemy.moveDirection = (float)(rand() % 360);
-    enemy.moveDuration = 2.0f + ((float)rand() / RAND_MAX) * 4.0f; // Move for 2-6 seconds
-    enemy.moveTimer = enemy.moveDuration;
-    enemy.isMoving = true;
-    enemy.idleDuration = 1.0f + ((float)rand() / RAND_MAX) * 2.0f; // Idle for 1-3 seconds
-    enemy.idleTimer = 0.0f;
+    return handle;
+}
+
+// Collider scenery chunk dunia (batang pohon, batu) di kotak musuh. Chunk
+// dimuat dan dibuang selama bermain sehingga tidak masuk grid navigasi.
+static bool sceneryBlocksEnemy(float x, float z, float y) {
+    return worldCheckCollision(x - ENEMY_COLLISION_HALF, z - ENEMY_COLLISION_HALF,
+                               x + ENEMY_COLLISION_HALF, z + ENEMY_COLLISION_HALF, y);
+}
+
+// Gerakkan musuh sejauh moveSpeed * deltaTime ke arah moveDirection.
+// Sel walkable di grid navigasi dijamin bebas dinding dan pagar, jadi di
+// sana hanya collider scenery chunk yang dicek. Query collision penuh
+// dipakai untuk sliding (allowSlide) saat sel tujuan tidak walkable dan
+// di luar grid (dunia terbuka di luar pagar).
+// Mengembalikan false jika musuh tidak bergerak sama sekali.
+static bool stepEnemy(size_t i, float deltaTime, bool allowSlide) {
+    EnemyPool& pool = enemyPool;
+    Position& pos = pool.position[i];
     
-    return enemy;
+    float rad = pool.moveDirection[i] * M_PI / 180.0f;
+    float newX = pos.x + sin(rad) * pool.moveSpeed[i] * deltaTime;
+    float newZ = pos.z + cos(rad) * pool.moveSpeed[i] * deltaTime;
+    
+    if (navCellAt(newX, newZ) < 0) {
+        if (checkCollisionAt(newX, newZ, pos.y)) return false;
+    } else if (!navIsWalkableAt(newX, newZ)) {
+        if (!allowSlide) {
+            return false;
+        }
+        // Geser sepanjang dinding pada sumbu yang tidak terblokir
+        CollisionResult hit = checkWallCollisionAt(newX, newZ, pos.x, pos.z, pos.y, false);
+        if (hit.collided) {
+            if (hit.blockX && hit.blockZ) return false;
+            if (hit.blockX) newX = pos.x;
+            if (hit.blockZ) newZ = pos.z;
+            if (checkCollisionAt(newX, newZ, pos.y)) return false;
+        }
+    } else if (sceneryBlocksEnemy(newX, newZ, pos.y)) {
+        if (!allowSlide) {
+            return false;
+        }
+        // Geser mengitari batang pohon/batu pada sumbu yang masih bebas
+        if (navIsWalkableAt(newX, pos.z) && !sceneryBlocksEnemy(newX, pos.z, pos.y)) {
+            newZ = pos.z;
+        } else if (navIsWalkableAt(pos.x, newZ) && !sceneryBlocksEnemy(pos.x, newZ, pos.y)) {
+            newX = pos.x;
+        } else {
+            return false;
+        }
+    }
+    
+    pos.x = newX;
+    pos.z = newZ;
+    
+    // Update rotasi untuk menghadap arah gerakan
+    pool.rotationY[i] = pool.moveDirection[i];
+    
+    // Update Y position berdasarkan ground level
+    pos.y = getGroundLevelAt(pos.x, pos.z, pos.y);
+    return true;
+}
+
+// Update animasi lengan dan kaki saat berjalan
+static void animateEnemyWalk(size_t i, float deltaTime) {
+    // Tungkai musuh di tier LOD jarang tidak dianimasikan, hanya kembali
+    // ke posisi diam agar tidak membeku di tengah langkah
+    if (enemyPool.lodTier[i] != ENEMY_LOD_FULL) {
+        float& swing = enemyPool.limbSwing[i];
+        float step = ENEMY_LIMB_REST_SPEED * deltaTime;
+        swing = swing > step ? swing - step : (swing < -step ? swing + step : 0.0f);
+        return;
+    }
+    const float animSpeed = 2.0f;
+    enemyPool.animTime[i] += deltaTime * enemyPool.moveSpeed[i];
+    enemyPool.limbSwing[i] = sin(enemyPool.animTime[i] * animSpeed) * 30.0f;
 }
 
-void updateEnemyAI(Enemy& enemy, float deltaTime) {
-    if (!enemy.isAlive) return;
+// Kejar chaseTarget dengan mengikuti path dari cache navigasi
+// Titik tujuan berikutnya dari path A* milik musuh
+static bool pathTarget(size_t i, float& targetX, float& targetZ) {
+    EnemyPool& pool = enemyPool;
+    const Position& pos = pool.position[i];
+    
+    const NavPath* path = navGetPath(pool.navPath[i]);
+    if (!path) {
+        return false; // Path sudah di-evict; direncanakan ulang di fase plan berikutnya
+    }
+    
+    int& waypoint = pool.navWaypoint[i];
+    int pathSize = (int)path->cells.size();
+    
+    // Lewati waypoint yang sudah tercapai atau bisa dipotong lurus
+    for (int look = 0; waypoint < pathSize && look < ENEMY_PATH_LOOKAHEAD; look++) {
+        navCellCenter(path->cells[waypoint], targetX, targetZ);
+        float dx = targetX - pos.x, dz = targetZ - pos.z;
+        bool reached = dx * dx + dz * dz < 0.04f;
+        bool skip = false;
+        if (!reached && waypoint + 1 < pathSize) {
+            float nextX, nextZ;
+            navCellCenter(path->cells[waypoint + 1], nextX, nextZ);
+            skip = navLineOfSight(pos.x, pos.z, nextX, nextZ);
+        }
+        if (!reached && !skip) break;
+        waypoint++;
+    }
+    
+    if (waypoint >= pathSize) {
+        // Sudah di sel tujuan: langsung ke player
+        targetX = chaseTarget.x;
+        targetZ = chaseTarget.z;
+    } else {
+        navCellCenter(path->cells[waypoint], targetX, targetZ);
+    }
+    return true;
+}
+
+// Titik tujuan berikutnya dari flow field (lookup O(1) per sel)
+static bool flowTarget(const Position& pos, float& targetX, float& targetZ) {
+    int cell = navCellAt(pos.x, pos.z);
+    int next = navFlowNext(cell);
+    if (next < 0) {
+        // Sel sendiri tidak tercapai field (mis. terlalu dekat dinding):
+        // tuju sel walkable terdekat dulu
+        next = navNearestWalkable(cell, 2);
+        if (next < 0 || navFlowNext(next) < 0) return false;
+        navCellCenter(next, targetX, targetZ);
+        return true;
+    }
+    if (next == cell || navFlowNext(next) == next) {
+        // Di sel tujuan atau tepat di sebelahnya: langsung ke player
+        targetX = chaseTarget.x;
+        targetZ = chaseTarget.z;
+        return true;
+    }
+    
+    // Ikuti rantai sel selama masih terlihat langsung
+    navCellCenter(next, targetX, targetZ);
+    for (int look = 1; look < ENEMY_PATH_LOOKAHEAD; look++) {
+        int further = navFlowNext(next);
+        if (further < 0 || further == next) break;
+        float fx, fz;
+        navCellCenter(further, fx, fz);
+        if (!navLineOfSight(pos.x, pos.z, fx, fz)) break;
+        next = further;
+        targetX = fx;
+        targetZ = fz;
+    }
+    return true;
+}
+
+// Kejar chaseTarget. Mengembalikan false jika tidak ada arah (musuh berkeliaran saja).
+static bool updateEnemyChase(size_t i, float deltaTime) {
+    EnemyPool& pool = enemyPool;
+    Position& pos = pool.position[i];
+    
+    float toTargetX = chaseTarget.x - pos.x;
+    float toTargetZ = chaseTarget.z - pos.z;
+    if (toTargetX * toTargetX + toTargetZ * toTargetZ < ENEMY_STOP_DISTANCE * ENEMY_STOP_DISTANCE) {
+        // Sudah di depan player: berhenti dan menghadap player
+        pool.isMoving[i] = 0;
+        pool.limbSwing[i] = 0.0f;
+        pool.rotationY[i] = atan2(toTargetX, toTargetZ) * 180.0f / M_PI;
+        return true;
+    }
+    
+    float targetX, targetZ;
+    bool hasTarget = pool.isChasing[i] == ENEMY_CHASE_FLOW
+        ? flowTarget(pos, targetX, targetZ)
+        : pathTarget(i, targetX, targetZ);
+    if (!hasTarget) {
+        return false;
+    }
+    
+    // Arah ke target (dinormalisasi) ditambah dorongan menjauh dari musuh lain.
+    // Hash adalah snapshot awal tick, jadi hasilnya tidak bergantung pada
+    // urutan thread yang sudah menggerakkan musuh lain.
+    float steerX = targetX - pos.x;
+    float steerZ = targetZ - pos.z;
+    float steerLen = sqrt(steerX * steerX + steerZ * steerZ);
+    if (steerLen > 0.0001f) {
+        steerX /= steerLen;
+        steerZ /= steerLen;
+    }
+    float pushX = 0.0f, pushZ = 0.0f;
+    enemyHash.forEachNear(pos.x, pos.z, ENEMY_SEPARATION_RADIUS,
+        [&](int other, float ox, float oz, float distSq) {
+            if (other == (int)i || other == SPATIAL_ID_PLAYER || distSq < 0.000001f) return;
+            float dist = sqrt(distSq);
+            float strength = 1.0f - dist / ENEMY_SEPARATION_RADIUS;
+            pushX += (pos.x - ox) / dist * strength;
+            pushZ += (pos.z - oz) / dist * strength;
+        });
+    steerX += pushX * ENEMY_SEPARATION_WEIGHT;
+    steerZ += pushZ * ENEMY_SEPARATION_WEIGHT;
+    
+    pool.isMoving[i] = 1;
+    pool.moveTimer[i] = pool.moveDuration[i]; // Lanjut berjalan jika berhenti mengejar
+    pool.moveDirection[i] = atan2(steerX, steerZ) * 180.0f / M_PI;
+    animateEnemyWalk(i, deltaTime);
+    stepEnemy(i, deltaTime, true);
+    return true;
+}
+
+void updateEnemyAI(size_t i, float deltaTime) {
+    EnemyPool& pool = enemyPool;
+    
+    if (pool.isChasing[i] && updateEnemyChase(i, deltaTime)) {
+        return;
+    }
     
     // Animasikan berdasarkan status gerakan
-    if (enemy.isMoving) {
+    if (pool.isMoving[i]) {
         // Update animasi lengan dan kaki
-        const float animSpeed = 2.0f;
-        static float animTime = 0.0f;
-        animTime += deltaTime * enemy.moveSpeed; 
-        
-        enemy.leftArmRotation = sin(animTime * animSpeed) * 30.0f;
-        enemy.rightArmRotation = -sin(animTime * animSpeed) * 30.0f;
-        enemy.leftLegRotation = -sin(animTime * animSpeed) * 30.0f;
-        enemy.rightLegRotation = sin(animTime * animSpeed) * 30.0f;
+        animateEnemyWalk(i, deltaTime);
         
         // Update moveTimer
-        enemy.moveTimer -= deltaTime;
+        pool.moveTimer[i] -= deltaTime;
         
-        if (enemy.moveTimer <= 0.0f) {
+        if (pool.moveTimer[i] <= 0.0f) {
             // Berhenti sejenak
-            enemy.isMoving = false;
-            enemy.idleTimer = enemy.idleDuration;
+            pool.isMoving[i] = 0;
+            pool.idleTimer[i] = pool.idleDuration[i];
             
             // Reset animasi saat berhenti
-            enemy.leftArmRotation = 0.0f;
-            enemy.rightArmRotation = 0.0f;
-            enemy.leftLegRotation = 0.0f;
-            enemy.rightLegRotation = 0.0f;
+            pool.limbSwing[i] = 0.0f;
             return;
         }
         
-        // Gerakkan enemy berdasarkan arah
-        float rad = enemy.moveDirection * M_PI / 180.0f;
-        float moveX = sin(rad) * enemy.moveSpeed * deltaTime;
-        float moveZ = cos(rad) * enemy.moveSpeed * deltaTime;
-        
-        // Cek collision sebelum bergerak
-        float newX = enemy.position.x + moveX;
-        float newZ = enemy.position.z + moveZ;
-        
-        // Memastikan tetap di dalam area permainan
-        if (newX < -95.0f) newX = -95.0f;
-        if (newX > 95.0f) newX = 95.0f;
-        if (newZ < -95.0f) newZ = -95.0f;
-        if (newZ > 95.0f) newZ = 95.0f;
-        
-        // Cek collision dengan tembok
-        if (!checkCollision(newX, newZ)) {
-            enemy.position.x = newX;
-            enemy.position.z = newZ;
-            
-            // Update rotasi untuk menghadap arah gerakan
-            enemy.rotationY = enemy.moveDirection;
-            
-            // Update Y position berdasarkan ground level
-            enemy.position.y = getGroundLevel(enemy.position.x, enemy.position.z);
-        } else {
+        // Gerakkan enemy berdasarkan arah (memakai tinggi musuh, bukan player)
+        if (!stepEnemy(i, deltaTime, false)) {
             // Jika bertemu tembok, ubah arah
-            enemy.moveDirection = (float)(rand() % 360);
+            pool.moveDirection[i] = randomEnemyDirection(pool.rng[i]);
         }
         
     } else {
         // Sedang idle (diam)
-        enemy.idleTimer -= deltaTime;
+        pool.idleTimer[i] -= deltaTime;
         
-        if (enemy.idleTimer <= 0.0f) {
+        if (pool.idleTimer[i] <= 0.0f) {
             // Kembali bergerak dengan arah acak
-            enemy.isMoving = true;
-            enemy.moveDirection = (float)(rand() % 360);
-            enemy.moveTimer = enemy.moveDuration;
+            pool.isMoving[i] = 1;
+            pool.moveDirection[i] = randomEnemyDirection(pool.rng[i]);
+            pool.moveTimer[i] = pool.moveDuration[i];
         }
     }
 }
 
-Position getRandomEnemyPosition() {
-    Position pos;
-    const float MIN_POS = -95.0f; // 5 units from fence at -100
-    const float MAX_POS = 95.0f;  // 5 units from fence at 100
-    bool validPosition = false;
+// Bangun kandidat titik spawn sekali: Poisson-disk di area spawn, hanya
+// di sel walkable grid navigasi (bebas dinding, pagar dan tangga) dan di
+// luar footprint rumah (area di bawah rooftop, diperbesar sedikit).
+static void buildEnemySpawnPoints() {
+    std::vector<PoissonPoint> points;
+    RandomStream rng = makeRandomStream(RNG_SPAWN_POINTS);
+    poissonDiskSample(-ENEMY_SPAWN_BOUND, -ENEMY_SPAWN_BOUND, ENEMY_SPAWN_BOUND, ENEMY_SPAWN_BOUND,
+                      ENEMY_SPAWN_POINT_SPACING, rng,
+                      [](float x, float z) {
+                          if (!navIsWalkableAt(x, z)) return false;
+                          for (const auto& roof : rooftops) {
+                              float minX = std::min(roof.x1, roof.x2) - ENEMY_SPAWN_HOUSE_MARGIN;
+                              float maxX = std::max(roof.x1, roof.x2) + ENEMY_SPAWN_HOUSE_MARGIN;
+                              float minZ = std::min(roof.z1, roof.z2) - ENEMY_SPAWN_HOUSE_MARGIN;
+                              float maxZ = std::max(roof.z1, roof.z2) + ENEMY_SPAWN_HOUSE_MARGIN;
+                              if (x >= minX && x <= maxX && z >= minZ && z <= maxZ) return false;
+                          }
+                          return true;
+                      },
+                      points);
     
-    // Try to find a valid position
-    int maxAttempts = 50; // Prevent infinite loop
-    int attempts = 0;
+    spawnPoints.clear();
+    spawnPoints.reserve(points.size());
+    for (size_t i = 0; i < points.size(); i++) {
+        Position pos = {points[i].x, 0.0f, points[i].z};
+        pos.y = getGroundLevelAt(pos.x, pos.z, 0.0f);
+        spawnPoints.push_back(pos);
+    }
+    std::cout << "Enemy spawn points: " << spawnPoints.size() << std::endl;
+}
+
+void invalidateEnemySpawnPoints() {
+    spawnPoints.clear();
+}
+
+// Ambil kandidat acak (O(1)) dan cek jarak ke musuh lain lewat grid kasar
+// (sel = ENEMY_MIN_DISTANCE, jadi cukup 3x3 sel). Jika setelah beberapa
+// percobaan semua kandidat terlalu dekat (area sudah penuh), dipakai
+// kandidat yang paling jauh dari musuh terdekat.
+Position getRandomEnemyPosition(RandomStream& rng) {
+    if (spawnPoints.empty()) {
+        buildEnemySpawnPoints();
+    }
+    if (spawnPoints.empty()) {
+        std::cerr << "No enemy spawn points available" << std::endl;
+        Position origin = {0.0f, getGroundLevelAt(0.0f, 0.0f, 0.0f), 0.0f};
+        return origin;
+    }
+    
+    const SpatialHash& hash = getSpawnSpacingHash();
+    const float minDistSq = ENEMY_MIN_DISTANCE * ENEMY_MIN_DISTANCE;
+    size_t best = 0;
+    float bestNearestSq = -1.0f;
     
-    while (!validPosition && attempts < maxAttempts) {
-        // Generate random position
-        pos.x = MIN_POS + (float)rand() / (float)RAND_MAX * (MAX_POS - MIN_POS);
-        pos.y = 0.0f; // Ground level
-        pos.z = MIN_POS + (float)rand() / (float)RAND_MAX * (MAX_POS - MIN_POS);
+    for (int attempt = 0; attempt < ENEMY_SPAWN_ATTEMPTS; attempt++) {
+        size_t candidate = (size_t)rng.nextInt((int)spawnPoints.size());
+        const Position& pos = spawnPoints[candidate];
         
-        // Check if position collides with walls
-        if (!checkCollision(pos.x, pos.z)) {
-            // Check distance from other enemies
-            bool tooClose = false;
-            for (const auto& enemy : enemies) {
-                float dx = pos.x - enemy.position.x;
-                float dz = pos.z - enemy.position.z;
-                float distSq = dx * dx + dz * dz;
-                
-                if (distSq < ENEMY_MIN_DISTANCE * ENEMY_MIN_DISTANCE) {
-                    tooClose = true;
-                    break;
-                }
-            }
-            
-            if (!tooClose) {
-                validPosition = true;
-            }
-        }
+        // Jarak ke musuh (dan player) terdekat dalam ENEMY_MIN_DISTANCE
+        float nearestSq = minDistSq;
+        hash.forEachNear(pos.x, pos.z, ENEMY_MIN_DISTANCE,
+            [&](int, float, float, float distSq) {
+                nearestSq = std::min(nearestSq, distSq);
+            });
         
-        attempts++;
-    }
-    
-    // If we couldn't find a good position, just use a default one
-    if (!validPosition) {
-        pos.x = 0.0f;
-        pos.y = 0.0f;
-        pos.z = 0.0f;
+        if (nearestSq >= minDistSq) {
+            return pos;
+        }
+        if (nearestSq > bestNearestSq) {
+            bestNearestSq = nearestSq;
+            best = candidate;
+        }
     }
     
-    // Set proper Y position based on ground level
-    pos.y = getGroundLevel(pos.x, pos.z);
-    
-    return pos;
+    return spawnPoints[best];
 }
 
 // Spawn a new enemy at a random position
 void spawnEnemy() {
-    static int enemyCount = 0;
-    
     // Don't spawn more than max enemies
-    if (enemies.size() >= MAX_ENEMIES) {
+    if (enemiesSpawnedSinceClear >= MAX_ENEMIES) {
         return;
     }
     
@@ -285,32 +781,42 @@ void spawnEnemy() {
     char name[50];
     sprintf(name, "Enemy %d", ++enemyCount);
     
+    // Stream spawn khusus untuk musuh ke-enemyCount
+    RandomStream rng = makeRandomStream(RNG_SPAWN, (uint32_t)enemyCount);
+    
     // Get random position
-    Position pos = getRandomEnemyPosition();
+    Position pos = getRandomEnemyPosition(rng);
     
     // Create enemy with random health between 50-100
-    float health = 50.0f + (float)rand() / (float)RAND_MAX * 50.0f;
+    float health = rng.range(50.0f, 100.0f);
     
     // Create and add the enemy
-    Enemy enemy = createEnemy(name, pos.x, pos.y, pos.z, health);
-    enemies.push_back(enemy);
+    createEnemy(name, pos.x, pos.y, pos.z, health);
+    enemiesSpawnedSinceClear++;
     
     std::cout << "Spawned " << name << " at position (" << pos.x << ", " << pos.y << ", " << pos.z << ") with " << health << " HP" << std::endl;
 }
 
+// Remove a killed enemy from the pool
+void killEnemy(size_t index) {
+    std::cout << "Enemy " << enemyPool.cold[index].name << " killed!" << std::endl;
+    enemyPool.remove(index);
+    markEnemyHashesDirty();  // Index musuh terakhir berpindah
+}
+
 // Draw an enemy
-void drawEnemy(const Enemy& enemy) {
-    if (!enemy.isAlive) {
-        return;
-    }
+void drawEnemy(size_t i) {
+    const Position& pos = enemyPool.position[i];
+    float scale = enemyPool.scale[i];
+    float swing = enemyPool.limbSwing[i];
     
     glPushMatrix();
-        glTranslatef(enemy.position.x, enemy.position.y, enemy.position.z);
-        glRotatef(enemy.rotationY, 0.0f, 1.0f, 0.0f);
-        glScalef(enemy.scale, enemy.scale, enemy.scale);
+        glTranslatef(pos.x, pos.y, pos.z);
+        glRotatef(enemyPool.rotationY[i], 0.0f, 1.0f, 0.0f);
+        glScalef(scale, scale, scale);
         
         // Enemy body - use a red color to differentiate from player
-        glColor3f(0.8f, 0.2f, 0.2f);
+        glsColor3f(0.8f, 0.2f, 0.2f);
         
         // Body
         glPushMatrix();
@@ -325,7 +831,7 @@ void drawEnemy(const Enemy& enemy) {
             glutSolidSphere(0.5f, 20, 20);
             
             // Eyes (white)
-            glColor3f(1.0f, 1.0f, 1.0f);
+            glsColor3f(1.0f, 1.0f, 1.0f);
             
             // Left eye
             glPushMatrix();
@@ -333,25 +839,25 @@ void drawEnemy(const Enemy& enemy) {
                 glutSolidSphere(0.12f, 10, 10);
                 
                 // Pupil (black)
-                glColor3f(0.0f, 0.0f, 0.0f);
+                glsColor3f(0.0f, 0.0f, 0.0f);
                 glTranslatef(0.0f, 0.0f, 0.05f);
                 glutSolidSphere(0.06f, 8, 8);
             glPopMatrix();
             
             // Right eye
-            glColor3f(1.0f, 1.0f, 1.0f);
+            glsColor3f(1.0f, 1.0f, 1.0f);
             glPushMatrix();
                 glTranslatef(0.15f, 0.1f, 0.4f);
                 glutSolidSphere(0.12f, 10, 10);
                 
                 // Pupil (black)
-                glColor3f(0.0f, 0.0f, 0.0f);
+                glsColor3f(0.0f, 0.0f, 0.0f);
                 glTranslatef(0.0f, 0.0f, 0.05f);
                 glutSolidSphere(0.06f, 8, 8);
             glPopMatrix();
             
             // Mouth (angry expression)
-            glColor3f(0.0f, 0.0f, 0.0f);
+            glsColor3f(0.0f, 0.0f, 0.0f);
             glPushMatrix();
                 glTranslatef(0.0f, -0.1f, 0.45f);
                 glScalef(0.25f, 0.05f, 0.05f);
@@ -360,14 +866,14 @@ void drawEnemy(const Enemy& enemy) {
         glPopMatrix(); 
         
         // Arms - darker red
-        glColor3f(0.6f, 0.1f, 0.1f);
+        glsColor3f(0.6f, 0.1f, 0.1f);
         
         // Update enemy arm positions:
 
         // Left arm
         glPushMatrix();
         glTranslatef(-0.6f, 1.4f, 0.0f);
-        glRotatef(enemy.leftArmRotation, 1.0f, 0.0f, 0.0f);
+        glRotatef(swing, 1.0f, 0.0f, 0.0f);
         glTranslatef(0.0f, 0.0f, 0.0f); // Changed from -0.1f to -0.5f for better arm length
         glScalef(0.3f, 1.0f, 0.3f);
         glutSolidCube(1.0f);
@@ -376,19 +882,19 @@ void drawEnemy(const Enemy& enemy) {
         // Right arm
         glPushMatrix();
         glTranslatef(0.6f, 1.4f, 0.0f);
-        glRotatef(enemy.rightArmRotation, 1.0f, 0.0f, 0.0f);
+        glRotatef(-swing, 1.0f, 0.0f, 0.0f);
         glTranslatef(0.0f, 0.0f, 0.0f); // Changed from -0.1f to -0.5f for better arm length
         glScalef(0.3f, 1.0f, 0.3f);
         glutSolidCube(1.0f);
         glPopMatrix();
         
         // Legs - black like player's
-        glColor3f(0.0f, 0.0f, 0.0f);
+        glsColor3f(0.0f, 0.0f, 0.0f);
         
         // Left leg
         glPushMatrix();
             glTranslatef(-0.2f, 0.8f, 0.0f);
-            glRotatef(enemy.leftLegRotation, 1.0f, 0.0f, 0.0f);
+            glRotatef(-swing, 1.0f, 0.0f, 0.0f);
             glTranslatef(0.0f, -0.4f, 0.0f);
             glScalef(0.35f, 1.0f, 0.3f);
             glutSolidCube(1.0f);
@@ -397,40 +903,41 @@ void drawEnemy(const Enemy& enemy) {
         // Right leg
         glPushMatrix();
             glTranslatef(0.2f, 0.8f, 0.0f);
-            glRotatef(enemy.rightLegRotation, 1.0f, 0.0f, 0.0f);
+            glRotatef(swing, 1.0f, 0.0f, 0.0f);
             glTranslatef(0.0f, -0.4f, 0.0f);
             glScalef(0.35f, 1.0f, 0.3f);
             glutSolidCube(1.0f);
         glPopMatrix();
         
         // Draw health bar above enemy
-        drawEnemyHealthBar(enemy);
+        drawEnemyHealthBar(i);
     glPopMatrix();
 }
 
 // Draw enemy health bar above the enemy
-void drawEnemyHealthBar(const Enemy& enemy) {
+void drawEnemyHealthBar(size_t i) {
     const float healthBarWidth = 1.0f;
     const float healthBarHeight = 0.15f;
     const float healthBarOffset = 3.0f; // Height above enemy
     
     // Health percentage
-    float healthPercent = enemy.health / enemy.maxHealth;
+    float healthPercent = enemyPool.health[i] / enemyPool.cold[i].maxHealth;
     
     // Get player's position to make health bar face the player
     extern Player player;
-    float dx = player.position.x - enemy.position.x;
-    float dz = player.position.z - enemy.position.z;
+    float dx = player.position.x - enemyPool.position[i].x;
+    float dz = player.position.z - enemyPool.position[i].z;
     float angleToPlayer = atan2(dx, dz) * 180.0f / M_PI;
     
-    // Save current attributes
-    glPushAttrib(GL_LIGHTING_BIT | GL_CURRENT_BIT);
+    // Lighting dikembalikan saat stateBlock keluar scope
+    static const GLenum healthBarCaps[] = {GL_LIGHTING};
+    GLStateBlock stateBlock(healthBarCaps, 1);
     
     // Disable lighting for health bar
-    glDisable(GL_LIGHTING);
+    glsDisable(GL_LIGHTING);
     
     // Health bar background (dark gray)
-    glColor3f(0.3f, 0.3f, 0.3f);
+    glsColor3f(0.3f, 0.3f, 0.3f);
     glPushMatrix();
         glTranslatef(0.0f, healthBarOffset, 0.0f);
         glRotatef(angleToPlayer, 0.0f, 1.0f, 0.0f); // Rotate to face player
@@ -441,7 +948,7 @@ void drawEnemyHealthBar(const Enemy& enemy) {
     // Current health (green to red based on health percentage)
     float red = 1.0f - healthPercent;
     float green = healthPercent;
-    glColor3f(red, green, 0.0f);
+    glsColor3f(red, green, 0.0f);
     
     glPushMatrix();
         glTranslatef(-healthBarWidth * 0.5f * (1.0f - healthPercent), healthBarOffset, 0.01f);
@@ -449,9 +956,6 @@ void drawEnemyHealthBar(const Enemy& enemy) {
         glScalef(healthBarWidth * healthPercent, healthBarHeight, 0.1f);
         glutSolidCube(1.0f);
     glPopMatrix();
-    
-    // Restore previous attributes
-    glPopAttrib();
 }
 
 // Display enemy information on the right side of the screen
@@ -469,33 +973,33 @@ void displayEnemyInfo() {
     glLoadIdentity();
     
     // Disable lighting for text
-    glDisable(GL_LIGHTING);
+    glsDisable(GL_LIGHTING);
     
     // Display enemy info
     int y = windowHeight - 20;
     int startX = windowWidth - 250;
     
     // Title
-    glColor3f(1.0f, 0.5f, 0.5f);
+    glsColor3f(1.0f, 0.5f, 0.5f);
     char title[50];
-    sprintf(title, "Enemy List (%d/%d)", static_cast<int>(enemies.size()), MAX_ENEMIES);
+    sprintf(title, "Enemy List (%d/%d)", static_cast<int>(enemyPool.size()), MAX_ENEMIES);
     drawText(title, startX, y);
     y -= 20;
     
     // List each enemy
-    for (const auto& enemy : enemies) {
-        if (enemy.isAlive) {
-            // Format: "Name: HP/MaxHP"
-            char buffer[128];
-            sprintf(buffer, "%s: %.0f/%.0f HP", enemy.name, enemy.health, enemy.maxHealth);
-            
-            // Color based on health percentage
-            float healthPercent = enemy.health / enemy.maxHealth;
-            glColor3f(1.0f - healthPercent, healthPercent, 0.0f);
-            
-            drawText(buffer, startX, y);
-            y -= 20;
-        }
+    for (size_t i = 0; i < enemyPool.size(); i++) {
+        const EnemyColdData& info = enemyPool.cold[i];
+        
+        // Format: "Name: HP/MaxHP"
+        char buffer[128];
+        sprintf(buffer, "%s: %.0f/%.0f HP", info.name, enemyPool.health[i], info.maxHealth);
+        
+        // Color based on health percentage
+        float healthPercent = enemyPool.health[i] / info.maxHealth;
+        glsColor3f(1.0f - healthPercent, healthPercent, 0.0f);
+        
+        drawText(buffer, startX, y);
+        y -= 20;
     }
     
     // Restore matrix state
@@ -506,7 +1010,7 @@ void displayEnemyInfo() {
     glPopMatrix();
     
     // Re-enable lighting
-    glEnable(GL_LIGHTING);
+    glsEnable(GL_LIGHTING);
 }
 
 void drawCrosshair(int width, int height) {
@@ -527,15 +1031,15 @@ void drawCrosshair(int width, int height) {
     glLoadIdentity();
     
     // Disable lighting and depth test for UI elements
-    glDisable(GL_LIGHTING);
-    glDisable(GL_DEPTH_TEST);
+    glsDisable(GL_LIGHTING);
+    glsDisable(GL_DEPTH_TEST);
     
     if (isScopeMode && player.combatMode == SHOOTING_MODE) {
         // Draw scope reticle
         int scopeSize = width / 4; // Size of the scope circle
         
         // Draw scope circle - black outline
-        glColor4f(0.0f, 0.0f, 0.0f, 0.7f);
+        glsColor4f(0.0f, 0.0f, 0.0f, 0.7f);
         glLineWidth(3.0f);
         
         glBegin(GL_LINE_LOOP);
@@ -572,7 +1076,7 @@ void drawCrosshair(int width, int height) {
         // Standard crosshair (original code)
         // Draw crosshair (white with black outline)
         // Horizontal line (black outline)
-        glColor3f(0.0f, 0.0f, 0.0f);
+        glsColor3f(0.0f, 0.0f, 0.0f);
         glLineWidth(thickness + 2);
         glBegin(GL_LINES);
         glVertex2i(width/2 - size - 1, height/2);
@@ -586,7 +1090,7 @@ void drawCrosshair(int width, int height) {
         glEnd();
         
         // Horizontal line (white)
-        glColor3f(1.0f, 1.0f, 1.0f);
+        glsColor3f(1.0f, 1.0f, 1.0f);
         glLineWidth(thickness);
         glBegin(GL_LINES);
         glVertex2i(width/2 - size, height/2);
@@ -600,14 +1104,14 @@ void drawCrosshair(int width, int height) {
         glEnd();
         
         // Add center dot (black outline)
-        glColor3f(0.0f, 0.0f, 0.0f);
+        glsColor3f(0.0f, 0.0f, 0.0f);
         glPointSize(3 + 2);
         glBegin(GL_POINTS);
         glVertex2i(width/2, height/2);
         glEnd();
         
         // Add center dot (white)
-        glColor3f(1.0f, 1.0f, 1.0f);
+        glsColor3f(1.0f, 1.0f, 1.0f);
         glPointSize(3);
         glBegin(GL_POINTS);
         glVertex2i(width/2, height/2);
@@ -615,8 +1119,8 @@ void drawCrosshair(int width, int height) {
     }
     
     // Restore settings
-    glEnable(GL_DEPTH_TEST);
-    glEnable(GL_LIGHTING);
+    glsEnable(GL_DEPTH_TEST);
+    glsEnable(GL_LIGHTING);
     
     // Restore matrix state
     glMatrixMode(GL_PROJECTION);
@@ -626,29 +1130,148 @@ void drawCrosshair(int width, int height) {
     glPopMatrix();
 }
 
-void updateEnemies(float deltaTime) {
-    // Check if we need to spawn new enemies
-    int aliveCount = 0;
-    for (const auto& enemy : enemies) {
-        if (enemy.isAlive) {
-            aliveCount++;
+// Fase plan (serial): tentukan musuh mana yang mengejar player dan siapkan
+// arahnya. Untuk sedikit pengejar dipakai path A* per musuh yang hanya
+// diminta ulang jika sel tujuan berubah atau path lama keluar dari cache.
+// Untuk banyak pengejar dipakai satu flow field bersama sehingga biaya
+// pathfinding tidak tumbuh dengan jumlah musuh.
+static void planEnemyPaths() {
+    navBeginTick();
+    chaseTarget = player.position;
+    
+    // Player di atap/lantai 2 tidak bisa dikejar lewat grid lantai dasar
+    int goalCell = -1;
+    if (player.position.y < 1.0f) {
+        goalCell = navNearestWalkable(navCellAt(player.position.x, player.position.z), 4);
+    }
+    
+    EnemyPool& pool = enemyPool;
+    int chaserCount = 0;
+    for (size_t i = 0; i < pool.size(); i++) {
+        float dx = chaseTarget.x - pool.position[i].x;
+        float dz = chaseTarget.z - pool.position[i].z;
+        bool inRange = goalCell >= 0 && dx * dx + dz * dz < ENEMY_AGGRO_RANGE * ENEMY_AGGRO_RANGE;
+        pool.isChasing[i] = inRange ? ENEMY_CHASE_PATH : ENEMY_CHASE_NONE;
+        if (inRange) chaserCount++;
+    }
+    
+    if (chaserCount >= ENEMY_FLOW_FIELD_THRESHOLD) {
+        // Field dilanjutkan sedikit demi sedikit; selama field pertama belum
+        // selesai musuh tetap berkeliaran
+        navFlowUpdate(goalCell, ENEMY_FLOW_FIELD_BUDGET);
+        unsigned char mode = navFlowGoal() >= 0 ? ENEMY_CHASE_FLOW : ENEMY_CHASE_NONE;
+        for (size_t i = 0; i < pool.size(); i++) {
+            if (pool.isChasing[i]) {
+                pool.isChasing[i] = mode;
+                pool.navGoalCell[i] = -1;
+            }
         }
+        return;
     }
     
+    for (size_t i = 0; i < pool.size(); i++) {
+        if (!pool.isChasing[i]) {
+            pool.navGoalCell[i] = -1;
+            continue;
+        }
+        
+        if (pool.navGoalCell[i] == goalCell) {
+            if (navRetainPath(pool.navPath[i])) {
+                continue;
+            }
+            if (pool.navPath[i].slot < 0) {
+                // Tujuan ini sudah gagal dicari; tunggu sampai player pindah sel
+                pool.isChasing[i] = ENEMY_CHASE_NONE;
+                continue;
+            }
+        }
+        
+        pool.navGoalCell[i] = goalCell;
+        if (!navRequestPath(pool.position[i].x, pool.position[i].z, goalCell,
+                            pool.navPath[i], pool.navWaypoint[i])) {
+            pool.isChasing[i] = ENEMY_CHASE_NONE;
+        }
+    }
+}
+
+// Ambil snapshot kamera untuk tier LOD tick ini
+static void beginEnemyLodTick() {
+    lodTick++;
+    lodViewX = cameraX;
+    lodViewZ = cameraZ;
+    float len = sqrt(cameraLX * cameraLX + cameraLZ * cameraLZ);
+    if (len > 0.0001f) {
+        lodViewDirX = cameraLX / len;
+        lodViewDirZ = cameraLZ / len;
+    }
+}
+
+// Tentukan tier LOD musuh i dan apakah musuh ini diupdate tick ini.
+// stepTime diisi waktu yang disimulasikan (deltaTime + waktu tertunda).
+// Hanya menulis data musuh i, aman dipanggil dari fase paralel.
+static bool scheduleEnemyLod(size_t i, float deltaTime, float& stepTime) {
+    EnemyPool& pool = enemyPool;
+    const Position& pos = pool.position[i];
+    
+    float dx = pos.x - player.position.x;
+    float dz = pos.z - player.position.z;
+    float distSq = dx * dx + dz * dz;
+    float nearDist = gameOptions.lodNearDistance;
+    float farDist = gameOptions.lodFarDistance;
+    
+    unsigned char tier = ENEMY_LOD_COARSE;
+    if (pool.isChasing[i] || distSq < nearDist * nearDist) {
+        tier = ENEMY_LOD_FULL;
+    } else if (distSq < farDist * farDist) {
+        // Di dalam band jauh: penuh jika berada di depan kamera
+        float vx = pos.x - lodViewX;
+        float vz = pos.z - lodViewZ;
+        float along = vx * lodViewDirX + vz * lodViewDirZ;
+        bool inView = along > 0.0f && along * along >= ENEMY_LOD_VIEW_COS * ENEMY_LOD_VIEW_COS * (vx * vx + vz * vz);
+        tier = inView ? ENEMY_LOD_FULL : ENEMY_LOD_REDUCED;
+    }
+    pool.lodTier[i] = tier;
+    
+    pool.lodPending[i] += deltaTime;
+    // Index ditambahkan ke tick agar musuh satu tier tersebar ke tick berbeda.
+    // Waktu tertunda yang sudah melewati satu langkah penuh tetap diupdate
+    // (frame rate rendah) supaya musuh jauh tidak tertinggal.
+    if ((lodTick + (unsigned int)i) % ENEMY_LOD_INTERVAL[tier] != 0
+        && pool.lodPending[i] < ENEMY_LOD_MAX_STEP) {
+        return false;
+    }
+    stepTime = std::min(pool.lodPending[i], ENEMY_LOD_MAX_STEP);
+    pool.lodPending[i] -= stepTime;
+    return true;
+}
+
+void updateEnemies(float deltaTime) {
+    // Check if we need to spawn new enemies
+    int aliveCount = getAliveEnemyCount();
+    
     // Spawn new enemies if needed
     if (aliveCount < MAX_ENEMIES) {
         // Random chance to spawn a new enemy (adjusted to be approximately every 3-5 seconds)
-        if ((float)rand() / RAND_MAX < 0.01f) {
+        if (spawnTimerRng.nextFloat() < 0.01f) {
             spawnEnemy();
         }
     }
     
-    // Update enemy animations and AI
-    for (auto& enemy : enemies) {
-        if (enemy.isAlive) {
-            updateEnemyAI(enemy, deltaTime);
+    // Rencanakan path (serial), lalu update AI (paralel per potongan index).
+    // Hash dibangun sebelum fase paralel dan hanya dibaca di dalamnya.
+    planEnemyPaths();
+    beginEnemyLodTick();
+    markEnemyHashesDirty();
+    getEnemySpatialHash();
+    parallelFor(enemyPool.size(), ENEMY_AI_GRAIN, [deltaTime](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            float stepTime;
+            if (scheduleEnemyLod(i, deltaTime, stepTime)) {
+                updateEnemyAI(i, stepTime);
+            }
         }
-    }
+    });
+    markEnemyHashesDirty();  // Posisi sudah berubah
     
     // Update bullets
     updateBullets(deltaTime);
@@ -667,16 +1290,14 @@ void spawnWaveEnemies(int count) {
 }
 
 int getAliveEnemyCount() {
-    int aliveCount = 0;
-    for (const auto& enemy : enemies) {
-        if (enemy.isAlive) {
-            aliveCount++;
-        }
-    }
-    return aliveCount;
+    // Pool hanya berisi musuh yang hidup
+    return static_cast<int>(enemyPool.size());
 }
 
 void clearAllEnemies() {
-    enemies.clear();
+    enemyPool.clear();
+    markEnemyHashesDirty();
+    enemiesSpawnedSinceClear = 0;
+    resetEnemyStreams();
     std::cout << "Cleared all enemies from the scene." << std::endl;
 }
\ No newline at end of file
@@ -0,0 +1,76 @@
+/*
+ * ==========================================================================
+ * VIEW FRUSTUM CULLING
+ * ==========================================================================
+ *
+ * File: frustum.cpp
+ * Author: Project Team
+ * Date: June 2025
+ *
+ * DESCRIPTION:
+ * -----------
+ * Bidang frustum diambil langsung dari matriks gabungan clip = P x MV
+ * (metode Gribb/Hartmann): setiap bidang adalah baris ke-4 matriks
+ * ditambah/dikurangi baris x, y atau z. Matriks dibaca sekali per frame
+ * dengan glGetFloatv, sehingga otomatis mengikuti FOV scope, first/third
+ * person dan aspect ratio tanpa menduplikasi logika kamera.
+ *
+ * Tes AABB memakai "positive vertex": untuk tiap bidang hanya sudut kotak
+ * yang paling jauh ke arah normal yang dicek. Jika sudut itu pun di luar,
+ * seluruh kotak di luar.
+ *
+ * FUNCTIONS:
+ * ---------
+ * updateFrustum()     - Ekstrak bidang dari matriks GL saat ini
+ * frustumBoxVisible() - Tes AABB vs frustum
+ *
+ * DEPENDENCIES:
+ * -----------
+ * - frustum.h - Deklarasi fungsi
+ * - GL/glut.h - glGetFloatv
+ *
+ * ==========================================================================
+ */
+
+#include "frustum.h"
+#include <GL/glut.h>
+
+// a*x + b*y + c*z + d >= 0 berarti di sisi dalam
+static float planes[6][4];
+
+void updateFrustum() {
+    GLfloat projection[16], modelview[16], clip[16];
+    glGetFloatv(GL_PROJECTION_MATRIX, projection);
+    glGetFloatv(GL_MODELVIEW_MATRIX, modelview);
+
+    // Matriks GL column-major: clip[col * 4 + row]
+    for (int col = 0; col < 4; col++) {
+        for (int row = 0; row < 4; row++) {
+            clip[col * 4 + row] = projection[0 * 4 + row] * modelview[col * 4 + 0]
+                                + projection[1 * 4 + row] * modelview[col * 4 + 1]
+                                + projection[2 * 4 + row] * modelview[col * 4 + 2]
+                                + projection[3 * 4 + row] * modelview[col * 4 + 3];
+        }
+    }
+
+    // Bidang ke-2i = baris4 + baris i, ke-2i+1 = baris4 - baris i (kiri/kanan, bawah/atas, dekat/jauh)
+    for (int axis = 0; axis < 3; axis++) {
+        for (int c = 0; c < 4; c++) {
+            planes[axis * 2][c]     = clip[c * 4 + 3] + clip[c * 4 + axis];
+            planes[axis * 2 + 1][c] = clip[c * 4 + 3] - clip[c * 4 + axis];
+        }
+    }
+}
+
+bool frustumBoxVisible(float minX, float minY, float minZ, float maxX, float maxY, float maxZ) {
+    for (int i = 0; i < 6; i++) {
+        const float* p = planes[i];
+        float x = p[0] >= 0.0f ? maxX : minX;
+        float y = p[1] >= 0.0f ? maxY : minY;
+        float z = p[2] >= 0.0f ? maxZ : minZ;
+        if (p[0] * x + p[1] * y + p[2] * z + p[3] < 0.0f) {
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,260 @@
+/*
+ * ==========================================================================
+ * GL STATE CACHE
+ * ==========================================================================
+ *
+ * File: glstate.cpp
+ * Author: Project Team
+ * Date: June 2025
+ *
+ * DESCRIPTION:
+ * -----------
+ * Lapisan tipis di atas OpenGL yang mengingat state terakhir yang diset:
+ * capability (glEnable/glDisable), blend func, depth mask, tekstur yang
+ * ter-bind di unit 0, warna saat ini (= material lewat
+ * GL_COLOR_MATERIAL) dan material specular. Panggilan yang tidak mengubah apa pun dilewati dan
+ * dihitung di glStateStats sehingga HUD bisa menampilkan berapa
+ * perubahan state yang dihemat per frame.
+ *
+ * State awal dianggap "tidak diketahui": panggilan pertama selalu
+ * diteruskan. Cache tetap benar selama semua kode memakai gls*:
+ * - Display list: saat di-compile panggilan diteruskan tanpa mengubah
+ *   cache; setelah glsCallList warna dianggap tidak diketahui.
+ * - glPushAttrib/glPopAttrib akan mengubah state di belakang cache,
+ *   jadi diganti GLStateBlock yang mengembalikan state lewat cache.
+ * - Unit tekstur selain 0 (shadow map) tidak dilacak.
+ *
+ * Jika lighting memakai shader (shader.cpp), GL_LIGHTING, GL_TEXTURE_2D
+ * dan material juga diteruskan sebagai uniform program; saat compile
+ * display list uniform itu ikut direkam ke list.
+ *
+ * FUNCTIONS:
+ * ---------
+ * glsEnable(), glsDisable()     - Capability
+ * glsBlendFunc(), glsDepthMask() - Blend dan depth write
+ * glsBindTexture()              - Tekstur unit 0
+ * glsColor3f(), glsColor4f()    - Warna/material saat ini
+ * glsGetColor()                 - Baca warna saat ini
+ * glsMaterial()                 - Material specular
+ * glsNewList(), glsEndList()    - Compile display list
+ * glsCallList()                 - Eksekusi display list
+ * GLStateBlock                  - Blok state pengganti glPushAttrib
+ *
+ * DEPENDENCIES:
+ * -----------
+ * - glstate.h - Deklarasi
+ * - shader.h  - Uniform program lighting
+ *
+ * ==========================================================================
+ */
+
+#include "glstate.h"
+#include "shader.h"
+#include <cstring>
+
+GLStateStats glStateStats = {0, 0};
+
+// Capability yang dilacak; indeks = posisi di tabel ini
+static const GLenum trackedCaps[] = {
+    GL_LIGHTING, GL_TEXTURE_2D, GL_BLEND, GL_DEPTH_TEST, GL_CULL_FACE,
+    GL_POLYGON_OFFSET_FILL, GL_CLIP_PLANE0, GL_LIGHT0, GL_NORMALIZE, GL_COLOR_MATERIAL
+};
+static const int TRACKED_CAP_COUNT = sizeof(trackedCaps) / sizeof(trackedCaps[0]);
+
+// -1 = tidak diketahui, 0 = mati, 1 = aktif
+static signed char capValues[TRACKED_CAP_COUNT] = {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1};
+static GLenum cachedBlendSrc = 0, cachedBlendDst = 0;
+static bool blendKnown = false;
+static signed char depthMaskValue = -1;
+static GLuint boundTexture = 0;
+static bool textureKnown = false;
+static GLfloat currentColor[4];
+static bool colorKnown = false;
+static GLfloat materialSpecular = 0.0f, materialShininess = 0.0f;
+static bool materialKnown = false;
+static int compilingLists = 0;                      // > 0 saat glNewList aktif
+
+static int capIndex(GLenum cap) {
+    for (int i = 0; i < TRACKED_CAP_COUNT; i++) {
+        if (trackedCaps[i] == cap) return i;
+    }
+    return -1;
+}
+
+static void setCap(GLenum cap, bool enable) {
+    int index = capIndex(cap);
+    if (compilingLists == 0 && index >= 0) {
+        if (capValues[index] == (enable ? 1 : 0)) {
+            glStateStats.skipped++;
+            return;
+        }
+        capValues[index] = enable ? 1 : 0;
+    }
+    if (enable) glEnable(cap);
+    else glDisable(cap);
+    glStateStats.issued++;
+    if (cap == GL_LIGHTING || cap == GL_TEXTURE_2D) {
+        shaderCapabilityChanged(cap, enable, compilingLists > 0);
+    }
+}
+
+void glsEnable(GLenum cap) {
+    setCap(cap, true);
+}
+
+void glsDisable(GLenum cap) {
+    setCap(cap, false);
+}
+
+void glsBlendFunc(GLenum src, GLenum dst) {
+    if (compilingLists == 0) {
+        if (blendKnown && cachedBlendSrc == src && cachedBlendDst == dst) {
+            glStateStats.skipped++;
+            return;
+        }
+        cachedBlendSrc = src;
+        cachedBlendDst = dst;
+        blendKnown = true;
+    }
+    glBlendFunc(src, dst);
+    glStateStats.issued++;
+}
+
+void glsDepthMask(GLboolean flag) {
+    if (compilingLists == 0) {
+        if (depthMaskValue == (flag ? 1 : 0)) {
+            glStateStats.skipped++;
+            return;
+        }
+        depthMaskValue = flag ? 1 : 0;
+    }
+    glDepthMask(flag);
+    glStateStats.issued++;
+}
+
+void glsBindTexture(GLuint texture) {
+    if (compilingLists == 0) {
+        if (textureKnown && boundTexture == texture) {
+            glStateStats.skipped++;
+            return;
+        }
+        boundTexture = texture;
+        textureKnown = true;
+    }
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glStateStats.issued++;
+}
+
+void glsColor4f(GLfloat r, GLfloat g, GLfloat b, GLfloat a) {
+    if (compilingLists == 0) {
+        if (colorKnown && currentColor[0] == r && currentColor[1] == g
+            && currentColor[2] == b && currentColor[3] == a) {
+            glStateStats.skipped++;
+            return;
+        }
+        currentColor[0] = r;
+        currentColor[1] = g;
+        currentColor[2] = b;
+        currentColor[3] = a;
+        colorKnown = true;
+    }
+    glColor4f(r, g, b, a);
+    glStateStats.issued++;
+}
+
+void glsColor3f(GLfloat r, GLfloat g, GLfloat b) {
+    glsColor4f(r, g, b, 1.0f);
+}
+
+void glsGetColor(GLfloat color[4]) {
+    if (!colorKnown) {
+        glGetFloatv(GL_CURRENT_COLOR, currentColor);
+        colorKnown = true;
+    }
+    std::memcpy(color, currentColor, sizeof(currentColor));
+}
+
+void glsMaterial(GLfloat specular, GLfloat shininess) {
+    if (compilingLists == 0) {
+        if (materialKnown && materialSpecular == specular && materialShininess == shininess) {
+            glStateStats.skipped++;
+            return;
+        }
+        materialSpecular = specular;
+        materialShininess = shininess;
+        materialKnown = true;
+    }
+    GLfloat color[4] = {specular, specular, specular, 1.0f};
+    glMaterialfv(GL_FRONT, GL_SPECULAR, color);
+    glMaterialf(GL_FRONT, GL_SHININESS, shininess);
+    shaderMaterialChanged(specular, shininess, compilingLists > 0);
+    glStateStats.issued++;
+}
+
+void glsNewList(GLuint list) {
+    glNewList(list, GL_COMPILE);
+    compilingLists++;
+}
+
+void glsEndList() {
+    glEndList();
+    compilingLists--;
+}
+
+void glsCallList(GLuint list) {
+    glCallList(list);
+    colorKnown = false;
+    materialKnown = false;
+}
+
+void glsInvalidateColor() {
+    colorKnown = false;
+}
+
+void resetGLStateStats() {
+    glStateStats.issued = 0;
+    glStateStats.skipped = 0;
+}
+
+GLStateBlock::GLStateBlock(const GLenum* caps, int capCount, unsigned extras)
+    : savedCount(0), savedExtras(extras) {
+    for (int i = 0; i < capCount && savedCount < MAX_CAPS; i++) {
+        int index = capIndex(caps[i]);
+        if (index >= 0 && capValues[index] < 0) {
+            capValues[index] = glIsEnabled(caps[i]) ? 1 : 0;
+        }
+        savedCaps[savedCount] = caps[i];
+        savedValues[savedCount] = index >= 0 ? capValues[index] == 1 : glIsEnabled(caps[i]) == GL_TRUE;
+        savedCount++;
+    }
+    if (extras & BLEND_FUNC) {
+        if (!blendKnown) {
+            GLint src, dst;
+            glGetIntegerv(GL_BLEND_SRC, &src);
+            glGetIntegerv(GL_BLEND_DST, &dst);
+            cachedBlendSrc = (GLenum)src;
+            cachedBlendDst = (GLenum)dst;
+            blendKnown = true;
+        }
+        blendSrc = cachedBlendSrc;
+        blendDst = cachedBlendDst;
+    }
+    if (extras & DEPTH_MASK) {
+        if (depthMaskValue < 0) {
+            GLboolean mask;
+            glGetBooleanv(GL_DEPTH_WRITEMASK, &mask);
+            depthMaskValue = mask ? 1 : 0;
+        }
+        depthMask = depthMaskValue ? GL_TRUE : GL_FALSE;
+    }
+    if (extras & COLOR) glsGetColor(color);
+}
+
+GLStateBlock::~GLStateBlock() {
+    for (int i = 0; i < savedCount; i++) {
+        setCap(savedCaps[i], savedValues[i]);
+    }
+    if (savedExtras & BLEND_FUNC) glsBlendFunc(blendSrc, blendDst);
+    if (savedExtras & DEPTH_MASK) glsDepthMask(depthMask);
+    if (savedExtras & COLOR) glsColor4f(color[0], color[1], color[2], color[3]);
+}
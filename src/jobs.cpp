@@ -0,0 +1,175 @@
+/*
+ * ==========================================================================
+ * JOB SYSTEM (THREAD POOL) IMPLEMENTATION
+ * ==========================================================================
+ *
+ * File: jobs.cpp
+ * Author: Project Team
+ * Date: June 2025
+ *
+ * DESCRIPTION:
+ * -----------
+ * Thread pool sederhana untuk pekerjaan data-parallel (misalnya AI musuh):
+ * - Worker thread dibuat sekali saat startup dan tidur saat tidak ada kerja
+ * - parallelFor() membagi range index menjadi potongan (chunk) yang diambil
+ *   worker secara atomik, thread pemanggil ikut memproses potongan
+ * - Satu parallelFor berjalan pada satu waktu (dipanggil dari game loop)
+ *
+ * GLOBAL VARIABLES (static):
+ * ---------------
+ * workers      - Daftar worker thread
+ * currentJob   - Pekerjaan yang sedang dibagikan ke worker
+ * jobSerial    - Nomor pekerjaan, naik setiap parallelFor baru
+ *
+ * FUNCTIONS:
+ * ---------
+ * initJobSystem()     - Membuat worker thread
+ * shutdownJobSystem() - Menghentikan worker thread
+ * getJobThreadCount() - Jumlah thread yang bekerja (worker + pemanggil)
+ * parallelFor()       - Menjalankan fungsi untuk setiap potongan range secara paralel
+ *
+ * HOW TO USE:
+ * ----------
+ * 1. Panggil initJobSystem(n) sekali saat startup
+ * 2. parallelFor(count, grain, [&](size_t b, size_t e) { for (i = b; i < e; i++) ... });
+ * 3. shutdownJobSystem() dipanggil otomatis saat program keluar (atexit)
+ *
+ * ==========================================================================
+ */
+
+#include "jobs.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+struct ParallelJob {
+    const JobRangeFunc* fn;
+    size_t count;
+    size_t grain;
+    size_t chunkCount;
+    std::atomic<size_t> nextChunk;
+    size_t workersDone;      // Worker yang sudah selesai dengan job ini
+};
+
+static std::vector<std::thread> workers;
+static std::mutex jobMutex;
+static std::condition_variable jobAvailable;
+static std::condition_variable jobFinished;
+static ParallelJob currentJob;
+static unsigned long jobSerial = 0;
+static bool stopWorkers = false;
+static bool atexitRegistered = false;
+
+// Ambil dan kerjakan potongan sampai habis.
+static void runChunks(ParallelJob& job) {
+    for (;;) {
+        size_t chunk = job.nextChunk.fetch_add(1);
+        if (chunk >= job.chunkCount) {
+            return;
+        }
+        size_t begin = chunk * job.grain;
+        size_t end = begin + job.grain;
+        if (end > job.count) end = job.count;
+
+        (*job.fn)(begin, end);
+    }
+}
+
+static void workerLoop() {
+    unsigned long seenSerial = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(jobMutex);
+            while (!stopWorkers && jobSerial == seenSerial) {
+                jobAvailable.wait(lock);
+            }
+            if (stopWorkers) {
+                return;
+            }
+            seenSerial = jobSerial;
+        }
+        runChunks(currentJob);
+
+        // Setiap worker melapor untuk setiap job, sehingga currentJob tidak
+        // disentuh lagi setelah parallelFor kembali
+        std::lock_guard<std::mutex> lock(jobMutex);
+        currentJob.workersDone++;
+        if (currentJob.workersDone == workers.size()) {
+            jobFinished.notify_all();
+        }
+    }
+}
+
+void initJobSystem(int threadCount) {
+    shutdownJobSystem();
+
+    if (threadCount <= 0) {
+        threadCount = static_cast<int>(std::thread::hardware_concurrency());
+        if (threadCount <= 0) threadCount = 1;
+    }
+
+    stopWorkers = false;
+    // Thread pemanggil ikut bekerja, jadi worker = threadCount - 1
+    for (int i = 1; i < threadCount; i++) {
+        workers.push_back(std::thread(workerLoop));
+    }
+
+    if (!atexitRegistered) {
+        std::atexit(shutdownJobSystem);
+        atexitRegistered = true;
+    }
+
+    std::cout << "Job system: " << threadCount << " thread(s)" << std::endl;
+}
+
+void shutdownJobSystem() {
+    {
+        std::lock_guard<std::mutex> lock(jobMutex);
+        stopWorkers = true;
+    }
+    jobAvailable.notify_all();
+    for (size_t i = 0; i < workers.size(); i++) {
+        workers[i].join();
+    }
+    workers.clear();
+}
+
+int getJobThreadCount() {
+    return static_cast<int>(workers.size()) + 1;
+}
+
+void parallelFor(size_t count, size_t grain, const JobRangeFunc& fn) {
+    if (count == 0) {
+        return;
+    }
+    if (grain == 0) grain = 1;
+
+    // Tidak ada worker atau hanya satu potongan: jalankan langsung
+    if (workers.empty() || count <= grain) {
+        fn(0, count);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(jobMutex);
+        currentJob.fn = &fn;
+        currentJob.count = count;
+        currentJob.grain = grain;
+        currentJob.chunkCount = (count + grain - 1) / grain;
+        currentJob.nextChunk.store(0);
+        currentJob.workersDone = 0;
+        jobSerial++;
+    }
+    jobAvailable.notify_all();
+
+    runChunks(currentJob);
+
+    std::unique_lock<std::mutex> lock(jobMutex);
+    while (currentJob.workersDone < workers.size()) {
+        jobFinished.wait(lock);
+    }
+}
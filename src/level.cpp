@@ -0,0 +1,335 @@
+/*
+ * ==========================================================================
+ * LEVEL FILE (BINARY + TEXT CONVERTER)
+ * ==========================================================================
+ *
+ * File: level.cpp
+ * Author: Project Team
+ * Date: June 2025
+ *
+ * DESCRIPTION:
+ * -----------
+ * Layout peta (dinding, atap, tangga, pagar, pintu dan scenery authored)
+ * disimpan di file level sehingga peta bisa diubah tanpa compile ulang.
+ * Designer mengedit file teks lalu mengubahnya menjadi file biner:
+ *
+ *     tubes --convert-level levels/town.txt levels/town.lvl
+ *
+ * Game hanya membaca file biner. File di-mmap, header dan tabel section
+ * divalidasi, lalu record setiap section disalin langsung (memcpy) ke
+ * vector global karena layout record sama persis dengan struct di memori.
+ * Tidak ada parsing per field saat startup.
+ *
+ * FORMAT BINER (little-endian, lihat level.h):
+ * -------------------------------------------
+ * LevelFileHeader | LevelSectionEntry x sectionCount | data section...
+ * Data section dimulai di offset kelipatan 16. Section dengan tipe yang
+ * tidak dikenal dilewati, jadi versi baru bisa menambah section tanpa
+ * merusak loader lama; perubahan layout record wajib menaikkan versi.
+ *
+ * FORMAT TEKS:
+ * -----------
+ * Satu elemen per baris, '#' sampai akhir baris adalah komentar:
+ *
+ *     wall     x1 z1 x2 z2 y height thickness
+ *     rooftop  x1 z1 x2 z2 y thickness
+ *     stairs   startX startZ width stepDepth stepHeight numSteps baseY
+ *     fence    startX startZ endX endZ height thickness numPosts
+ *     doorway  x1 z1 x2 z2 baseY
+ *     scenery  type x y z rotationY scale castShadow
+ *
+ * type scenery: tree, pine, bush, rock, bench, lamppost, fountain, flowerbed
+ *
+ * FUNCTIONS:
+ * ---------
+ * loadLevel()        - Muat level biner (mmap) ke data peta global
+ * convertLevelText() - Konversi level teks ke biner
+ * getLevelScenery()  - Scenery authored dari level yang dimuat
+ *
+ * DEPENDENCIES:
+ * -----------
+ * - level.h     - Struct format file
+ * - map.h       - walls, rooftops, staircases, fences
+ * - collision.h - doorways
+ * - scenery.h   - SceneryObject
+ * - mappedfile.h - mapFile()/unmapFile()
+ *
+ * ==========================================================================
+ */
+
+#include "level.h"
+#include "map.h"
+#include "mappedfile.h"
+#include "collision.h"
+#include <cstring>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <iostream>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+// Layout record di file = layout struct di memori
+static_assert(sizeof(LevelFileHeader) == 16, "LevelFileHeader layout");
+static_assert(sizeof(LevelSectionEntry) == 16, "LevelSectionEntry layout");
+static_assert(sizeof(WallDefinition) == 7 * 4, "WallDefinition layout");
+static_assert(sizeof(Rooftop) == 6 * 4, "Rooftop layout");
+static_assert(sizeof(StaircaseDefinition) == 7 * 4, "StaircaseDefinition layout");
+static_assert(sizeof(FenceDefinition) == 7 * 4, "FenceDefinition layout");
+static_assert(sizeof(Doorway) == 5 * 4, "Doorway layout");
+static_assert(sizeof(LevelSceneryRecord) == 7 * 4, "LevelSceneryRecord layout");
+
+// Scenery authored dari level terakhir
+static std::vector<SceneryObject> levelScenery;
+static bool levelLoaded = false;
+
+// Nama tipe scenery di file teks (index = SceneryType)
+static const char* const SCENERY_TYPE_NAMES[] = {
+    "tree", "pine", "bush", "rock", "bench", "lamppost", "building", "fountain", "flowerbed"
+};
+static const int SCENERY_TYPE_COUNT = sizeof(SCENERY_TYPE_NAMES) / sizeof(SCENERY_TYPE_NAMES[0]);
+
+// Salin section ke vector jika ada; section yang tidak ada = vector kosong
+template <typename T>
+static void copySection(const MappedFile& mf, const LevelSectionEntry* section, std::vector<T>& out) {
+    out.clear();
+    if (section == nullptr || section->count == 0) return;
+    const T* records = reinterpret_cast<const T*>(mf.data + section->offset);
+    out.assign(records, records + section->count);
+}
+
+bool loadLevel(const char* path) {
+    MappedFile mf;
+    if (!mapFile(path, mf)) {
+        std::cerr << "Level: cannot open " << path << std::endl;
+        return false;
+    }
+
+    // 1. Validasi header dan tabel section sebelum mengubah data apapun
+    const LevelFileHeader* header = reinterpret_cast<const LevelFileHeader*>(mf.data);
+    if (mf.size < sizeof(LevelFileHeader) || std::memcmp(header->magic, LEVEL_MAGIC, 4) != 0) {
+        std::cerr << "Level: " << path << " is not a level file" << std::endl;
+        unmapFile(mf);
+        return false;
+    }
+    if (header->version != LEVEL_VERSION) {
+        std::cerr << "Level: " << path << " has version " << header->version
+                  << ", expected " << LEVEL_VERSION << " (convert it again)" << std::endl;
+        unmapFile(mf);
+        return false;
+    }
+    unsigned long long tableEnd = sizeof(LevelFileHeader)
+        + (unsigned long long)header->sectionCount * sizeof(LevelSectionEntry);
+    if (header->fileSize != mf.size || tableEnd > mf.size) {
+        std::cerr << "Level: " << path << " is truncated" << std::endl;
+        unmapFile(mf);
+        return false;
+    }
+
+    const LevelSectionEntry* table = reinterpret_cast<const LevelSectionEntry*>(mf.data + sizeof(LevelFileHeader));
+    const LevelSectionEntry* sections[LEVEL_SECTION_SCENERY + 1] = {nullptr};
+    static const uint32_t strides[LEVEL_SECTION_SCENERY + 1] = {
+        0, sizeof(WallDefinition), sizeof(Rooftop), sizeof(StaircaseDefinition),
+        sizeof(FenceDefinition), sizeof(Doorway), sizeof(LevelSceneryRecord)
+    };
+    for (uint32_t i = 0; i < header->sectionCount; i++) {
+        const LevelSectionEntry& entry = table[i];
+        unsigned long long end = entry.offset + (unsigned long long)entry.count * entry.stride;
+        if (entry.offset % LEVEL_SECTION_ALIGN != 0 || entry.offset < tableEnd || end > mf.size) {
+            std::cerr << "Level: " << path << " has a corrupt section table" << std::endl;
+            unmapFile(mf);
+            return false;
+        }
+        if (entry.type < LEVEL_SECTION_WALLS || entry.type > LEVEL_SECTION_SCENERY) {
+            continue;   // Section versi baru, dilewati
+        }
+        if (entry.stride != strides[entry.type]) {
+            std::cerr << "Level: " << path << " section " << entry.type
+                      << " has record size " << entry.stride << ", expected "
+                      << strides[entry.type] << std::endl;
+            unmapFile(mf);
+            return false;
+        }
+        sections[entry.type] = &entry;
+    }
+
+    // 2. Salin record langsung dari mapping
+    copySection(mf, sections[LEVEL_SECTION_WALLS], walls);
+    copySection(mf, sections[LEVEL_SECTION_ROOFTOPS], rooftops);
+    copySection(mf, sections[LEVEL_SECTION_STAIRCASES], staircases);
+    copySection(mf, sections[LEVEL_SECTION_FENCES], fences);
+    copySection(mf, sections[LEVEL_SECTION_DOORWAYS], doorways);
+
+    std::vector<LevelSceneryRecord> scenery;
+    copySection(mf, sections[LEVEL_SECTION_SCENERY], scenery);
+    levelScenery.clear();
+    for (const auto& record : scenery) {
+        if (record.type < 0 || record.type >= SCENERY_TYPE_COUNT) continue;
+        SceneryObject obj = {};
+        obj.position = {record.x, record.y, record.z};
+        obj.rotationY = record.rotationY;
+        obj.scale = record.scale;
+        obj.type = (SceneryType)record.type;
+        obj.castShadow = record.castShadow != 0;
+        levelScenery.push_back(obj);
+    }
+    levelLoaded = true;
+
+    unmapFile(mf);
+    std::cout << "Level: " << path << " (" << walls.size() << " walls, " << rooftops.size()
+              << " rooftops, " << staircases.size() << " staircases, " << fences.size()
+              << " fences, " << doorways.size() << " doorways, " << levelScenery.size()
+              << " scenery)" << std::endl;
+    return true;
+}
+
+bool getLevelScenery(std::vector<SceneryObject>& out) {
+    if (!levelLoaded) return false;
+    out.insert(out.end(), levelScenery.begin(), levelScenery.end());
+    return true;
+}
+
+// Baca semua angka di baris; false jika jumlahnya salah atau ada sisa teks
+static bool readFloats(std::istringstream& in, float* values, int count) {
+    for (int i = 0; i < count; i++) {
+        if (!(in >> values[i])) return false;
+    }
+    std::string rest;
+    return !(in >> rest);
+}
+
+// Tulis satu section: entry di tabel, data di offset rata 16 byte
+struct PendingSection {
+    uint32_t type;
+    uint32_t stride;
+    uint32_t count;
+    const void* data;
+};
+
+bool convertLevelText(const char* textPath, const char* binaryPath) {
+    std::ifstream in(textPath);
+    if (!in) {
+        std::cerr << "Level: cannot open " << textPath << std::endl;
+        return false;
+    }
+
+    std::vector<WallDefinition> textWalls;
+    std::vector<Rooftop> textRooftops;
+    std::vector<StaircaseDefinition> textStairs;
+    std::vector<FenceDefinition> textFences;
+    std::vector<Doorway> textDoorways;
+    std::vector<LevelSceneryRecord> textScenery;
+
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(in, line)) {
+        lineNumber++;
+        size_t comment = line.find('#');
+        if (comment != std::string::npos) line.erase(comment);
+
+        std::istringstream words(line);
+        std::string keyword;
+        if (!(words >> keyword)) continue;
+
+        float v[8];
+        bool ok = true;
+        if (keyword == "wall") {
+            ok = readFloats(words, v, 7);
+            if (ok) textWalls.push_back({v[0], v[1], v[2], v[3], v[4], v[5], v[6]});
+        } else if (keyword == "rooftop") {
+            ok = readFloats(words, v, 6);
+            if (ok) textRooftops.push_back({v[0], v[1], v[2], v[3], v[4], v[5]});
+        } else if (keyword == "stairs") {
+            ok = readFloats(words, v, 7);
+            if (ok) textStairs.push_back({v[0], v[1], v[2], v[3], v[4], (int)v[5], v[6]});
+        } else if (keyword == "fence") {
+            ok = readFloats(words, v, 7);
+            if (ok) textFences.push_back({v[0], v[1], v[2], v[3], v[4], v[5], (int)v[6]});
+        } else if (keyword == "doorway") {
+            ok = readFloats(words, v, 5);
+            if (ok) textDoorways.push_back({v[0], v[1], v[2], v[3], v[4]});
+        } else if (keyword == "scenery") {
+            std::string typeName;
+            int type = -1;
+            if (words >> typeName) {
+                for (int t = 0; t < SCENERY_TYPE_COUNT; t++) {
+                    if (typeName == SCENERY_TYPE_NAMES[t]) type = t;
+                }
+            }
+            ok = type >= 0 && readFloats(words, v, 6);
+            if (ok) {
+                LevelSceneryRecord record = {v[0], v[1], v[2], v[3], v[4], type, v[5] != 0.0f ? 1u : 0u};
+                textScenery.push_back(record);
+            }
+        } else {
+            std::cerr << textPath << ":" << lineNumber << ": unknown element '" << keyword << "'" << std::endl;
+            return false;
+        }
+        if (!ok) {
+            std::cerr << textPath << ":" << lineNumber << ": bad values for '" << keyword << "'" << std::endl;
+            return false;
+        }
+    }
+
+    PendingSection pending[] = {
+        {LEVEL_SECTION_WALLS, sizeof(WallDefinition), (uint32_t)textWalls.size(), textWalls.data()},
+        {LEVEL_SECTION_ROOFTOPS, sizeof(Rooftop), (uint32_t)textRooftops.size(), textRooftops.data()},
+        {LEVEL_SECTION_STAIRCASES, sizeof(StaircaseDefinition), (uint32_t)textStairs.size(), textStairs.data()},
+        {LEVEL_SECTION_FENCES, sizeof(FenceDefinition), (uint32_t)textFences.size(), textFences.data()},
+        {LEVEL_SECTION_DOORWAYS, sizeof(Doorway), (uint32_t)textDoorways.size(), textDoorways.data()},
+        {LEVEL_SECTION_SCENERY, sizeof(LevelSceneryRecord), (uint32_t)textScenery.size(), textScenery.data()}
+    };
+    const uint32_t sectionCount = sizeof(pending) / sizeof(pending[0]);
+
+    // Susun file di memori: header, tabel, lalu data tiap section
+    std::vector<LevelSectionEntry> table(sectionCount);
+    uint32_t offset = sizeof(LevelFileHeader) + sectionCount * sizeof(LevelSectionEntry);
+    for (uint32_t i = 0; i < sectionCount; i++) {
+        offset = (offset + LEVEL_SECTION_ALIGN - 1) / LEVEL_SECTION_ALIGN * LEVEL_SECTION_ALIGN;
+        table[i].type = pending[i].type;
+        table[i].offset = offset;
+        table[i].count = pending[i].count;
+        table[i].stride = pending[i].stride;
+        offset += pending[i].count * pending[i].stride;
+    }
+
+    std::vector<unsigned char> file(offset, 0);
+    LevelFileHeader header;
+    std::memcpy(header.magic, LEVEL_MAGIC, 4);
+    header.version = LEVEL_VERSION;
+    header.fileSize = offset;
+    header.sectionCount = sectionCount;
+    std::memcpy(file.data(), &header, sizeof(header));
+    std::memcpy(file.data() + sizeof(header), table.data(), sectionCount * sizeof(LevelSectionEntry));
+    for (uint32_t i = 0; i < sectionCount; i++) {
+        if (pending[i].count > 0) {
+            std::memcpy(file.data() + table[i].offset, pending[i].data, pending[i].count * pending[i].stride);
+        }
+    }
+
+    // Tulis ke file sementara lalu rename, supaya game yang memantau file
+    // (hot-reload) tidak pernah melihat file setengah jadi
+    std::string tempPath = std::string(binaryPath) + ".tmp";
+    {
+        std::ofstream out(tempPath.c_str(), std::ios::binary);
+        if (!out || !out.write((const char*)file.data(), file.size())) {
+            std::cerr << "Level: cannot write " << tempPath << std::endl;
+            return false;
+        }
+    }
+#ifdef _WIN32
+    bool renamed = MoveFileExA(tempPath.c_str(), binaryPath, MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+    bool renamed = std::rename(tempPath.c_str(), binaryPath) == 0;
+#endif
+    if (!renamed) {
+        std::cerr << "Level: cannot replace " << binaryPath << std::endl;
+        std::remove(tempPath.c_str());
+        return false;
+    }
+    std::cout << "Level: " << textPath << " -> " << binaryPath << " (" << file.size() << " bytes)" << std::endl;
+    return true;
+}
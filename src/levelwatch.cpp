@@ -0,0 +1,244 @@
+/*
+ * ==========================================================================
+ * LEVEL HOT-RELOAD
+ * ==========================================================================
+ *
+ * File: levelwatch.cpp
+ * Author: Project Team
+ * Date: June 2025
+ *
+ * DESCRIPTION:
+ * -----------
+ * Memantau file level biner dan memuatnya ulang saat berubah, tanpa
+ * restart dan tanpa menjalankan ulang loadTexture()/initScenery().
+ *
+ * Alur satu reload:
+ * 1. Salin walls, rooftops, staircases, fences dan doorways lama.
+ * 2. loadLevel() mengganti isinya dari file (gagal = data lama tetap).
+ * 3. Diff lama vs baru per tipe (multiset record, dibandingkan per byte).
+ *    Setiap record yang ditambah atau dihapus menghasilkan kotak kotor
+ *    seluas footprint-nya ditambah jangkauan agen navigasi.
+ * 4. Hanya region grid navigasi di kotak kotor yang dihitung ulang
+ *    (navRebuildArea), path yang melewatinya dibuang dan flow field
+ *    dibangun ulang di background buffer.
+ * 5. Titik spawn musuh dibangun ulang saat spawn berikutnya dan scenery
+ *    authored diganti dari level baru.
+ * 6. Display list peta dibuang (invalidateMapMesh) dan di-bake ulang saat
+ *    frame berikutnya. Chunk dunia tidak bergantung pada data level.
+ *
+ * Converter menulis file sementara lalu rename, jadi event yang dipantau
+ * adalah IN_CLOSE_WRITE/IN_MOVED_TO pada nama file level.
+ *
+ * FUNCTIONS:
+ * ---------
+ * initLevelWatcher() - Mulai memantau direktori file level
+ * pollLevelWatcher() - Cek event (non-blocking) dan reload jika perlu
+ * reloadLevel()      - Reload + update inkremental
+ *
+ * DEPENDENCIES:
+ * -----------
+ * - level.h      - loadLevel(), getLevelScenery()
+ * - map.h        - Data level (walls, rooftops, staircases, fences), invalidateMapMesh()
+ * - collision.h  - doorways
+ * - navigation.h - navRebuildArea()
+ * - enemy.h      - invalidateEnemySpawnPoints()
+ *
+ * ==========================================================================
+ */
+
+#include "levelwatch.h"
+#include "level.h"
+#include "map.h"
+#include "collision.h"
+#include "navigation.h"
+#include "enemy.h"
+#include "scenery.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+LevelReloadStats levelReloadStats = {0, 0, 0, 0.0f};
+
+// Jangkauan perubahan di sekitar footprint: radius agen + satu sel + margin
+static const float LEVEL_DIRTY_MARGIN = 1.5f;
+
+static std::string watchedPath;
+static std::string watchedName;     // Nama file tanpa direktori
+
+#ifdef _WIN32
+static HANDLE watchHandle = INVALID_HANDLE_VALUE;
+static FILETIME watchedWriteTime;
+
+static bool readWriteTime(FILETIME& out) {
+    WIN32_FILE_ATTRIBUTE_DATA data;
+    if (!GetFileAttributesExA(watchedPath.c_str(), GetFileExInfoStandard, &data)) return false;
+    out = data.ftLastWriteTime;
+    return true;
+}
+#else
+static int watchFd = -1;
+#endif
+
+// Kotak XZ yang berubah
+struct DirtyRect {
+    float minX, minZ, maxX, maxZ;
+};
+
+static void addDirty(std::vector<DirtyRect>& dirty, float x1, float z1, float x2, float z2, float pad) {
+    DirtyRect rect = {
+        std::min(x1, x2) - pad - LEVEL_DIRTY_MARGIN, std::min(z1, z2) - pad - LEVEL_DIRTY_MARGIN,
+        std::max(x1, x2) + pad + LEVEL_DIRTY_MARGIN, std::max(z1, z2) + pad + LEVEL_DIRTY_MARGIN
+    };
+    dirty.push_back(rect);
+}
+
+// Record yang ada di salah satu sisi saja (multiset, dibandingkan per byte).
+// Struct level berisi float/int tanpa padding, jadi memcmp aman.
+template <typename T>
+static int diffRecords(std::vector<T> before, std::vector<T> after,
+                       const std::function<void(const T&)>& changed) {
+    auto less = [](const T& a, const T& b) { return std::memcmp(&a, &b, sizeof(T)) < 0; };
+    std::sort(before.begin(), before.end(), less);
+    std::sort(after.begin(), after.end(), less);
+    std::vector<T> diff;
+    std::set_symmetric_difference(before.begin(), before.end(), after.begin(), after.end(),
+                                  std::back_inserter(diff), less);
+    for (const auto& record : diff) {
+        changed(record);
+    }
+    return (int)diff.size();
+}
+
+bool reloadLevel(const char* path) {
+    auto start = std::chrono::steady_clock::now();
+
+    std::vector<WallDefinition> oldWalls = walls;
+    std::vector<Rooftop> oldRooftops = rooftops;
+    std::vector<StaircaseDefinition> oldStairs = staircases;
+    std::vector<FenceDefinition> oldFences = fences;
+    std::vector<Doorway> oldDoorways = doorways;
+
+    if (!loadLevel(path)) {
+        std::cerr << "Level reload failed, keeping current level" << std::endl;
+        return false;
+    }
+
+    std::vector<DirtyRect> dirty;
+    int changed = 0;
+    changed += diffRecords<WallDefinition>(oldWalls, walls, [&](const WallDefinition& w) {
+        addDirty(dirty, w.x1, w.z1, w.x2, w.z2, w.thickness / 2.0f);
+    });
+    changed += diffRecords<FenceDefinition>(oldFences, fences, [&](const FenceDefinition& f) {
+        addDirty(dirty, f.startX, f.startZ, f.endX, f.endZ, f.thickness / 2.0f);
+    });
+    changed += diffRecords<Rooftop>(oldRooftops, rooftops, [&](const Rooftop& r) {
+        addDirty(dirty, r.x1, r.z1, r.x2, r.z2, 0.1f);
+    });
+    changed += diffRecords<StaircaseDefinition>(oldStairs, staircases, [&](const StaircaseDefinition& s) {
+        // Sama dengan area tangga + landing yang diblokir navigasi
+        float endZ = s.startZ + s.stepDepth * s.numSteps;
+        addDirty(dirty, s.startX - 0.5f, s.startZ - 0.2f, s.startX + s.width, endZ + 2.5f, 0.0f);
+    });
+    changed += diffRecords<Doorway>(oldDoorways, doorways, [&](const Doorway& d) {
+        addDirty(dirty, d.x1, d.z1, d.x2, d.z2, 0.0f);
+    });
+
+    int regions = 0;
+    for (const auto& rect : dirty) {
+        regions += navRebuildArea(rect.minX, rect.minZ, rect.maxX, rect.maxZ);
+    }
+    if (!dirty.empty()) {
+        invalidateEnemySpawnPoints();
+    }
+
+    // Scenery authored hanya berisi data dari level (lihat initScenery)
+    sceneryObjects.clear();
+    getLevelScenery(sceneryObjects);
+
+    if (changed > 0) {
+        invalidateMapMesh();
+    }
+
+    float ms = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+    levelReloadStats.reloads++;
+    levelReloadStats.changedRecords = changed;
+    levelReloadStats.navRegions = regions;
+    levelReloadStats.milliseconds = ms;
+    std::cout << "Level reloaded in " << ms << " ms (" << changed << " records changed, "
+              << regions << " nav regions rebuilt)" << std::endl;
+    return true;
+}
+
+void initLevelWatcher(const char* path) {
+    watchedPath = path;
+    size_t slash = watchedPath.find_last_of("/\\");
+    std::string dir = slash == std::string::npos ? "." : watchedPath.substr(0, slash);
+    watchedName = slash == std::string::npos ? watchedPath : watchedPath.substr(slash + 1);
+
+#ifdef _WIN32
+    if (watchHandle != INVALID_HANDLE_VALUE) FindCloseChangeNotification(watchHandle);
+    watchHandle = FindFirstChangeNotificationA(dir.c_str(), FALSE,
+                                               FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_FILE_NAME);
+    if (watchHandle == INVALID_HANDLE_VALUE || !readWriteTime(watchedWriteTime)) {
+        std::cerr << "Level watcher: cannot watch " << dir << std::endl;
+        return;
+    }
+#else
+    if (watchFd >= 0) close(watchFd);
+    watchFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (watchFd < 0 || inotify_add_watch(watchFd, dir.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO) < 0) {
+        std::cerr << "Level watcher: cannot watch " << dir << std::endl;
+        if (watchFd >= 0) close(watchFd);
+        watchFd = -1;
+        return;
+    }
+#endif
+    std::cout << "Watching " << watchedPath << " for changes" << std::endl;
+}
+
+void pollLevelWatcher() {
+    bool changed = false;
+
+#ifdef _WIN32
+    if (watchHandle == INVALID_HANDLE_VALUE) return;
+    if (WaitForSingleObject(watchHandle, 0) != WAIT_OBJECT_0) return;
+    FindNextChangeNotification(watchHandle);
+    // Notifikasi berlaku untuk seluruh direktori: cek waktu tulis file level
+    FILETIME writeTime;
+    if (readWriteTime(writeTime) && CompareFileTime(&writeTime, &watchedWriteTime) != 0) {
+        watchedWriteTime = writeTime;
+        changed = true;
+    }
+#else
+    if (watchFd < 0) return;
+    // Kumpulkan semua event yang tertunda; beberapa event = satu reload
+    alignas(struct inotify_event) char buffer[4096];
+    for (;;) {
+        ssize_t length = read(watchFd, buffer, sizeof(buffer));
+        if (length <= 0) break;     // EAGAIN: tidak ada event lagi
+        for (char* p = buffer; p < buffer + length; ) {
+            const struct inotify_event* event = (const struct inotify_event*)p;
+            if (event->len > 0 && watchedName == event->name) {
+                changed = true;
+            }
+            p += sizeof(struct inotify_event) + event->len;
+        }
+    }
+#endif
+
+    if (changed) {
+        reloadLevel(watchedPath.c_str());
+    }
+}
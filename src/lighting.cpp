@@ -14,6 +14,8 @@
  * - Pengaturan material untuk objek di scene
  * - Posisi dan arah pencahayaan
  * - Konfigurasi pencahayaan model dan bayangan
+ * - Lighting per-pixel dengan shader GLSL (shader.cpp) jika driver
+ *   mendukung; GL_LIGHT0 fixed-function sebagai fallback
  * 
  * LIGHTING PARAMETERS:  
  * ------------------
@@ -21,10 +23,10 @@
  * light_diffuse[]  - Nilai warna untuk cahaya diffuse (menyebar)
  * light_specular[] - Nilai warna untuk cahaya specular (kilau)
  * light_position[] - Posisi sumber cahaya (directional light)
+ * model_ambient[]  - Ambient global (default OpenGL)
  * mat_ambient[]    - Nilai untuk ambient material
  * mat_diffuse[]    - Nilai untuk diffuse material
- * mat_specular[]   - Nilai untuk specular material
- * high_shininess[] - Nilai shininess untuk material (kilau)
+ * DEFAULT_SPECULAR, DEFAULT_SHININESS (lighting.h) - Specular material default
  * 
  * FUNCTIONS:
  * ---------
@@ -34,53 +36,71 @@
  * DEPENDENCIES:
  * -----------
  * - lighting.h - Header file dengan deklarasi fungsi pencahayaan
+ * - shader.h   - Program lighting per-pixel
  * - GL/glut.h  - Library OpenGL untuk fungsi pencahayaan
  * 
  * HOW TO USE:
  * ----------
  * 1. Panggil initLighting() setelah inisialisasi OpenGL dan sebelum rendering
- * 2. Untuk menonaktifkan pencahayaan sementara, gunakan glDisable(GL_LIGHTING)
- * 3. Untuk mengaktifkannya kembali, gunakan glEnable(GL_LIGHTING)
- * 4. Pengaturan material dapat dimodifikasi per-objek dengan fungsi glMaterialfv()
+ * 2. Untuk menonaktifkan pencahayaan sementara, gunakan glsDisable(GL_LIGHTING)
+ * 3. Untuk mengaktifkannya kembali, gunakan glsEnable(GL_LIGHTING)
+ * 4. Material specular dapat dimodifikasi per-objek dengan glsMaterial()
  * 
  * NOTES:
  * -----
  * - Pencahayaan yang digunakan adalah directional light (GL_LIGHT0)
  * - Sistem pencahayaan mendukung two-sided lighting dan local viewer model
  * - Normalisasi vektor normal diaktifkan untuk pencahayaan yang akurat
+ * - Jalur shader: matahari dari SUN_DIRECTION (searah shadow map), bukan
+ *   light_position yang relatif terhadap kamera; ambient = light_ambient
+ *   + model_ambient (sama dengan hasil GL_COLOR_MATERIAL fixed-function)
  * 
  * ==========================================================================
  */
 
 #include "lighting.h"
+#include "glstate.h"
+#include "shader.h"
+#include <cmath>
 
 // Lighting parameters
 const GLfloat light_ambient[] = {0.6f, 0.6f, 0.6f, 1.0f};    // Reduced ambient light
 const GLfloat light_diffuse[] = {0.8f, 0.8f, 0.8f, 1.0f};    // Reduced diffuse light
 const GLfloat light_specular[] = {0.5f, 0.5f, 0.5f, 1.0f};   // Reduced specular light
 const GLfloat light_position[] = {0.0f, 10.0f, 0.0f, 0.0f}; // Directional light
+const GLfloat model_ambient[] = {0.2f, 0.2f, 0.2f, 1.0f};
 const GLfloat mat_ambient[] = {0.7f, 0.7f, 0.7f, 1.0f};
 const GLfloat mat_diffuse[] = {0.8f, 0.8f, 0.8f, 1.0f};
-const GLfloat mat_specular[] = {1.0f, 1.0f, 1.0f, 1.0f};
-const GLfloat high_shininess[] = {100.0f};
     
 void initLighting() 
 {  
-    glEnable(GL_DEPTH_TEST);
+    glsEnable(GL_DEPTH_TEST);
     glDepthFunc(GL_LESS);
-    glEnable(GL_LIGHT0); 
-    glEnable(GL_NORMALIZE);
-    glEnable(GL_COLOR_MATERIAL);
-    glEnable(GL_LIGHTING);
+    glsEnable(GL_LIGHT0); 
+    glsEnable(GL_NORMALIZE);
+    glsEnable(GL_COLOR_MATERIAL);
+    glsEnable(GL_LIGHTING);
     glLightfv(GL_LIGHT0, GL_AMBIENT, light_ambient);
     glLightfv(GL_LIGHT0, GL_DIFFUSE, light_diffuse);
     glLightfv(GL_LIGHT0, GL_SPECULAR, light_specular);
     glLightfv(GL_LIGHT0, GL_POSITION, light_position);
     glMaterialfv(GL_FRONT, GL_AMBIENT, mat_ambient);
     glMaterialfv(GL_FRONT, GL_DIFFUSE, mat_diffuse);
-    glMaterialfv(GL_FRONT, GL_SPECULAR, mat_specular);
-    glMaterialfv(GL_FRONT, GL_SHININESS, high_shininess);
+    glsMaterial(DEFAULT_SPECULAR, DEFAULT_SHININESS);
 
-    glEnable(GL_LIGHT_MODEL_LOCAL_VIEWER);
+    glLightModelfv(GL_LIGHT_MODEL_AMBIENT, model_ambient);
+    glLightModeli(GL_LIGHT_MODEL_LOCAL_VIEWER, GL_TRUE);
     glLightModeli(GL_LIGHT_MODEL_TWO_SIDE, GL_TRUE);
+
+    // Scene memakai program per-pixel jika tersedia; fixed-function di atas
+    // tetap dipakai HUD dan sebagai fallback
+    if (initShaders()) {
+        GLfloat ambient[4];
+        for (int i = 0; i < 4; i++) ambient[i] = light_ambient[i] + model_ambient[i];
+        ambient[3] = 1.0f;
+        GLfloat length = std::sqrt(SUN_DIRECTION[0] * SUN_DIRECTION[0] + SUN_DIRECTION[1] * SUN_DIRECTION[1]
+                                   + SUN_DIRECTION[2] * SUN_DIRECTION[2]);
+        GLfloat direction[3] = {SUN_DIRECTION[0] / length, SUN_DIRECTION[1] / length, SUN_DIRECTION[2] / length};
+        setShaderLight(direction, ambient, light_diffuse, light_specular);
+    }
 }  
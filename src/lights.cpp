@@ -0,0 +1,381 @@
+/*
+ * ==========================================================================
+ * CLUSTERED POINT LIGHTS
+ * ==========================================================================
+ *
+ * File: lights.cpp
+ * Author: Project Team
+ * Date: June 2025
+ *
+ * DESCRIPTION:
+ * -----------
+ * Cahaya titik untuk lighting shader (shader.cpp), tanpa batas 8 cahaya
+ * fixed-function:
+ * - Lampu jalan (SCENERY_LAMPPOST) menyala di bola lampunya.
+ * - Setiap peluru yang terbang membawa cahaya tracer kecil.
+ * - Cahaya sesaat (muzzle flash, impact) dari spawnTransientLight().
+ *
+ * Setiap frame buildLightClusters() membagi frustum kamera menjadi grid
+ * froxel CLUSTER_TILES_X x CLUSTER_TILES_Y tile layar x CLUSTER_SLICES
+ * slice kedalaman. Slice 0 = [0, SLICE_NEAR], slice lain logaritmik
+ * sampai SLICE_FAR (= jangkauan cahaya), jadi froxel dekat kamera kecil
+ * dan yang jauh besar. Setiap cahaya dimasukkan ke semua froxel yang
+ * disentuh kotak pembatas bolanya (view space, diproyeksikan ke tile).
+ * Hasilnya di-upload ke tiga tekstur float:
+ * - unit 2: data cahaya (posisi view space + radius, warna)
+ * - unit 3: per froxel offset dan jumlah index
+ * - unit 4: daftar index cahaya, berurutan per froxel
+ * Fragment shader hanya mengulang cahaya di froxel-nya sendiri, jadi
+ * biaya per pixel tetap kecil walaupun ada ratusan cahaya di scene.
+ *
+ * Cahaya titik tidak memberi bayangan dan tidak ada di jalur
+ * fixed-function (--glsl 0) atau jika tekstur float tidak didukung.
+ *
+ * FUNCTIONS:
+ * ---------
+ * initLights()          - Cek extension dan buat tekstur grid
+ * spawnTransientLight() - Cahaya sesaat yang memudar
+ * updateLights()        - Umur cahaya sesaat
+ * buildLightClusters()  - Kumpulkan, bin dan upload cahaya frame ini
+ *
+ * DEPENDENCIES:
+ * -----------
+ * - lights.h   - Deklarasi dan batas cahaya
+ * - shader.h   - setShaderClusters, getGLProcAddress
+ * - scenery.h  - Lampu jalan authored
+ * - combat.h   - Peluru
+ * - camera.h   - Posisi kamera
+ * - frustum.h  - Culling cahaya
+ *
+ * ==========================================================================
+ */
+
+#include "lights.h"
+#include "shader.h"
+#include "scenery.h"
+#include "combat.h"
+#include "camera.h"
+#include "frustum.h"
+#include <GL/glut.h>
+#include <GL/glext.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+LightStats lightStats = {0, 0, 0, 0.0f};
+
+// Grid froxel
+static const int CLUSTER_TILES_X = 16;
+static const int CLUSTER_TILES_Y = 9;
+static const int CLUSTER_SLICES = 24;
+static const int CLUSTER_COLUMNS = CLUSTER_TILES_X * CLUSTER_TILES_Y;
+static const int CLUSTER_COUNT = CLUSTER_COLUMNS * CLUSTER_SLICES;
+static const float SLICE_NEAR = 1.0f;
+static const float SLICE_FAR = 120.0f;      // Cahaya lebih jauh dari ini tidak dipakai
+static const float CAMERA_NEAR = 0.1f;      // Sama dengan gluPerspective di camera.cpp
+
+// Ukuran tekstur (pangkat dua, tidak butuh NPOT)
+static const int CLUSTER_TEXTURE_WIDTH = 256;
+static const int CLUSTER_TEXTURE_HEIGHT = 32;
+static const int INDEX_TEXTURE_WIDTH = 1024;
+static const int INDEX_TEXTURE_HEIGHT = 64;
+static const int MAX_LIGHT_INDICES = INDEX_TEXTURE_WIDTH * INDEX_TEXTURE_HEIGHT;
+
+// Lampu jalan: cahaya di bola lampu (tinggi tiang 3.0 x scale)
+static const float LAMP_HEIGHT = 3.0f;
+static const float LAMP_RADIUS = 10.0f;
+static const float LAMP_COLOR[3] = {1.2f, 1.0f, 0.65f};
+// Tracer peluru
+static const float TRACER_RADIUS = 4.0f;
+static const float TRACER_COLOR[3] = {1.0f, 0.75f, 0.3f};
+
+struct PointLight {
+    float x, y, z;              // View space
+    float radius;
+    float r, g, b;
+};
+
+struct TransientLight {
+    float x, y, z;              // Koordinat dunia
+    float radius;
+    float r, g, b;
+    float duration, age;
+};
+
+static PFNGLACTIVETEXTUREARBPROC activeTexture = nullptr;
+static bool enabled = false;
+static GLuint textures[3] = {0, 0, 0};     // Data cahaya, cluster, index (unit 2, 3, 4)
+
+static std::vector<TransientLight> transientLights;
+static std::vector<PointLight> frameLights;
+static std::vector<GLfloat> lightTexels;       // Baris 0 lalu baris 1, lebar = jumlah cahaya
+static std::vector<GLfloat> clusterTexels;     // Luminance = offset, alpha = jumlah
+static std::vector<int> clusterCounts;
+static std::vector<GLfloat> indexTexels;
+
+// Matriks kamera frame ini (column-major)
+static GLfloat viewMatrix[16];
+static GLfloat projectionMatrix[16];
+
+bool initLights() {
+    if (!shadersEnabled()) return false;
+
+    const char* extensions = (const char*)glGetString(GL_EXTENSIONS);
+    GLint units = 0;
+    glGetIntegerv(GL_MAX_TEXTURE_IMAGE_UNITS_ARB, &units);
+    if (extensions == nullptr || units < 5 || !std::strstr(extensions, "GL_ARB_texture_float")) {
+        std::cout << "Point lights: float textures not supported, sun only" << std::endl;
+        return false;
+    }
+    activeTexture = (PFNGLACTIVETEXTUREARBPROC)getGLProcAddress("glActiveTextureARB");
+    if (activeTexture == nullptr) return false;
+
+    static const GLint formats[3] = {GL_RGBA32F_ARB, GL_LUMINANCE_ALPHA32F_ARB, GL_LUMINANCE32F_ARB};
+    static const GLenum layouts[3] = {GL_RGBA, GL_LUMINANCE_ALPHA, GL_LUMINANCE};
+    static const int widths[3] = {MAX_POINT_LIGHTS, CLUSTER_TEXTURE_WIDTH, INDEX_TEXTURE_WIDTH};
+    static const int heights[3] = {2, CLUSTER_TEXTURE_HEIGHT, INDEX_TEXTURE_HEIGHT};
+    glGenTextures(3, textures);
+    // Unit 2..4 hanya dipakai tekstur ini, jadi bind-nya tetap selamanya
+    for (int i = 0; i < 3; i++) {
+        activeTexture(GL_TEXTURE2_ARB + i);
+        glBindTexture(GL_TEXTURE_2D, textures[i]);
+        glTexImage2D(GL_TEXTURE_2D, 0, formats[i], widths[i], heights[i], 0, layouts[i], GL_FLOAT, nullptr);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    }
+    activeTexture(GL_TEXTURE0_ARB);
+
+    frameLights.reserve(MAX_POINT_LIGHTS);
+    clusterTexels.resize(CLUSTER_COUNT * 2);
+    clusterCounts.resize(CLUSTER_COUNT);
+    enabled = true;
+    std::cout << "Point lights: " << CLUSTER_TILES_X << "x" << CLUSTER_TILES_Y << "x" << CLUSTER_SLICES
+              << " clusters, up to " << MAX_POINT_LIGHTS << " lights" << std::endl;
+    return true;
+}
+
+void spawnTransientLight(float x, float y, float z, float radius,
+                         float r, float g, float b, float duration) {
+    if (!enabled || duration <= 0.0f) return;
+    TransientLight light = {x, y, z, radius, r, g, b, duration, 0.0f};
+    transientLights.push_back(light);
+}
+
+void updateLights(float deltaTime) {
+    for (auto& light : transientLights) light.age += deltaTime;
+    transientLights.erase(
+        std::remove_if(transientLights.begin(), transientLights.end(),
+            [](const TransientLight& light) { return light.age >= light.duration; }),
+        transientLights.end());
+}
+
+// Cull dan ubah ke view space; cahaya setelah MAX_POINT_LIGHTS dibuang
+static void addLight(float x, float y, float z, float radius, float r, float g, float b) {
+    if ((int)frameLights.size() >= MAX_POINT_LIGHTS) return;
+    float dx = x - cameraX, dy = y - cameraY, dz = z - cameraZ;
+    float reach = SLICE_FAR + radius;
+    if (dx * dx + dy * dy + dz * dz > reach * reach) return;
+    if (!frustumBoxVisible(x - radius, y - radius, z - radius, x + radius, y + radius, z + radius)) return;
+
+    const GLfloat* m = viewMatrix;
+    PointLight light;
+    light.x = m[0] * x + m[4] * y + m[8] * z + m[12];
+    light.y = m[1] * x + m[5] * y + m[9] * z + m[13];
+    light.z = m[2] * x + m[6] * y + m[10] * z + m[14];
+    light.radius = radius;
+    light.r = r;
+    light.g = g;
+    light.b = b;
+    frameLights.push_back(light);
+}
+
+static void gatherLights() {
+    frameLights.clear();
+    for (const auto& obj : sceneryObjects) {
+        if (obj.type != SCENERY_LAMPPOST) continue;
+        addLight(obj.position.x, obj.position.y + LAMP_HEIGHT * obj.scale, obj.position.z,
+                 LAMP_RADIUS * obj.scale, LAMP_COLOR[0], LAMP_COLOR[1], LAMP_COLOR[2]);
+    }
+    for (const auto& bullet : bullets) {
+        if (!bullet.active) continue;
+        addLight(bullet.position.x, bullet.position.y, bullet.position.z,
+                 TRACER_RADIUS, TRACER_COLOR[0], TRACER_COLOR[1], TRACER_COLOR[2]);
+    }
+    for (const auto& light : transientLights) {
+        float fade = 1.0f - light.age / light.duration;
+        addLight(light.x, light.y, light.z, light.radius, light.r * fade, light.g * fade, light.b * fade);
+    }
+}
+
+// Slice untuk jarak view space; rumus yang sama dipakai fragment shader
+static int sliceForDepth(float depth, float sliceScale) {
+    if (depth <= SLICE_NEAR) return 0;
+    int slice = (int)std::floor(std::log(depth / SLICE_NEAR) * sliceScale) + 1;
+    return std::min(slice, CLUSTER_SLICES - 1);
+}
+
+// NDC [-1, 1] ke index tile
+static int tileForNdc(float ndc, int tiles) {
+    int tile = (int)std::floor((ndc * 0.5f + 0.5f) * tiles);
+    return std::max(0, std::min(tile, tiles - 1));
+}
+
+struct ClusterRange {
+    int x0, x1, y0, y1, z0, z1;
+};
+
+// Froxel yang disentuh bola cahaya; false = di luar grid
+static bool lightClusterRange(const PointLight& light, float sliceScale, ClusterRange& range) {
+    float depthMin = -light.z - light.radius;
+    float depthMax = -light.z + light.radius;
+    if (depthMax <= 0.0f || depthMin >= SLICE_FAR) return false;
+    range.z0 = sliceForDepth(depthMin, sliceScale);
+    range.z1 = sliceForDepth(depthMax, sliceScale);
+
+    // Bola memotong near plane: bisa menutupi seluruh layar
+    if (depthMin <= CAMERA_NEAR) {
+        range.x0 = 0;
+        range.x1 = CLUSTER_TILES_X - 1;
+        range.y0 = 0;
+        range.y1 = CLUSTER_TILES_Y - 1;
+        return true;
+    }
+
+    // x / d monoton di kotak dengan d > 0: ekstrem ada di sudut kotak
+    const GLfloat* p = projectionMatrix;
+    float minX = 1e9f, maxX = -1e9f, minY = 1e9f, maxY = -1e9f;
+    for (int i = 0; i < 4; i++) {
+        float depth = (i & 1) ? depthMax : depthMin;
+        float side = (i & 2) ? light.radius : -light.radius;
+        // clip = P x (x, y, -depth, 1), w = depth
+        float ndcX = (p[0] * (light.x + side) - p[8] * depth + p[12]) / depth;
+        float ndcY = (p[5] * (light.y + side) - p[9] * depth + p[13]) / depth;
+        minX = std::min(minX, ndcX);
+        maxX = std::max(maxX, ndcX);
+        minY = std::min(minY, ndcY);
+        maxY = std::max(maxY, ndcY);
+    }
+    if (maxX < -1.0f || minX > 1.0f || maxY < -1.0f || minY > 1.0f) return false;
+    range.x0 = tileForNdc(minX, CLUSTER_TILES_X);
+    range.x1 = tileForNdc(maxX, CLUSTER_TILES_X);
+    range.y0 = tileForNdc(minY, CLUSTER_TILES_Y);
+    range.y1 = tileForNdc(maxY, CLUSTER_TILES_Y);
+    return true;
+}
+
+// Upload sub-image ke tekstur di unit 2 + slot
+static void uploadTexture(int slot, int width, int height, GLenum layout, const GLfloat* data) {
+    activeTexture(GL_TEXTURE2_ARB + slot);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, layout, GL_FLOAT, data);
+    activeTexture(GL_TEXTURE0_ARB);
+}
+
+void buildLightClusters() {
+    if (!enabled) return;
+    auto start = std::chrono::steady_clock::now();
+
+    glGetFloatv(GL_MODELVIEW_MATRIX, viewMatrix);
+    glGetFloatv(GL_PROJECTION_MATRIX, projectionMatrix);
+    GLint viewport[4];
+    glGetIntegerv(GL_VIEWPORT, viewport);
+
+    gatherLights();
+    int lightCount = (int)frameLights.size();
+    lightStats.lights = lightCount;
+    if (lightCount == 0) {
+        lightStats.clusters = 0;
+        lightStats.indices = 0;
+        lightStats.buildMs = 0.0f;
+        setShaderClusters(nullptr);
+        return;
+    }
+
+    // Pass 1: jumlah cahaya per froxel
+    float sliceScale = (CLUSTER_SLICES - 1) / std::log(SLICE_FAR / SLICE_NEAR);
+    static std::vector<ClusterRange> ranges;
+    static std::vector<char> inside;
+    ranges.resize(lightCount);
+    inside.resize(lightCount);
+    std::fill(clusterCounts.begin(), clusterCounts.end(), 0);
+    for (int i = 0; i < lightCount; i++) {
+        inside[i] = lightClusterRange(frameLights[i], sliceScale, ranges[i]);
+        if (!inside[i]) continue;
+        const ClusterRange& r = ranges[i];
+        for (int z = r.z0; z <= r.z1; z++)
+            for (int y = r.y0; y <= r.y1; y++)
+                for (int x = r.x0; x <= r.x1; x++)
+                    clusterCounts[z * CLUSTER_COLUMNS + y * CLUSTER_TILES_X + x]++;
+    }
+
+    // Offset (prefix sum), dibatasi per froxel dan total kapasitas index
+    int total = 0, usedClusters = 0;
+    for (int c = 0; c < CLUSTER_COUNT; c++) {
+        int count = std::min(clusterCounts[c], MAX_CLUSTER_LIGHTS);
+        count = std::min(count, MAX_LIGHT_INDICES - total);
+        clusterTexels[c * 2] = (GLfloat)total;
+        clusterTexels[c * 2 + 1] = (GLfloat)count;
+        clusterCounts[c] = 0;                   // Dipakai ulang sebagai posisi tulis
+        total += count;
+        if (count > 0) usedClusters++;
+    }
+
+    // Pass 2: tulis index cahaya
+    int rows = (total + INDEX_TEXTURE_WIDTH - 1) / INDEX_TEXTURE_WIDTH;
+    indexTexels.assign(std::max(rows, 1) * INDEX_TEXTURE_WIDTH, 0.0f);
+    for (int i = 0; i < lightCount; i++) {
+        if (!inside[i]) continue;
+        const ClusterRange& r = ranges[i];
+        for (int z = r.z0; z <= r.z1; z++)
+            for (int y = r.y0; y <= r.y1; y++)
+                for (int x = r.x0; x <= r.x1; x++) {
+                    int c = z * CLUSTER_COLUMNS + y * CLUSTER_TILES_X + x;
+                    if (clusterCounts[c] >= (int)clusterTexels[c * 2 + 1]) continue;
+                    indexTexels[(int)clusterTexels[c * 2] + clusterCounts[c]++] = (GLfloat)i;
+                }
+    }
+
+    lightTexels.resize(lightCount * 8);
+    for (int i = 0; i < lightCount; i++) {
+        const PointLight& light = frameLights[i];
+        GLfloat* position = &lightTexels[i * 4];
+        GLfloat* color = &lightTexels[(lightCount + i) * 4];
+        position[0] = light.x;
+        position[1] = light.y;
+        position[2] = light.z;
+        position[3] = light.radius;
+        color[0] = light.r;
+        color[1] = light.g;
+        color[2] = light.b;
+        color[3] = 0.0f;
+    }
+
+    uploadTexture(0, lightCount, 2, GL_RGBA, lightTexels.data());
+    uploadTexture(1, CLUSTER_COLUMNS, CLUSTER_SLICES, GL_LUMINANCE_ALPHA, clusterTexels.data());
+    uploadTexture(2, INDEX_TEXTURE_WIDTH, std::max(rows, 1), GL_LUMINANCE, indexTexels.data());
+
+    ShaderClusterGrid grid;
+    grid.tilesX = CLUSTER_TILES_X;
+    grid.tilesY = CLUSTER_TILES_Y;
+    grid.slices = CLUSTER_SLICES;
+    grid.viewportX = (float)viewport[0];
+    grid.viewportY = (float)viewport[1];
+    grid.tileWidth = (float)viewport[2] / CLUSTER_TILES_X;
+    grid.tileHeight = (float)viewport[3] / CLUSTER_TILES_Y;
+    grid.sliceNear = SLICE_NEAR;
+    grid.sliceFar = SLICE_FAR;
+    grid.lightTextureWidth = MAX_POINT_LIGHTS;
+    grid.clusterTextureWidth = CLUSTER_TEXTURE_WIDTH;
+    grid.clusterTextureHeight = CLUSTER_TEXTURE_HEIGHT;
+    grid.indexTextureWidth = INDEX_TEXTURE_WIDTH;
+    grid.indexTextureHeight = INDEX_TEXTURE_HEIGHT;
+    setShaderClusters(&grid);
+
+    lightStats.clusters = usedClusters;
+    lightStats.indices = total;
+    lightStats.buildMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
@@ -0,0 +1,430 @@
+/*
+ * ==========================================================================
+ * ASYNCHRONOUS STARTUP LOADER
+ * ==========================================================================
+ *
+ * File: loader.cpp
+ * Author: Project Team
+ * Date: June 2025
+ *
+ * DESCRIPTION:
+ * -----------
+ * Memindahkan pemuatan startup dari init() ke worker thread agar menu
+ * tampil pada frame pertama dan progress bar berjalan selama dunia dimuat.
+ *
+ * Startup disusun sebagai graph task. Setiap task menyebut task lain yang
+ * menjadi inputnya dan baru dijalankan setelah semua input selesai, jadi
+ * task yang tidak saling bergantung berjalan paralel dan waktu startup
+ * dibatasi rantai terpanjang (critical path), bukan jumlah semua task.
+ *
+ * Satu task punya dua bagian, masing-masing opsional:
+ * - cpu: dijalankan worker thread (baca file, decode, parse level, grid
+ *   navigasi, scenery, generate chunk).
+ * - gl:  dijalankan thread yang memiliki context GL (glTexImage2D, bake
+ *   display list, sistem yang menyentuh chunk dunia). updateAssetLoading()
+ *   menjalankannya maksimal LOADER_FRAME_BUDGET_MS per frame agar menu
+ *   tetap responsif.
+ *
+ * Graph startup:
+ *
+ *   grass
+ *   atlas ------------------------------------------------.
+ *   level --+----------------------------------------------+--> mapMesh
+ *           +--> levelWatcher
+ *           '--> worldCache --+--> navigation -----------------------.
+ *                             '--> scenery --> chunk x N --> world ---+--> enemies --> waves
+ *                                  atlas --'
+ *                    navigation, scenery, chunk x N --> worldCacheSave
+ *
+ * Bake chunk (drawRock, dll.) membaca UV atlas yang ditulis composeTextureAtlas
+ * di worker, jadi chunk juga menunggu atlas seperti mapMesh.
+ *
+ * worldCache (worldcache.cpp) yang cocok dengan seed dan level membuat
+ * scenery, navigation dan chunk hanya menyalin data dari cache.
+ *
+ * Task selesai saat bagian terakhirnya selesai; baru saat itu dependent-nya
+ * dikurangi hitungan inputnya dan yang sudah siap masuk antrian worker
+ * (punya bagian cpu) atau antrian GL.
+ *
+ * --startup-report mencetak waktu per task (digabung per nama untuk chunk)
+ * dan critical path: dari task yang selesai terakhir, mundur lewat input
+ * yang selesai paling akhir.
+ *
+ * FUNCTIONS:
+ * ---------
+ * startAssetLoading()    - Susun graph dan jalankan worker thread
+ * updateAssetLoading()   - Jalankan bagian GL yang siap (thread GL)
+ * assetsReady()          - Status selesai
+ * getAssetLoadProgress() - Progres untuk menu
+ *
+ * DEPENDENCIES:
+ * -----------
+ * - texture.h, atlas.h   - Decode/upload tekstur
+ * - object.h, render.h   - player, grassTexture
+ * - level.h, map.h       - Layout level atau layout bawaan, mesh peta
+ * - navigation.h         - Grid navigasi
+ * - scenery.h, world.h   - Scenery authored dan chunk awal
+ * - enemy.h, gamemanager.h, levelwatch.h - Inisialisasi akhir
+ * - worldcache.h         - Cache dunia hasil generate
+ * - options.h            - --level, --world-cache, --startup-report
+ *
+ * ==========================================================================
+ */
+
+#include "loader.h"
+#include "texture.h"
+#include "atlas.h"
+#include "object.h"
+#include "render.h"
+#include "level.h"
+#include "levelwatch.h"
+#include "map.h"
+#include "navigation.h"
+#include "scenery.h"
+#include "world.h"
+#include "enemy.h"
+#include "gamemanager.h"
+#include "worldcache.h"
+#include "options.h"
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Waktu maksimum pekerjaan GL per frame selama loading
+static const float LOADER_FRAME_BUDGET_MS = 8.0f;
+
+typedef std::function<void()> LoaderJob;
+
+// Satu node graph startup. Waktu dalam ms sejak startAssetLoading().
+struct StartupTask {
+    const char* name;
+    LoaderJob cpu;                  // Worker thread (boleh kosong)
+    LoaderJob gl;                   // Thread GL setelah cpu (boleh kosong)
+    std::vector<int> inputs;
+    std::vector<int> dependents;
+    int waiting;                    // Input yang belum selesai
+    float startMs, endMs;           // Mulai dijalankan, selesai
+    float cpuMs, glMs;              // Waktu kerja masing-masing bagian
+};
+
+static std::vector<StartupTask> startupTasks;
+static std::vector<std::thread> loaderThreads;
+static std::mutex loaderMutex;
+static std::condition_variable loaderCondition;
+static std::deque<int> cpuQueue;    // Index task, diambil worker thread
+static std::deque<int> glQueue;     // Index task, dijalankan thread GL
+static int finishedTasks = 0;
+
+static bool loadFinished = false;
+static bool levelFromFile = false;
+static bool firstFrameLogged = false;
+static std::chrono::steady_clock::time_point loadStart;
+
+static float millisecondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+static int addTask(const char* name, std::vector<int> inputs, LoaderJob cpu, LoaderJob gl) {
+    StartupTask task;
+    task.name = name;
+    task.cpu = std::move(cpu);
+    task.gl = std::move(gl);
+    task.inputs = std::move(inputs);
+    task.waiting = (int)task.inputs.size();
+    task.startMs = task.endMs = 0.0f;
+    task.cpuMs = task.glMs = 0.0f;
+    int index = (int)startupTasks.size();
+    for (int input : task.inputs) {
+        startupTasks[input].dependents.push_back(index);
+    }
+    startupTasks.push_back(std::move(task));
+    return index;
+}
+
+// Masukkan task yang semua inputnya selesai ke antrian yang sesuai.
+// Dipanggil dengan loaderMutex terkunci.
+static void queueReadyTask(int index) {
+    if (startupTasks[index].cpu) {
+        cpuQueue.push_back(index);
+        loaderCondition.notify_one();
+    } else {
+        glQueue.push_back(index);
+    }
+}
+
+// Tandai task selesai dan lepaskan dependent-nya. Dipanggil dengan
+// loaderMutex terkunci.
+static void finishTask(int index) {
+    StartupTask& task = startupTasks[index];
+    task.endMs = millisecondsSince(loadStart);
+    for (int dependent : task.dependents) {
+        if (--startupTasks[dependent].waiting == 0) {
+            queueReadyTask(dependent);
+        }
+    }
+    if (++finishedTasks == (int)startupTasks.size()) {
+        loaderCondition.notify_all();
+    }
+}
+
+static void workerLoop() {
+    for (;;) {
+        int index;
+        {
+            std::unique_lock<std::mutex> lock(loaderMutex);
+            // Task GL yang belum selesai masih bisa melepaskan task cpu baru
+            loaderCondition.wait(lock, [] {
+                return !cpuQueue.empty() || finishedTasks == (int)startupTasks.size();
+            });
+            if (cpuQueue.empty()) return;
+            index = cpuQueue.front();
+            cpuQueue.pop_front();
+        }
+
+        // Elemen vector tidak dipindah: graph tidak berubah setelah disusun
+        StartupTask& task = startupTasks[index];
+        auto start = std::chrono::steady_clock::now();
+        task.startMs = millisecondsSince(loadStart);
+        task.cpu();
+        task.cpuMs = millisecondsSince(start);
+
+        std::lock_guard<std::mutex> lock(loaderMutex);
+        if (task.gl) {
+            glQueue.push_back(index);
+        } else {
+            finishTask(index);
+        }
+    }
+}
+
+static void printStartupReport(float readyMs) {
+    // Task chunk digabung per nama agar tabel tetap pendek
+    struct Row {
+        int count;
+        float startMs, endMs, cpuMs, glMs;
+    };
+    std::vector<std::string> order;
+    std::map<std::string, Row> rows;
+    float totalWorkMs = 0.0f;
+    for (const auto& task : startupTasks) {
+        auto found = rows.find(task.name);
+        if (found == rows.end()) {
+            order.push_back(task.name);
+            Row row = {0, task.startMs, task.endMs, 0.0f, 0.0f};
+            found = rows.insert(std::make_pair(std::string(task.name), row)).first;
+        }
+        Row& row = found->second;
+        row.count++;
+        row.startMs = std::min(row.startMs, task.startMs);
+        row.endMs = std::max(row.endMs, task.endMs);
+        row.cpuMs += task.cpuMs;
+        row.glMs += task.glMs;
+        totalWorkMs += task.cpuMs + task.glMs;
+    }
+
+    std::printf("Startup report (%d tasks on %d threads)\n", (int)startupTasks.size(), (int)loaderThreads.size());
+    std::printf("  %-14s %5s %9s %9s %9s %9s\n", "task", "count", "start", "end", "cpu ms", "gl ms");
+    for (const auto& name : order) {
+        const Row& row = rows[name];
+        std::printf("  %-14s %5d %9.1f %9.1f %9.1f %9.1f\n", name.c_str(), row.count,
+                    row.startMs, row.endMs, row.cpuMs, row.glMs);
+    }
+
+    // Critical path: mundur dari task yang selesai terakhir lewat input
+    // yang selesai paling akhir
+    int last = 0;
+    for (int i = 1; i < (int)startupTasks.size(); i++) {
+        if (startupTasks[i].endMs > startupTasks[last].endMs) last = i;
+    }
+    std::vector<int> path;
+    for (int i = last; i >= 0; ) {
+        path.push_back(i);
+        int latest = -1;
+        for (int input : startupTasks[i].inputs) {
+            if (latest < 0 || startupTasks[input].endMs > startupTasks[latest].endMs) latest = input;
+        }
+        i = latest;
+    }
+    std::reverse(path.begin(), path.end());
+
+    std::printf("  critical path:");
+    float pathWorkMs = 0.0f;
+    for (int index : path) {
+        const StartupTask& task = startupTasks[index];
+        std::printf(" %s%s(%.1f)", index == path.front() ? "" : "-> ", task.name, task.cpuMs + task.glMs);
+        pathWorkMs += task.cpuMs + task.glMs;
+    }
+    std::printf("\n");
+    std::printf("  critical path work %.1f ms, all work %.1f ms, ready after %.1f ms\n",
+                pathWorkMs, totalWorkMs, readyMs);
+}
+
+void startAssetLoading() {
+    loadStart = std::chrono::steady_clock::now();
+
+    player = createPlayer("Player", 0.0f, 0.0f, 0.0f);
+    int chunkCount = beginWorldLoad(player.position.x, player.position.z);
+
+    startupTasks.clear();
+    startupTasks.reserve(chunkCount + 16);
+    finishedTasks = 0;
+    loadFinished = false;
+
+    // Task dimasukkan ke antrian sesuai urutan di sini, jadi awal rantai
+    // terpanjang (level -> scenery -> chunk) didahulukan.
+    // Layout dari file level; layout bawaan jika file tidak bisa dimuat
+    int level = addTask("level", {}, [] {
+        levelFromFile = loadLevel(gameOptions.levelPath);
+        if (!levelFromFile) {
+            std::cout << "Using built-in map layout" << std::endl;
+            initMap();
+            drawBorderMap();
+        }
+    }, nullptr);
+    addTask("levelWatcher", {level}, nullptr, [] {
+        if (levelFromFile) {
+            initLevelWatcher(gameOptions.levelPath);
+        }
+    });
+    // Seed dari jam berbeda setiap start, jadi cache hanya dipakai dengan --seed
+    bool useCache = gameOptions.worldCachePath != nullptr && gameOptions.seedSet;
+    if (gameOptions.worldCachePath != nullptr && !gameOptions.seedSet) {
+        std::cout << "World cache not used: no --seed given" << std::endl;
+    }
+    int cache = addTask("worldCache", {level}, [useCache] {
+        if (useCache) openWorldCache(gameOptions.worldCachePath);
+    }, nullptr);
+    // Footprint gedung menjadi zona terlarang chunk, jadi chunk menunggu scenery
+    int scenery = addTask("scenery", {cache}, [] {
+        if (!worldCacheHit()) initScenery();
+    }, nullptr);
+    int navigation = addTask("navigation", {cache}, [] {
+        size_t count = 0;
+        const unsigned char* cells = getCachedNavCells(count);
+        if (cells == nullptr || !initNavigationFromCache(cells, count)) initNavigation();
+    }, nullptr);
+
+    // Decode di worker, upload + cache di thread GL
+    std::shared_ptr<TextureImage> grassImage = std::make_shared<TextureImage>();
+    std::shared_ptr<bool> grassDecoded = std::make_shared<bool>(false);
+    std::shared_ptr<float> grassDecodeMs = std::make_shared<float>(0.0f);
+    addTask("grass", {},
+        [=] {
+            auto start = std::chrono::steady_clock::now();
+            *grassDecoded = loadTextureImage("texture/grass.bmp", *grassImage);
+            *grassDecodeMs = millisecondsSince(start);
+        },
+        [=] {
+            grassTexture = uploadTextureFile("texture/grass.bmp", *grassImage, *grassDecoded, *grassDecodeMs);
+        });
+    int atlas = addTask("atlas", {}, composeTextureAtlas, uploadTextureAtlas);
+
+    addTask("mapMesh", {level, atlas}, nullptr, bakeMapMesh);
+
+    std::vector<int> chunks;
+    for (int i = 0; i < chunkCount; i++) {
+        std::shared_ptr<WorldChunk*> chunk = std::make_shared<WorldChunk*>(nullptr);
+        chunks.push_back(addTask("chunk", {scenery, atlas},
+            [=] { *chunk = generateInitialChunk(i); },
+            [=] { addInitialChunk(*chunk); }));
+    }
+    int world = addTask("world", chunks, nullptr, finishWorldLoad);
+
+    // Tulis cache baru (miss) atau lepas mapping (hit) setelah semua
+    // pembacanya selesai
+    std::vector<int> cacheReaders = chunks;
+    cacheReaders.push_back(scenery);
+    cacheReaders.push_back(navigation);
+    addTask("worldCacheSave", cacheReaders, [useCache] {
+        if (useCache) closeWorldCache(gameOptions.worldCachePath);
+    }, nullptr);
+    // Spawn memakai grid navigasi dan collision yang membaca chunk dunia
+    int enemies = addTask("enemies", {navigation, world}, nullptr, initEnemySystem);
+    addTask("waves", {enemies}, nullptr, initGameSystem);
+
+    {
+        std::lock_guard<std::mutex> lock(loaderMutex);
+        for (int i = 0; i < (int)startupTasks.size(); i++) {
+            if (startupTasks[i].waiting == 0) {
+                queueReadyTask(i);
+            }
+        }
+    }
+
+    int threadCount = std::max(2, (int)std::thread::hardware_concurrency() - 1);
+    for (int i = 0; i < threadCount; i++) {
+        loaderThreads.push_back(std::thread(workerLoop));
+    }
+    std::cout << "Loading assets on " << threadCount << " threads (" << startupTasks.size()
+              << " startup tasks, " << chunkCount << " initial chunks)" << std::endl;
+}
+
+static void finishLoading() {
+    for (auto& thread : loaderThreads) {
+        thread.join();
+    }
+
+    float readyMs = millisecondsSince(loadStart);
+    std::cout << "Assets ready after " << readyMs << " ms" << std::endl;
+    if (gameOptions.startupReport) {
+        printStartupReport(readyMs);
+    }
+    loaderThreads.clear();
+    loadFinished = true;
+}
+
+void updateAssetLoading() {
+    if (loadFinished) return;
+    if (!firstFrameLogged) {
+        std::cout << "First frame after " << millisecondsSince(loadStart) << " ms" << std::endl;
+        firstFrameLogged = true;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (;;) {
+        int index;
+        {
+            std::lock_guard<std::mutex> lock(loaderMutex);
+            if (finishedTasks == (int)startupTasks.size()) break;
+            if (glQueue.empty()) return;
+            index = glQueue.front();
+            glQueue.pop_front();
+        }
+
+        StartupTask& task = startupTasks[index];
+        auto glStart = std::chrono::steady_clock::now();
+        if (!task.cpu) {
+            task.startMs = millisecondsSince(loadStart);
+        }
+        task.gl();
+        task.glMs = millisecondsSince(glStart);
+        {
+            std::lock_guard<std::mutex> lock(loaderMutex);
+            finishTask(index);
+        }
+        if (millisecondsSince(start) > LOADER_FRAME_BUDGET_MS) return;
+    }
+
+    // Semua task selesai; worker sudah atau segera keluar
+    finishLoading();
+}
+
+bool assetsReady() {
+    return loadFinished;
+}
+
+float getAssetLoadProgress() {
+    std::lock_guard<std::mutex> lock(loaderMutex);
+    if (startupTasks.empty()) return 0.0f;
+    return (float)finishedTasks / (float)startupTasks.size();
+}
@@ -14,6 +14,21 @@
 #include "scenery.h"
 #include "gamemanager.h"
 #include "combat.h"
+#include "options.h"
+#include "jobs.h"
+#include "random.h"
+#include "navigation.h"
+#include "world.h"
+#include "level.h"
+#include "levelwatch.h"
+#include "texture.h"
+#include "loader.h"
+#include "shadow.h"
+#include "renderqueue.h"
+#include "glstate.h"
+#include "shader.h"
+#include "lights.h"
+#include "text.h"
    
 Player* pl = &player; 
 
@@ -27,6 +42,10 @@ void display() {
     auto currentFrameTime = std::chrono::steady_clock::now();     // Waktu frame saat ini
     float deltaTime = std::chrono::duration<float>(currentFrameTime - lastFrameTime).count(); // Hitung deltaTime
     lastFrameTime = currentFrameTime; // Perbarui waktu frame sebelumnya
+    resetGLStateStats();
+
+    // Upload hasil worker loader (no-op setelah semua aset siap)
+    updateAssetLoading();
 
     if (inMenu) {
         drawMenu(windowWidth, windowHeight); // Pass width and height
@@ -35,7 +54,7 @@ void display() {
     } else if (gameState == GAME_WAVE_TRANSITION) {
         // Draw the game scene in the background
         glClearColor(0.529f, 0.808f, 0.922f, 1.0f);
-        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
         renderScene();
         
         // Draw wave transition overlay
@@ -44,18 +63,24 @@ void display() {
         // Update game state
         updateGameState(deltaTime);
         
+        flushText(windowWidth, windowHeight);
         glutSwapBuffers();
     }
     else {
         // Atur warna latar belakang (langit) menjadi biru muda
         glClearColor(0.529f, 0.808f, 0.922f, 1.0f); // Contoh: Warna biru langit
-        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
+        // Level yang diubah di disk dimuat ulang tanpa restart
+        pollLevelWatcher();
+        
         // Only process input and update game state if not paused
         if (!isPaused) {
             processKeys(*pl);
             updateCamera(*pl);
+            updateWorldStreaming(pl->position.x, pl->position.z);
             updateEnemies(deltaTime);
+            updateLights(deltaTime);
             updateGameState(deltaTime);
         }
         
@@ -72,7 +97,7 @@ void display() {
         glLoadIdentity();
 
         if (!isPaused) {
-            glColor3f(0.0f, 0.0f, 0.0f);
+            glsColor3f(0.0f, 0.0f, 0.0f);
 
             if (isFirstPersonView && player.combatMode == SHOOTING_MODE) {
                 // Draw hands and weapon in first-person perspective
@@ -180,6 +205,56 @@ void display() {
             snprintf(waveBuffer, sizeof(waveBuffer), "Game State: %s", stateText);
             drawText(waveBuffer, 10, windowHeight - 320);
 
+            snprintf(waveBuffer, sizeof(waveBuffer), "Textures: %d (%.0f KB, %.1f ms, %d missing, %d cache hits)",
+                     textureStats.loaded, textureStats.bytes / 1024.0f, textureStats.loadMs,
+                     textureStats.missing, textureStats.cacheHits);
+            drawText(waveBuffer, 10, windowHeight - 340);
+
+            snprintf(waveBuffer, sizeof(waveBuffer), "Ground tiles: %d/%d, chunks: %d/%d",
+                     groundStats.tilesDrawn, groundStats.tilesInRange,
+                     worldStats.visibleChunks, worldStats.residentChunks);
+            drawText(waveBuffer, 10, windowHeight - 360);
+
+            if (shadowStats.mapSize > 0) {
+                snprintf(waveBuffer, sizeof(waveBuffer), "Shadow map: %d px (%s), casters: %d",
+                         shadowStats.mapSize, shadowStats.framebuffer ? "FBO" : "copy", shadowStats.casters);
+                drawText(waveBuffer, 10, windowHeight - 380);
+            } else {
+                snprintf(waveBuffer, sizeof(waveBuffer), "Blob shadows: %d (1 draw)", shadowStats.blobs);
+                drawText(waveBuffer, 10, windowHeight - 380);
+            }
+
+            snprintf(waveBuffer, sizeof(waveBuffer), "Render queue: %d items, %d state changes, %d binds, sort %.2f ms",
+                     renderQueueStats.items, renderQueueStats.stateChanges, renderQueueStats.textureBinds,
+                     renderQueueStats.sortMs);
+            drawText(waveBuffer, 10, windowHeight - 400);
+
+            // Dihitung sampai titik ini: scene + HUD di atas
+            snprintf(waveBuffer, sizeof(waveBuffer), "GL state calls: %u issued, %u skipped",
+                     glStateStats.issued, glStateStats.skipped);
+            drawText(waveBuffer, 10, windowHeight - 420);
+
+            if (shaderStats.glslVersion > 0) {
+                snprintf(waveBuffer, sizeof(waveBuffer), "Lighting: GLSL %d per-pixel%s",
+                         shaderStats.glslVersion, shaderStats.uniformBuffers ? " (uniform buffers)" : "");
+            } else {
+                snprintf(waveBuffer, sizeof(waveBuffer), "Lighting: fixed-function");
+            }
+            drawText(waveBuffer, 10, windowHeight - 440);
+
+            snprintf(waveBuffer, sizeof(waveBuffer), "Point lights: %d, clusters: %d, indices: %d, build %.2f ms",
+                     lightStats.lights, lightStats.clusters, lightStats.indices, lightStats.buildMs);
+            drawText(waveBuffer, 10, windowHeight - 460);
+
+            // Frame sebelumnya: batch teks frame ini baru digambar di flushText()
+            if (textStats.atlas) {
+                snprintf(waveBuffer, sizeof(waveBuffer), "Text: %d glyphs, %d draw (atlas)",
+                         textStats.glyphs, textStats.draws);
+            } else {
+                snprintf(waveBuffer, sizeof(waveBuffer), "Text: bitmap characters");
+            }
+            drawText(waveBuffer, 10, windowHeight - 480);
+
             // Restore matrices
             glMatrixMode(GL_PROJECTION);
             glPopMatrix();
@@ -198,6 +273,7 @@ void display() {
             // Draw pause menu on top of frozen game scene
             drawPauseMenu(windowWidth, windowHeight);
         }
+        flushText(windowWidth, windowHeight);
         glutSwapBuffers();
     }
 }
@@ -210,24 +286,32 @@ void Reshape(int w, int h) {
 
 void init()
 {
-    glEnable(GL_DEPTH_TEST);
+    glsEnable(GL_DEPTH_TEST);
     glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
     loadTexture(); 
-    initMap();
-    drawBorderMap();
-    initScenery(); 
-
-    player = createPlayer("Player", 0.0f, 0.0f, 0.0f);
-    initEnemySystem();
-
-    initGameSystem(); 
+    initShadows();
+    initLights();
+    initText();
+    // Level, navigasi, scenery, chunk awal, tekstur file dan sistem game
+    // dimuat di worker thread; menu tampil dengan progress bar sementara itu
+    startAssetLoading();
     
     gameState = GAME_MENU;
 }
 
 int main(int argc, char **argv) {
     glutInit(&argc, argv);
-    glutInitDisplayMode(GLUT_DEPTH | GLUT_DOUBLE | GLUT_RGBA | GLUT_STENCIL);
+    parseOptions(argc, argv);
+    if (gameOptions.convertInput != nullptr) {
+        return convertLevelText(gameOptions.convertInput, gameOptions.convertOutput) ? 0 : 1;
+    }
+    if (!gameOptions.seedSet) {
+        gameOptions.seed = (unsigned long long)time(nullptr);
+    }
+    initRandom(gameOptions.seed);
+    std::cout << "Master seed: " << gameOptions.seed << " (ulangi dengan --seed " << gameOptions.seed << ")" << std::endl;
+    initJobSystem(gameOptions.aiThreads);
+    glutInitDisplayMode(GLUT_DEPTH | GLUT_DOUBLE | GLUT_RGBA);
     glutInitWindowPosition(100, 100);
     glutInitWindowSize(windowWidth, windowHeight);
     glutCreateWindow("Exploring Game");
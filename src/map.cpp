@@ -37,7 +37,13 @@
  *                   Membuat empat pagar pembatas (depan, belakang, kiri, kanan)
  * 
  * drawMap()       - Menggambar seluruh elemen peta
- *                   Memanggil fungsi drawWall() dan drawFence() untuk setiap elemen
+ *                   Saat pertama dipanggil, drawWall(), drawFence(), drawRooftop()
+ *                   dan drawStaircase() di-bake ke satu display list; frame
+ *                   berikutnya hanya glCallList dengan tekstur atlas ter-bind
+ * 
+ * bakeMapMesh()   - Bake display list peta tanpa menggambar (loader startup)
+ * 
+ * invalidateMapMesh() - Buang display list peta (setelah data level berubah)
  * 
  * DEPENDENCIES:
  * -----------
@@ -50,6 +56,7 @@
  * HOW TO USE:
  * ----------
  * 1. Panggil initMap() di awal game untuk menginisialisasi layout dasar
+ *    (hanya jika file level tidak bisa dimuat; lihat level.cpp dan levels/town.txt)
  * 2. Panggil drawBorderMap() untuk menambahkan pagar pembatas area permainan
  * 3. Panggil drawMap() di loop rendering untuk menampilkan seluruh elemen peta
  * 4. Untuk menambahkan dinding atau pagar baru, tambahkan di initMap() atau drawBorderMap()
@@ -57,7 +64,8 @@
  * MAP LAYOUT:
  * ----------
  * - Struktur rumah sederhana di tengah peta
- * - Area permainan dibatasi oleh pagar dengan ukuran 200x200 units (-100 sampai 100)
+ * - Kota dikelilingi pagar 200x200 units (-100 sampai 100) dengan gerbang di
+ *   tengah setiap sisi; di luar pagar dunia dibangkitkan per chunk (world.cpp)
  * - Format dinding: {x1, z1, x2, z2, baseY, height, thickness}
  * - Format pagar: {startX, startZ, endX, endZ, height, thickness, numPosts}
  * 
@@ -68,6 +76,7 @@
 #include "object.h"
 #include "render.h"
 #include "map.h"
+#include "glstate.h"
 #include <vector>
 #include <cmath>
 
@@ -296,25 +305,48 @@ void initMap() {
 }
 
 void drawBorderMap() {
-    // Gunakan titik awal dan akhir untuk setiap sisi pagar
+    // Gunakan titik awal dan akhir untuk setiap sisi pagar. Setiap sisi
+    // punya gerbang selebar 8 unit di tengah sehingga player bisa keluar
+    // ke dunia terbuka (lihat world.cpp)
     
     // Sisi depan
-    fences.push_back({-100.0f, 100.0f, 100.0f, 100.0f, 2.0f, 0.2f, 140});
+    fences.push_back({-100.0f, 100.0f, -4.0f, 100.0f, 2.0f, 0.2f, 67});
+    fences.push_back({4.0f, 100.0f, 100.0f, 100.0f, 2.0f, 0.2f, 67});
     
     // Sisi belakang
-    fences.push_back({-100.0f, -100.0f, 100.0f, -100.0f, 2.0f, 0.2f, 140});
+    fences.push_back({-100.0f, -100.0f, -4.0f, -100.0f, 2.0f, 0.2f, 67});
+    fences.push_back({4.0f, -100.0f, 100.0f, -100.0f, 2.0f, 0.2f, 67});
     
     // Sisi kiri
-    fences.push_back({-100.0f, 100.0f, -100.0f, -100.0f, 2.0f, 0.2f, 140});
+    fences.push_back({-100.0f, 100.0f, -100.0f, 4.0f, 2.0f, 0.2f, 67});
+    fences.push_back({-100.0f, -4.0f, -100.0f, -100.0f, 2.0f, 0.2f, 67});
     
     // Sisi kanan
-    fences.push_back({100.0f, 100.0f, 100.0f, -100.0f, 2.0f, 0.2f, 140});
+    fences.push_back({100.0f, 100.0f, 100.0f, 4.0f, 2.0f, 0.2f, 67});
+    fences.push_back({100.0f, -4.0f, 100.0f, -100.0f, 2.0f, 0.2f, 67});
     
     // Contoh pagar diagonal
     // drawFence(-5.0f, 5.0f, 5.0f, 15.0f, 2.0f, 0.2f, 8);
 }
 
-void drawMap() {
+// Dinding, pagar, atap dan tangga di-bake ke satu display list (UV atlas),
+// dibangun ulang hanya setelah invalidateMapMesh()
+static GLuint mapDisplayList = 0;
+
+void invalidateMapMesh() {
+    if (mapDisplayList != 0) {
+        glDeleteLists(mapDisplayList, 1);
+        mapDisplayList = 0;
+    }
+}
+
+static void bakeMap() {
+    // drawWall/drawFence mendaftarkan bounding box-nya lagi setiap bake
+    boundingBoxes.clear();
+
+    mapDisplayList = glGenLists(1);
+    glsNewList(mapDisplayList);
+
     // Draw all walls based on defined layout
     for (const auto& wall : walls) {
         drawWall(wall.x1, wall.z1, wall.x2, wall.z2, wall.y, wall.height, wall.thickness);
@@ -332,4 +364,17 @@ void drawMap() {
     for (const auto& stair : staircases) {
         drawStaircase(stair.startX, stair.startZ, stair.width, stair.stepDepth, stair.stepHeight, stair.numSteps, stair.baseY);
     }
+
+    glsEndList();
+}
+
+void bakeMapMesh() {
+    if (mapDisplayList == 0) {
+        bakeMap();
+    }
+}
+
+void drawMap() {
+    bakeMapMesh();
+    glsCallList(mapDisplayList);
 }
@@ -0,0 +1,94 @@
+/*
+ * ==========================================================================
+ * MEMORY-MAPPED FILES
+ * ==========================================================================
+ *
+ * File: mappedfile.cpp
+ * Author: Project Team
+ * Date: June 2025
+ *
+ * DESCRIPTION:
+ * -----------
+ * Memetakan file read-only ke memori sehingga loader (level, tekstur)
+ * membaca data langsung dari page cache tanpa fread ke buffer sementara.
+ * Memakai mmap di Linux dan CreateFileMapping/MapViewOfFile di Windows.
+ *
+ * FUNCTIONS:
+ * ---------
+ * mapFile()   - Petakan seluruh file
+ * unmapFile() - Lepas mapping dan tutup file
+ *
+ * ==========================================================================
+ */
+
+#include "mappedfile.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+bool mapFile(const char* path, MappedFile& mf) {
+    mf.data = nullptr;
+    mf.size = 0;
+    mf.fileHandle = nullptr;
+    mf.mappingHandle = nullptr;
+    mf.fd = -1;
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) return false;
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart <= 0) {
+        CloseHandle(file);
+        return false;
+    }
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (mapping == NULL) {
+        CloseHandle(file);
+        return false;
+    }
+    mf.data = (const unsigned char*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (mf.data == nullptr) {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+    mf.fileHandle = file;
+    mf.mappingHandle = mapping;
+    mf.size = (size_t)size.QuadPart;
+#else
+    mf.fd = open(path, O_RDONLY);
+    if (mf.fd < 0) return false;
+    struct stat st;
+    if (fstat(mf.fd, &st) != 0 || st.st_size <= 0) {
+        close(mf.fd);
+        return false;
+    }
+    void* p = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, mf.fd, 0);
+    if (p == MAP_FAILED) {
+        close(mf.fd);
+        return false;
+    }
+    mf.data = (const unsigned char*)p;
+    mf.size = (size_t)st.st_size;
+#endif
+    return true;
+}
+
+void unmapFile(MappedFile& mf) {
+    if (mf.data == nullptr) return;
+#ifdef _WIN32
+    UnmapViewOfFile(mf.data);
+    CloseHandle((HANDLE)mf.mappingHandle);
+    CloseHandle((HANDLE)mf.fileHandle);
+#else
+    munmap((void*)mf.data, mf.size);
+    close(mf.fd);
+#endif
+    mf.data = nullptr;
+}
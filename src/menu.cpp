@@ -19,6 +19,8 @@
  * ----------------
  * - Background       - Latar belakang menu dengan langit, gunung, sawah, dan jalan
  * - Start Button     - Tombol untuk memulai permainan
+ * - Loading Bar      - Progres pemuatan aset (loader.cpp), menggantikan tombol
+ *                      Start sampai dunia selesai dimuat
  * - Game Title       - Judul game yang ditampilkan di tengah layar
  *  
  * GLOBAL VARIABLES:
@@ -39,6 +41,8 @@
  * - camera.h    - Header untuk akses ke fungsi cameraCenterMouse
  * - GL/glut.h   - Library OpenGL untuk fungsi rendering dan input
  * - iostream    - Untuk output debugging
+ * - loader.h    - Progres pemuatan aset (assetsReady, getAssetLoadProgress)
+ * - text.h      - drawText dan textWidth; teks digambar sekaligus di flushText()
  * 
  * HOW TO USE:
  * ----------
@@ -50,7 +54,7 @@
  * 
  * MENU FLOW:
  * ---------
- * 1. User melihat menu utama dengan tombol Start
+ * 1. User melihat menu utama; selama aset dimuat tombol Start diganti progress bar
  * 2. Ketika tombol Start diklik, inMenu diubah ke false
  * 3. Mouse diposisikan ke tengah screen dan cursor disembunyikan
  * 4. Game berpindah dari menu ke gameplay
@@ -65,13 +69,16 @@
 #include "camera.h"
 #include "input.h"
 #include "gamemanager.h"
+#include "loader.h"
+#include "glstate.h"
+#include "text.h"
 
 
 bool isPaused = false;
 
 void drawBackground(int width, int height) { 
     // Gambar garis jalan
-    glColor3f(1.0f, 1.0f, 1.0f); // Putih garis jalan
+    glsColor3f(1.0f, 1.0f, 1.0f); // Putih garis jalan
     glLineWidth(2.0f);
     glBegin(GL_LINES);
     for (int i = 0; i < height / 2; i += 40) { // Naikkan posisi garis jalan
@@ -81,7 +88,7 @@ void drawBackground(int width, int height) {
     glEnd();   
  
     // Gambar jalan raya (dipersempit dan dinaikkan)
-    glColor3f(0.2f, 0.2f, 0.2f); // Abu-abu jalan
+    glsColor3f(0.2f, 0.2f, 0.2f); // Abu-abu jalan
     glBegin(GL_QUADS);
     glVertex2i(width / 2 - 50, 0);          // Naikkan posisi jalan
     glVertex2i(width / 2 + 50, 0);          // Naikkan posisi jalan
@@ -90,7 +97,7 @@ void drawBackground(int width, int height) {
     glEnd();
 
     // Gambar sawah
-    glColor3f(0.6f, 0.8f, 0.2f); // Hijau sawah
+    glsColor3f(0.6f, 0.8f, 0.2f); // Hijau sawah
     glBegin(GL_QUADS);
     glVertex2i(0, 0);
     glVertex2i(width, 0);
@@ -99,7 +106,7 @@ void drawBackground(int width, int height) {
     glEnd(); 
 
     // Gambar gunung
-    glColor3f(0.4f, 0.76f, 0.38f); // Hijau gunung
+    glsColor3f(0.4f, 0.76f, 0.38f); // Hijau gunung
     glBegin(GL_TRIANGLES);
     glVertex2i(width / 4 - 200, height / 2);
     glVertex2i(width / 2 - 300, height / 2 + 400);
@@ -107,7 +114,7 @@ void drawBackground(int width, int height) {
     glEnd();
 
     // Gambar gunung
-    glColor3f(0.4f, 0.81f, 0.41f); // Hijau gunung
+    glsColor3f(0.4f, 0.81f, 0.41f); // Hijau gunung
     glBegin(GL_TRIANGLES);
     glVertex2i(width / 4 + 300, height / 2);
     glVertex2i(width / 2 + 300, height / 2 + 500);
@@ -115,7 +122,7 @@ void drawBackground(int width, int height) {
     glEnd();
 
     // Gambar langit
-    glColor3f(0.529f, 0.808f, 0.922f); // Biru langit
+    glsColor3f(0.529f, 0.808f, 0.922f); // Biru langit
     glBegin(GL_QUADS);
     glVertex2i(0, height / 2);
     glVertex2i(width, height / 2);
@@ -140,11 +147,11 @@ void togglePauseMenu() {
 
 void drawPauseMenu(int width, int height) {
     // Semi-transparent overlay
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    glsEnable(GL_BLEND);
+    glsBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
     
     // Draw dark semi-transparent background
-    glColor4f(0.0f, 0.0f, 0.0f, 0.7f);
+    glsColor4f(0.0f, 0.0f, 0.0f, 0.7f);
     glBegin(GL_QUADS);
         glVertex2i(0, 0);
         glVertex2i(width, 0);
@@ -152,7 +159,7 @@ void drawPauseMenu(int width, int height) {
         glVertex2i(0, height);
     glEnd();
     
-    glDisable(GL_BLEND);
+    glsDisable(GL_BLEND);
     
     // Set projection for 2D menu
     glMatrixMode(GL_PROJECTION);
@@ -165,12 +172,8 @@ void drawPauseMenu(int width, int height) {
     glLoadIdentity();
 
     // Draw menu title
-    glColor3f(1.0f, 1.0f, 1.0f);
-    glRasterPos2i(width / 2 - 80, height - 100);
-    const char *title = "GAME PAUSED";
-    for (const char *c = title; *c != '\0'; c++) {
-        glutBitmapCharacter(GLUT_BITMAP_TIMES_ROMAN_24, *c);
-    }
+    glsColor3f(1.0f, 1.0f, 1.0f);
+    drawText("GAME PAUSED", width / 2 - 80, height - 100, GLUT_BITMAP_TIMES_ROMAN_24);
 
     // Define button dimensions
     int buttonWidth = 220;
@@ -184,22 +187,17 @@ void drawPauseMenu(int width, int height) {
         int buttonY = posY - buttonHeight / 2;
         
         // Draw button text
-        glColor3f(1.0f, 1.0f, 1.0f);
-        int textWidth = 0;
-        for (const char* c = text; *c != '\0'; c++) {
-            textWidth += glutBitmapWidth(GLUT_BITMAP_HELVETICA_18, *c);
-        }
+        glsColor3f(1.0f, 1.0f, 1.0f);
+        int labelWidth = textWidth(text, GLUT_BITMAP_HELVETICA_18);
         
-        glRasterPos2i(buttonX + (buttonWidth - textWidth) / 2, buttonY + buttonHeight / 2 - 5);
-        for (const char* c = text; *c != '\0'; c++) {
-            glutBitmapCharacter(GLUT_BITMAP_HELVETICA_18, *c);
-        }
+        drawText(text, buttonX + (buttonWidth - labelWidth) / 2, buttonY + buttonHeight / 2 - 5,
+                 GLUT_BITMAP_HELVETICA_18);
         
         // Draw button background
         if (highlight) {
-            glColor3f(0.4f, 0.6f, 1.0f); // Highlighted blue
+            glsColor3f(0.4f, 0.6f, 1.0f); // Highlighted blue
         } else {
-            glColor3f(0.3f, 0.3f, 0.3f); // Dark gray
+            glsColor3f(0.3f, 0.3f, 0.3f); // Dark gray
         }
         
         glBegin(GL_QUADS);
@@ -210,7 +208,7 @@ void drawPauseMenu(int width, int height) {
         glEnd();
         
         // Draw button border
-        glColor3f(1.0f, 1.0f, 1.0f);
+        glsColor3f(1.0f, 1.0f, 1.0f);
         glLineWidth(2.0f);
         glBegin(GL_LINE_LOOP);
             glVertex2i(buttonX, buttonY);
@@ -291,6 +289,9 @@ void handlePauseMenuClick(int button, int state, int x, int y, int windowWidth,
 }
 
 void handleMenuClick(int button, int state, int x, int y, int windowWidth, int windowHeight) {
+    // Tombol Start belum ada selama aset masih dimuat
+    if (!assetsReady()) return;
+
     if (button == GLUT_LEFT_BUTTON && state == GLUT_DOWN) {
         // Calculate button position
         int buttonWidth = 200;
@@ -338,7 +339,7 @@ void drawMenu(int width, int height) {
     // Function to draw text box with white background and border
     auto drawTextBox = [&](int x, int y, int width, int height) {
         // Draw white background
-        glColor3f(1.0f, 1.0f, 1.0f);
+        glsColor3f(1.0f, 1.0f, 1.0f);
         glBegin(GL_QUADS);
             glVertex2i(x, y);
             glVertex2i(x + width, y);
@@ -347,7 +348,7 @@ void drawMenu(int width, int height) {
         glEnd();
         
         // Draw black border
-        glColor3f(0.0f, 0.0f, 0.0f);
+        glsColor3f(0.0f, 0.0f, 0.0f);
         glLineWidth(2.0f);
         glBegin(GL_LINE_LOOP);
             glVertex2i(x, y);
@@ -359,45 +360,25 @@ void drawMenu(int width, int height) {
 
     
     // Title text with black color
-    glColor3f(0.0f, 0.0f, 0.0f);
-    glRasterPos2i(width / 2 - 140, height - 100);
-    const char *title = "WAVE SURVIVAL";
-    for (const char *c = title; *c != '\0'; c++) {
-        glutBitmapCharacter(GLUT_BITMAP_TIMES_ROMAN_24, *c);
-    }
+    glsColor3f(0.0f, 0.0f, 0.0f);
+    drawText("WAVE SURVIVAL", width / 2 - 140, height - 100, GLUT_BITMAP_TIMES_ROMAN_24);
 
     // Title box - wider for the title
     drawTextBox(width / 2 - 200, height - 130, 400, 60);
     
     
     // Objectives title with black color
-    glColor3f(0.0f, 0.0f, 0.0f);
-    glRasterPos2i(width / 2 - 150, height - 150);
-    const char *objectiveTitle = "GAME OBJECTIVES:";
-    for (const char *c = objectiveTitle; *c != '\0'; c++) {
-        glutBitmapCharacter(GLUT_BITMAP_HELVETICA_18, *c);
-    }
+    glsColor3f(0.0f, 0.0f, 0.0f);
+    drawText("GAME OBJECTIVES:", width / 2 - 150, height - 150, GLUT_BITMAP_HELVETICA_18);
     
     // Objective text with black color
-    glColor3f(0.0f, 0.0f, 0.0f);
-    glRasterPos2i(width / 2 - 180, height - 180);
-    const char *objective1 = "- Survive and defeat all enemies in each wave";
-    for (const char *c = objective1; *c != '\0'; c++) {
-        glutBitmapCharacter(GLUT_BITMAP_HELVETICA_12, *c);
-    }
+    glsColor3f(0.0f, 0.0f, 0.0f);
+    drawText("- Survive and defeat all enemies in each wave", width / 2 - 180, height - 180, GLUT_BITMAP_HELVETICA_12);
 
     
-    glRasterPos2i(width / 2 - 180, height - 200);
-    const char *objective2 = "- Complete all 3 waves to win the game";
-    for (const char *c = objective2; *c != '\0'; c++) {
-        glutBitmapCharacter(GLUT_BITMAP_HELVETICA_12, *c);
-    }
+    drawText("- Complete all 3 waves to win the game", width / 2 - 180, height - 200, GLUT_BITMAP_HELVETICA_12);
     
-    glRasterPos2i(width / 2 - 180, height - 220);
-    const char *objective3 = "- Earn points by defeating enemies quickly";
-    for (const char *c = objective3; *c != '\0'; c++) {
-        glutBitmapCharacter(GLUT_BITMAP_HELVETICA_12, *c);
-    }
+    drawText("- Earn points by defeating enemies quickly", width / 2 - 180, height - 220, GLUT_BITMAP_HELVETICA_12);
 
     // Objectives section box
     drawTextBox(width / 2 - 220, height - 250, 440, 120);
@@ -409,80 +390,40 @@ void drawMenu(int width, int height) {
     
     
     // Left controls title
-    glColor3f(0.0f, 0.0f, 0.0f);
-    glRasterPos2i(width / 4 - 30, height - 300);
-    const char *leftControlsTitle = "MOVEMENT CONTROLS:";
-    for (const char *c = leftControlsTitle; *c != '\0'; c++) {
-        glutBitmapCharacter(GLUT_BITMAP_HELVETICA_18, *c);
-    }
+    glsColor3f(0.0f, 0.0f, 0.0f);
+    drawText("MOVEMENT CONTROLS:", width / 4 - 30, height - 300, GLUT_BITMAP_HELVETICA_18);
     
     
     // Left column of controls with black text
     int leftX = width / 4 - 30;
     int controlY = height - 360;
     
-    glRasterPos2i(leftX, controlY);
-    const char *control1 = "WASD - Move character";
-    for (const char *c = control1; *c != '\0'; c++) {
-        glutBitmapCharacter(GLUT_BITMAP_HELVETICA_12, *c);
-    }
+    drawText("WASD - Move character", leftX, controlY, GLUT_BITMAP_HELVETICA_12);
     
-    glRasterPos2i(leftX, controlY - lineHeight);
-    const char *control2 = "SPACE - Jump";
-    for (const char *c = control2; *c != '\0'; c++) {
-        glutBitmapCharacter(GLUT_BITMAP_HELVETICA_12, *c);
-    }
+    drawText("SPACE - Jump", leftX, controlY - lineHeight, GLUT_BITMAP_HELVETICA_12);
     
-    glRasterPos2i(leftX, controlY - lineHeight*2);
-    const char *control3 = "SHIFT - Sprint";
-    for (const char *c = control3; *c != '\0'; c++) {
-        glutBitmapCharacter(GLUT_BITMAP_HELVETICA_12, *c);
-    }
+    drawText("SHIFT - Sprint", leftX, controlY - lineHeight*2, GLUT_BITMAP_HELVETICA_12);
     
-    glRasterPos2i(leftX, controlY - lineHeight*3);
-    const char *control4 = "ESC - Pause game";
-    for (const char *c = control4; *c != '\0'; c++) {
-        glutBitmapCharacter(GLUT_BITMAP_HELVETICA_12, *c);
-    }
+    drawText("ESC - Pause game", leftX, controlY - lineHeight*3, GLUT_BITMAP_HELVETICA_12);
     
     // Left controls box
     drawTextBox(width / 4 - 50, height - 450, controlBoxWidth, controlBoxHeight);
     
     // Right controls title
-    glColor3f(0.0f, 0.0f, 0.0f);
-    glRasterPos2i(3 * width / 4 - 150, height - 300);
-    const char *rightControlsTitle = "COMBAT CONTROLS:";
-    for (const char *c = rightControlsTitle; *c != '\0'; c++) {
-        glutBitmapCharacter(GLUT_BITMAP_HELVETICA_18, *c);
-    }
+    glsColor3f(0.0f, 0.0f, 0.0f);
+    drawText("COMBAT CONTROLS:", 3 * width / 4 - 150, height - 300, GLUT_BITMAP_HELVETICA_18);
     
     
     // Right column of controls with black text
     int rightX = 3 * width / 4 - 150;
     
-    glRasterPos2i(rightX, controlY);
-    const char *control5 = "1 - Switch to punch mode";
-    for (const char *c = control5; *c != '\0'; c++) {
-        glutBitmapCharacter(GLUT_BITMAP_HELVETICA_12, *c);
-    }
+    drawText("1 - Switch to punch mode", rightX, controlY, GLUT_BITMAP_HELVETICA_12);
     
-    glRasterPos2i(rightX, controlY - lineHeight);
-    const char *control6 = "2 - Switch to gun mode";
-    for (const char *c = control6; *c != '\0'; c++) {
-        glutBitmapCharacter(GLUT_BITMAP_HELVETICA_12, *c);
-    }
+    drawText("2 - Switch to gun mode", rightX, controlY - lineHeight, GLUT_BITMAP_HELVETICA_12);
     
-    glRasterPos2i(rightX, controlY - lineHeight*2);
-    const char *control7 = "Left Click - Attack/Shoot";
-    for (const char *c = control7; *c != '\0'; c++) {
-        glutBitmapCharacter(GLUT_BITMAP_HELVETICA_12, *c);
-    }
+    drawText("Left Click - Attack/Shoot", rightX, controlY - lineHeight*2, GLUT_BITMAP_HELVETICA_12);
     
-    glRasterPos2i(rightX, controlY - lineHeight*3);
-    const char *control8 = "Right Click - Aim mode";
-    for (const char *c = control8; *c != '\0'; c++) {
-        glutBitmapCharacter(GLUT_BITMAP_HELVETICA_12, *c);
-    }
+    drawText("Right Click - Aim mode", rightX, controlY - lineHeight*3, GLUT_BITMAP_HELVETICA_12);
 
     // Right controls box
     drawTextBox(3 * width / 4 - 170, height - 450, controlBoxWidth, controlBoxHeight);
@@ -493,17 +434,61 @@ void drawMenu(int width, int height) {
     int buttonHeight = 80;
     int buttonX = width / 2 - buttonWidth / 2;
     int buttonY = height / 2 - buttonHeight / 2;
+
+    if (!assetsReady()) {
+        // Progress bar di tempat tombol Start selama aset dimuat
+        float progress = getAssetLoadProgress();
+        char loadingText[32];
+        snprintf(loadingText, sizeof(loadingText), "Loading... %d%%", (int)(progress * 100.0f));
+        glsColor3f(1.0f, 1.0f, 1.0f);
+        drawText(loadingText, buttonX + 40, buttonY + 45, GLUT_BITMAP_HELVETICA_18);
+
+        // Bagian yang sudah selesai
+        int fillWidth = (int)(buttonWidth * progress);
+        glsColor3f(0.3f, 0.5f, 0.8f);
+        glBegin(GL_QUADS);
+            glVertex2i(buttonX, buttonY);
+            glVertex2i(buttonX + fillWidth, buttonY);
+            glVertex2i(buttonX + fillWidth, buttonY + buttonHeight);
+            glVertex2i(buttonX, buttonY + buttonHeight);
+        glEnd();
+
+        // Sisa bar
+        glsColor3f(0.4f, 0.4f, 0.4f);
+        glBegin(GL_QUADS);
+            glVertex2i(buttonX, buttonY);
+            glVertex2i(buttonX + buttonWidth, buttonY);
+            glVertex2i(buttonX + buttonWidth, buttonY + buttonHeight);
+            glVertex2i(buttonX, buttonY + buttonHeight);
+        glEnd();
+
+        glLineWidth(2.0f);
+        glsColor3f(1.0f, 1.0f, 1.0f);
+        glBegin(GL_LINE_LOOP);
+            glVertex2i(buttonX, buttonY);
+            glVertex2i(buttonX + buttonWidth, buttonY);
+            glVertex2i(buttonX + buttonWidth, buttonY + buttonHeight);
+            glVertex2i(buttonX, buttonY + buttonHeight);
+        glEnd();
+
+        drawBackground(width, height);
+
+        glMatrixMode(GL_PROJECTION);
+        glPopMatrix();
+        glMatrixMode(GL_MODELVIEW);
+        glPopMatrix();
+
+        flushText(width, height);
+        glutSwapBuffers();
+        return;
+    }
     
     // Tulis teks "Start" di tombol dengan warna putih (kontras dengan latar belakang biru)
-    glColor3f(1.0f, 1.0f, 1.0f);
-    glRasterPos2i(buttonX + 75, buttonY + 45);
-    const char *buttonText = "Start";
-    for (const char *c = buttonText; *c != '\0'; c++) {
-        glutBitmapCharacter(GLUT_BITMAP_TIMES_ROMAN_24, *c);
-    }
+    glsColor3f(1.0f, 1.0f, 1.0f);
+    drawText("Start", buttonX + 75, buttonY + 45, GLUT_BITMAP_TIMES_ROMAN_24);
 
     // Draw button with blue background
-    glColor3f(0.3f, 0.5f, 0.8f);
+    glsColor3f(0.3f, 0.5f, 0.8f);
     glBegin(GL_QUADS);
         glVertex2i(buttonX, buttonY);
         glVertex2i(buttonX + buttonWidth, buttonY);
@@ -515,7 +500,7 @@ void drawMenu(int width, int height) {
 
     // Draw button border
     glLineWidth(2.0f);
-    glColor3f(1.0f, 1.0f, 1.0f);
+    glsColor3f(1.0f, 1.0f, 1.0f);
     glBegin(GL_LINE_LOOP);
         glVertex2i(buttonX, buttonY);
         glVertex2i(buttonX + buttonWidth, buttonY);
@@ -531,16 +516,17 @@ void drawMenu(int width, int height) {
     glMatrixMode(GL_MODELVIEW);
     glPopMatrix();
 
+    flushText(width, height);
     glutSwapBuffers();
 }
 
 void drawWaveTransitionScreen(int width, int height) {
     // Semi-transparent overlay
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    glsEnable(GL_BLEND);
+    glsBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
     
     // Draw dark semi-transparent background
-    glColor4f(0.0f, 0.0f, 0.0f, 0.5f);
+    glsColor4f(0.0f, 0.0f, 0.0f, 0.5f);
     glBegin(GL_QUADS);
         glVertex2i(0, 0);
         glVertex2i(width, 0);
@@ -548,7 +534,7 @@ void drawWaveTransitionScreen(int width, int height) {
         glVertex2i(0, height);
     glEnd();
     
-    glDisable(GL_BLEND);
+    glsDisable(GL_BLEND);
     
     // Set projection for 2D menu
     glMatrixMode(GL_PROJECTION);
@@ -568,29 +554,17 @@ void drawWaveTransitionScreen(int width, int height) {
     char nextWaveMessage[100];
     sprintf(nextWaveMessage, "PREPARING WAVE %d", waveSystem.currentWave);
     
-    glColor3f(1.0f, 1.0f, 1.0f);
+    glsColor3f(1.0f, 1.0f, 1.0f);
     
     // Calculate text width for centering
-    int textWidth = 0;
-    for (const char* c = waveMessage; *c != '\0'; c++) {
-        textWidth += glutBitmapWidth(GLUT_BITMAP_TIMES_ROMAN_24, *c);
-    }
+    int labelWidth = textWidth(waveMessage, GLUT_BITMAP_TIMES_ROMAN_24);
     
-    glRasterPos2i(width / 2 - textWidth / 2, height / 2 + 20);
-    for (const char *c = waveMessage; *c != '\0'; c++) {
-        glutBitmapCharacter(GLUT_BITMAP_TIMES_ROMAN_24, *c);
-    }
+    drawText(waveMessage, width / 2 - labelWidth / 2, height / 2 + 20, GLUT_BITMAP_TIMES_ROMAN_24);
     
     // Calculate text width for centering
-    textWidth = 0;
-    for (const char* c = nextWaveMessage; *c != '\0'; c++) {
-        textWidth += glutBitmapWidth(GLUT_BITMAP_HELVETICA_18, *c);
-    }
+    labelWidth = textWidth(nextWaveMessage, GLUT_BITMAP_HELVETICA_18);
     
-    glRasterPos2i(width / 2 - textWidth / 2, height / 2 - 20);
-    for (const char *c = nextWaveMessage; *c != '\0'; c++) {
-        glutBitmapCharacter(GLUT_BITMAP_HELVETICA_18, *c);
-    }
+    drawText(nextWaveMessage, width / 2 - labelWidth / 2, height / 2 - 20, GLUT_BITMAP_HELVETICA_18);
     
     // Restore matrices
     glMatrixMode(GL_PROJECTION);
@@ -619,30 +593,18 @@ void drawWinScreen(int width, int height) {
     const char* subtitleText = "You've completed all waves!";
     
     // Calculate text width for centering
-    int textWidth = 0;
-    for (const char* c = victoryText; *c != '\0'; c++) {
-        textWidth += glutBitmapWidth(GLUT_BITMAP_TIMES_ROMAN_24, *c);
-    }
+    int labelWidth = textWidth(victoryText, GLUT_BITMAP_TIMES_ROMAN_24);
     
     // Draw main title
-    glColor3f(1.0f, 1.0f, 0.0f); // Gold color
-    glRasterPos2i(width / 2 - textWidth / 2, height - 100);
-    for (const char *c = victoryText; *c != '\0'; c++) {
-        glutBitmapCharacter(GLUT_BITMAP_TIMES_ROMAN_24, *c);
-    }
+    glsColor3f(1.0f, 1.0f, 0.0f); // Gold color
+    drawText(victoryText, width / 2 - labelWidth / 2, height - 100, GLUT_BITMAP_TIMES_ROMAN_24);
     
     // Calculate subtitle width
-    textWidth = 0;
-    for (const char* c = subtitleText; *c != '\0'; c++) {
-        textWidth += glutBitmapWidth(GLUT_BITMAP_HELVETICA_18, *c);
-    }
+    labelWidth = textWidth(subtitleText, GLUT_BITMAP_HELVETICA_18);
     
     // Draw subtitle
-    glColor3f(1.0f, 1.0f, 1.0f);
-    glRasterPos2i(width / 2 - textWidth / 2, height - 140);
-    for (const char *c = subtitleText; *c != '\0'; c++) {
-        glutBitmapCharacter(GLUT_BITMAP_HELVETICA_18, *c);
-    }
+    glsColor3f(1.0f, 1.0f, 1.0f);
+    drawText(subtitleText, width / 2 - labelWidth / 2, height - 140, GLUT_BITMAP_HELVETICA_18);
     
     // Draw buttons
     int buttonWidth = 200;
@@ -673,28 +635,23 @@ void drawWinScreen(int width, int height) {
     glMatrixMode(GL_MODELVIEW);
     glPopMatrix();
     
+    flushText(width, height);
     glutSwapBuffers();
 }
 
 void drawButton(const char* text, int x, int y, int width, int height, bool highlight) {
     // Calculate text width for centering
-    int textWidth = 0;
-    for (const char* c = text; *c != '\0'; c++) {
-        textWidth += glutBitmapWidth(GLUT_BITMAP_HELVETICA_18, *c);
-    }
+    int labelWidth = textWidth(text, GLUT_BITMAP_HELVETICA_18);
     
     // Draw text
-    glColor3f(1.0f, 1.0f, 1.0f);
-    glRasterPos2i(x + (width - textWidth) / 2, y + height / 2 + 5);
-    for (const char* c = text; *c != '\0'; c++) {
-        glutBitmapCharacter(GLUT_BITMAP_HELVETICA_18, *c);
-    }
+    glsColor3f(1.0f, 1.0f, 1.0f);
+    drawText(text, x + (width - labelWidth) / 2, y + height / 2 + 5, GLUT_BITMAP_HELVETICA_18);
     
     // Draw button background
     if (highlight) {
-        glColor3f(0.4f, 0.6f, 1.0f); // Highlighted blue
+        glsColor3f(0.4f, 0.6f, 1.0f); // Highlighted blue
     } else {
-        glColor3f(0.3f, 0.3f, 0.3f); // Dark gray
+        glsColor3f(0.3f, 0.3f, 0.3f); // Dark gray
     }
     
     glBegin(GL_QUADS);
@@ -705,7 +662,7 @@ void drawButton(const char* text, int x, int y, int width, int height, bool high
     glEnd();
     
     // Draw button border
-    glColor3f(1.0f, 1.0f, 1.0f);
+    glsColor3f(1.0f, 1.0f, 1.0f);
     glLineWidth(2.0f);
     glBegin(GL_LINE_LOOP);
         glVertex2i(x, y);
@@ -0,0 +1,629 @@
+/*
+ * ==========================================================================
+ * NAVIGATION GRID & PATHFINDING
+ * ==========================================================================
+ *
+ * File: navigation.cpp
+ * Author: Project Team
+ * Date: June 2025
+ *
+ * DESCRIPTION:
+ * -----------
+ * Grid navigasi untuk musuh beserta pencarian jalur A*:
+ * - Grid 0.5 unit di atas area permainan (-100..100), dibangun sekali dari
+ *   walls, fences dan staircases. Sel di sekitar dinding dicek ulang dengan
+ *   checkLevelCollisionAt() di pusat dan keempat sudutnya, jadi sel walkable
+ *   berarti seluruh sel bebas dinding dan pagar (termasuk area pintu yang
+ *   memang bebas collision). Collider scenery chunk dunia sengaja tidak
+ *   dipakai: chunk dimuat paralel saat startup dan berubah selama bermain,
+ *   sehingga grid (dan cache dunia) tetap deterministik. Musuh mengecek
+ *   collider itu sendiri saat melangkah (stepEnemy).
+ * - A* 8 arah dengan heuristik octile dan tanpa memotong sudut dinding.
+ *   Buffer kerja memakai "stamp" sehingga tidak perlu di-reset tiap pencarian.
+ * - Cache path (LRU): path ke sel tujuan yang sama dari region awal yang
+ *   sama dipakai bersama oleh banyak musuh. Musuh bergabung ke path di
+ *   sel terdekat yang terlihat (line of sight) dari posisinya.
+ * - Flow field: Dijkstra dari sel player yang menyimpan "sel berikutnya"
+ *   untuk setiap sel, dibangun bertahap (budget per tick) di buffer belakang.
+ *   Dipakai saat banyak musuh mengejar sekaligus: lookup O(1) per musuh.
+ *
+ * STRUCTURES:
+ * ----------
+ * NavGrid, NavPath, NavPathRef - Didefinisikan di navigation.h
+ *
+ * CONSTANTS:
+ * ---------
+ * NAV_CELL_SIZE        - Ukuran sel (0.5 unit)
+ * NAV_AGENT_RADIUS     - Radius agen, sama dengan kotak collision (0.3)
+ * NAV_AGENT_HEIGHT     - Dinding yang dimulai di atas tinggi ini diabaikan
+ * NAV_REGION_SIZE      - Ukuran region (dalam sel) untuk berbagi path
+ * NAV_PATH_CACHE_SIZE  - Jumlah path maksimum di cache
+ * NAV_FLOW_MAX_COST    - Jarak (dalam sel) maksimum yang dijangkau flow field
+ *
+ * FUNCTIONS:
+ * ---------
+ * initNavigation()     - Membangun grid dari data level
+ * initNavigationFromCache() - Memakai sel blocked dari cache dunia (worldcache.cpp)
+ * navRebuildArea()     - Membangun ulang sebagian grid setelah level berubah
+ * navRequestPath()     - Mengambil path dari cache atau menjalankan A*
+ * navGetPath()         - Mengambil path dari referensi (read-only, thread-safe)
+ * navLineOfSight()     - Cek garis lurus di grid
+ * navFlowUpdate()      - Melanjutkan build flow field (bertahap)
+ * navFlowNext()        - Sel berikutnya menuju tujuan dari flow field
+ *
+ * ==========================================================================
+ */
+
+#include "navigation.h"
+#include "collision.h"
+#include "map.h"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <queue>
+
+const float NAV_CELL_SIZE = 0.5f;
+const float NAV_AGENT_RADIUS = 0.3f;
+const float NAV_AGENT_HEIGHT = 2.0f;
+const int NAV_REGION_SIZE = 8;
+const int NAV_PATH_CACHE_SIZE = 64;
+const int NAV_MAX_EXPANSIONS = 60000;
+const int NAV_JOIN_SEARCH = 48;     // Sel awal path yang dicoba saat bergabung
+const float NAV_FLOW_MAX_COST = 160.0f;   // 80 unit, lebih jauh dari aggro range
+
+NavGrid navGrid;
+NavStats navStats = {0, 0, 0, 0};
+
+static std::vector<NavPath> pathCache(NAV_PATH_CACHE_SIZE);
+static unsigned int nextPathId = 1;
+static unsigned int navTick = 0;
+
+// Buffer kerja A*
+static std::vector<float> gScore;
+static std::vector<int> parentCell;
+static std::vector<unsigned int> openStamp;
+static std::vector<unsigned int> closedStamp;
+static unsigned int searchStamp = 0;
+
+typedef std::pair<float, int> OpenEntry;    // (cost, cell)
+
+// Flow field double-buffer: [flowFront] dibaca musuh, yang lain sedang dibangun
+struct FlowBuffer {
+    std::vector<int> next;              // Sel berikutnya menuju goal
+    std::vector<float> cost;
+    std::vector<unsigned int> stamp;    // Sel tercapai jika stamp == buildStamp
+    unsigned int buildStamp;
+    int goal;
+};
+static FlowBuffer flowBuffers[2];
+static int flowFront = 0;
+static bool flowBuilding = false;
+static int flowPendingGoal = -1;
+static std::vector<OpenEntry> flowOpen;    // Heap Dijkstra yang sedang berjalan
+
+static inline int cellX(int cell) { return cell % navGrid.width; }
+static inline int cellZ(int cell) { return cell / navGrid.width; }
+
+static int regionOf(int cell) {
+    int regionsX = (navGrid.width + NAV_REGION_SIZE - 1) / NAV_REGION_SIZE;
+    return (cellZ(cell) / NAV_REGION_SIZE) * regionsX + cellX(cell) / NAV_REGION_SIZE;
+}
+
+// Tandai sel yang pusatnya berada di dalam kotak [minX,maxX]x[minZ,maxZ]
+static void forEachCellIn(float minX, float minZ, float maxX, float maxZ,
+                          const std::function<void(int)>& fn) {
+    int x0 = (int)std::ceil((minX - navGrid.originX) / navGrid.cellSize - 0.5f);
+    int x1 = (int)std::floor((maxX - navGrid.originX) / navGrid.cellSize - 0.5f);
+    int z0 = (int)std::ceil((minZ - navGrid.originZ) / navGrid.cellSize - 0.5f);
+    int z1 = (int)std::floor((maxZ - navGrid.originZ) / navGrid.cellSize - 0.5f);
+    x0 = std::max(x0, 0); z0 = std::max(z0, 0);
+    x1 = std::min(x1, navGrid.width - 1); z1 = std::min(z1, navGrid.height - 1);
+    for (int z = z0; z <= z1; z++) {
+        for (int x = x0; x <= x1; x++) {
+            fn(z * navGrid.width + x);
+        }
+    }
+}
+
+// Hitung ulang status blocked untuk sel [x0,x1] x [z0,z1] (inklusif) dari
+// data level saat ini. Dipakai saat init (seluruh grid) dan hot-reload.
+static void classifyCells(int x0, int z0, int x1, int z1) {
+    int rectWidth = x1 - x0 + 1;
+    for (int z = z0; z <= z1; z++) {
+        std::fill(navGrid.blocked.begin() + (size_t)z * navGrid.width + x0,
+                  navGrid.blocked.begin() + (size_t)z * navGrid.width + x1 + 1, (unsigned char)0);
+    }
+
+    // Batas area dalam world space (sel yang pusatnya di dalam kotak ini)
+    float rectMinX = navGrid.originX + x0 * navGrid.cellSize;
+    float rectMinZ = navGrid.originZ + z0 * navGrid.cellSize;
+    float rectMaxX = navGrid.originX + (x1 + 1) * navGrid.cellSize;
+    float rectMaxZ = navGrid.originZ + (z1 + 1) * navGrid.cellSize;
+    auto forEachCellInRect = [&](float minX, float minZ, float maxX, float maxZ,
+                                 const std::function<void(int)>& fn) {
+        if (maxX < rectMinX || minX > rectMaxX || maxZ < rectMinZ || minZ > rectMaxZ) return;
+        forEachCellIn(std::max(minX, rectMinX), std::max(minZ, rectMinZ),
+                      std::min(maxX, rectMaxX), std::min(maxZ, rectMaxZ), fn);
+    };
+
+    // Kandidat sel terblokir: footprint dinding (setinggi agen) dan pagar,
+    // diperbesar radius agen ditambah setengah sel. Kandidat dikonfirmasi dengan collision
+    // level yang sama dengan yang dipakai musuh saat bergerak.
+    std::vector<unsigned char> candidate((size_t)rectWidth * (z1 - z0 + 1), 0);
+    auto markCandidate = [&](int cell) {
+        candidate[(size_t)(cellZ(cell) - z0) * rectWidth + (cellX(cell) - x0)] = 1;
+    };
+    float pad = NAV_AGENT_RADIUS + NAV_CELL_SIZE;
+
+    for (const auto& wall : walls) {
+        if (wall.y >= NAV_AGENT_HEIGHT) continue;   // Dinding lantai atas
+        float half = wall.thickness / 2.0f + pad;
+        forEachCellInRect(std::min(wall.x1, wall.x2) - half, std::min(wall.z1, wall.z2) - half,
+                          std::max(wall.x1, wall.x2) + half, std::max(wall.z1, wall.z2) + half,
+                          markCandidate);
+    }
+    for (const auto& fence : fences) {
+        float half = fence.thickness / 2.0f + pad;
+        forEachCellInRect(std::min(fence.startX, fence.endX) - half, std::min(fence.startZ, fence.endZ) - half,
+                          std::max(fence.startX, fence.endX) + half, std::max(fence.startZ, fence.endZ) + half,
+                          markCandidate);
+    }
+
+    // Rintangan yang sudah diperbesar selalu lebih lebar dari satu sel, jadi
+    // jika rintangan menyentuh sel, minimal satu sudut sel ikut tertabrak
+    float h = navGrid.cellSize / 2.0f;
+    for (int z = z0; z <= z1; z++) {
+        for (int x = x0; x <= x1; x++) {
+            if (!candidate[(size_t)(z - z0) * rectWidth + (x - x0)]) continue;
+            int cell = z * navGrid.width + x;
+            float cx, cz;
+            navCellCenter(cell, cx, cz);
+            if (checkLevelCollisionAt(cx, cz, 0.0f) ||
+                checkLevelCollisionAt(cx - h, cz - h, 0.0f) || checkLevelCollisionAt(cx + h, cz - h, 0.0f) ||
+                checkLevelCollisionAt(cx - h, cz + h, 0.0f) || checkLevelCollisionAt(cx + h, cz + h, 0.0f)) {
+                navGrid.blocked[cell] = 1;
+            }
+        }
+    }
+
+    // Tangga dan landing: getGroundLevel() mengangkat entitas di area ini,
+    // jadi musuh di lantai dasar tidak boleh masuk
+    for (const auto& stair : staircases) {
+        float stairEndZ = stair.startZ + stair.stepDepth * stair.numSteps;
+        forEachCellInRect(stair.startX - 0.5f - pad, stair.startZ - 0.2f - pad,
+                          stair.startX + stair.width + pad, stairEndZ + 2.5f + pad,
+                          [](int cell) { navGrid.blocked[cell] = 1; });
+    }
+}
+
+static void setupNavGrid() {
+    navGrid.originX = -100.0f;
+    navGrid.originZ = -100.0f;
+    navGrid.cellSize = NAV_CELL_SIZE;
+    navGrid.width = (int)(200.0f / NAV_CELL_SIZE);
+    navGrid.height = (int)(200.0f / NAV_CELL_SIZE);
+}
+
+// Buffer A*, cache path dan flow field untuk grid yang sudah terisi
+static void resetNavSearch() {
+    size_t cellCount = (size_t)navGrid.width * navGrid.height;
+    gScore.assign(cellCount, 0.0f);
+    parentCell.assign(cellCount, -1);
+    openStamp.assign(cellCount, 0);
+    closedStamp.assign(cellCount, 0);
+    searchStamp = 0;
+
+    for (size_t i = 0; i < pathCache.size(); i++) {
+        pathCache[i].id = 0;
+        pathCache[i].cells.clear();
+    }
+
+    for (int b = 0; b < 2; b++) {
+        flowBuffers[b].next.assign(cellCount, -1);
+        flowBuffers[b].cost.assign(cellCount, 0.0f);
+        flowBuffers[b].stamp.assign(cellCount, 0);
+        flowBuffers[b].buildStamp = 1;
+        flowBuffers[b].goal = -1;
+    }
+    flowFront = 0;
+    flowBuilding = false;
+    flowPendingGoal = -1;
+    flowOpen.clear();
+
+    size_t blockedCount = std::count(navGrid.blocked.begin(), navGrid.blocked.end(), (unsigned char)1);
+    std::cout << "Navigation grid " << navGrid.width << "x" << navGrid.height
+              << " (" << blockedCount << " blocked cells)" << std::endl;
+}
+
+void initNavigation() {
+    setupNavGrid();
+    navGrid.blocked.assign((size_t)navGrid.width * navGrid.height, 0);
+    classifyCells(0, 0, navGrid.width - 1, navGrid.height - 1);
+    resetNavSearch();
+}
+
+bool initNavigationFromCache(const unsigned char* blocked, size_t count) {
+    setupNavGrid();
+    if (count != (size_t)navGrid.width * navGrid.height) return false;
+    navGrid.blocked.assign(blocked, blocked + count);
+    resetNavSearch();
+    return true;
+}
+
+int navCellAt(float x, float z) {
+    if (navGrid.width == 0) return -1;
+    int cx = (int)std::floor((x - navGrid.originX) / navGrid.cellSize);
+    int cz = (int)std::floor((z - navGrid.originZ) / navGrid.cellSize);
+    if (cx < 0 || cz < 0 || cx >= navGrid.width || cz >= navGrid.height) {
+        return -1;
+    }
+    return cz * navGrid.width + cx;
+}
+
+void navCellCenter(int cell, float& x, float& z) {
+    x = navGrid.originX + (cellX(cell) + 0.5f) * navGrid.cellSize;
+    z = navGrid.originZ + (cellZ(cell) + 0.5f) * navGrid.cellSize;
+}
+
+bool navIsWalkable(int cell) {
+    return cell >= 0 && !navGrid.blocked[cell];
+}
+
+bool navIsWalkableAt(float x, float z) {
+    return navIsWalkable(navCellAt(x, z));
+}
+
+int navNearestWalkable(int cell, int maxRadius) {
+    if (cell < 0) return -1;
+    if (navIsWalkable(cell)) return cell;
+
+    int x0 = cellX(cell), z0 = cellZ(cell);
+    for (int r = 1; r <= maxRadius; r++) {
+        int best = -1;
+        int bestDist = 0;
+        for (int dz = -r; dz <= r; dz++) {
+            for (int dx = -r; dx <= r; dx++) {
+                if (std::abs(dx) != r && std::abs(dz) != r) continue;   // Hanya tepi cincin
+                int x = x0 + dx, z = z0 + dz;
+                if (x < 0 || z < 0 || x >= navGrid.width || z >= navGrid.height) continue;
+                int c = z * navGrid.width + x;
+                int d = dx * dx + dz * dz;
+                if (!navGrid.blocked[c] && (best < 0 || d < bestDist)) {
+                    best = c;
+                    bestDist = d;
+                }
+            }
+        }
+        if (best >= 0) return best;
+    }
+    return -1;
+}
+
+bool navLineOfSight(float x0, float z0, float x1, float z1) {
+    // Telusuri semua sel yang dilewati garis (DDA, Amanatides & Woo)
+    float gx0 = (x0 - navGrid.originX) / navGrid.cellSize;
+    float gz0 = (z0 - navGrid.originZ) / navGrid.cellSize;
+    float gx1 = (x1 - navGrid.originX) / navGrid.cellSize;
+    float gz1 = (z1 - navGrid.originZ) / navGrid.cellSize;
+
+    int x = (int)std::floor(gx0), z = (int)std::floor(gz0);
+    int endX = (int)std::floor(gx1), endZ = (int)std::floor(gz1);
+    float dx = gx1 - gx0, dz = gz1 - gz0;
+    int stepX = dx > 0 ? 1 : -1, stepZ = dz > 0 ? 1 : -1;
+    float tDeltaX = dx != 0.0f ? std::abs(1.0f / dx) : 1e30f;
+    float tDeltaZ = dz != 0.0f ? std::abs(1.0f / dz) : 1e30f;
+    float tMaxX = dx > 0 ? (x + 1 - gx0) * tDeltaX : (gx0 - x) * tDeltaX;
+    float tMaxZ = dz > 0 ? (z + 1 - gz0) * tDeltaZ : (gz0 - z) * tDeltaZ;
+    if (dx == 0.0f) tMaxX = 1e30f;
+    if (dz == 0.0f) tMaxZ = 1e30f;
+
+    auto walkable = [](int cx, int cz) {
+        return cx >= 0 && cz >= 0 && cx < navGrid.width && cz < navGrid.height &&
+               !navGrid.blocked[cz * navGrid.width + cx];
+    };
+
+    if (!walkable(x, z)) return false;
+    int guard = std::abs(endX - x) + std::abs(endZ - z) + 2;
+    while ((x != endX || z != endZ) && guard-- > 0) {
+        if (std::abs(tMaxX - tMaxZ) < 1e-6f) {
+            // Garis tepat melewati sudut: kedua tetangga harus bisa dilewati
+            if (!walkable(x + stepX, z) || !walkable(x, z + stepZ)) return false;
+            x += stepX; z += stepZ;
+            tMaxX += tDeltaX; tMaxZ += tDeltaZ;
+        } else if (tMaxX < tMaxZ) {
+            x += stepX;
+            tMaxX += tDeltaX;
+        } else {
+            z += stepZ;
+            tMaxZ += tDeltaZ;
+        }
+        if (!walkable(x, z)) return false;
+    }
+    return true;
+}
+
+// Arah tetangga 8 arah; 4 pertama lurus, 4 terakhir diagonal
+static const int dirX[8] = {1, -1, 0, 0, 1, 1, -1, -1};
+static const int dirZ[8] = {0, 0, 1, -1, 1, -1, 1, -1};
+static const float dirCost[8] = {1.0f, 1.0f, 1.0f, 1.0f, 1.41421356f, 1.41421356f, 1.41421356f, 1.41421356f};
+
+static float octile(int a, int b) {
+    int dx = std::abs(cellX(a) - cellX(b));
+    int dz = std::abs(cellZ(a) - cellZ(b));
+    return (float)std::max(dx, dz) + 0.41421356f * (float)std::min(dx, dz);
+}
+
+// A* dari start ke goal; hasil disimpan di out (start ... goal)
+static bool findPath(int start, int goal, std::vector<int>& out) {
+    navStats.searches++;
+    out.clear();
+
+    if (++searchStamp == 0) {
+        // Stamp overflow: reset buffer
+        std::fill(openStamp.begin(), openStamp.end(), 0u);
+        std::fill(closedStamp.begin(), closedStamp.end(), 0u);
+        searchStamp = 1;
+    }
+
+    std::priority_queue<OpenEntry, std::vector<OpenEntry>, std::greater<OpenEntry> > open;
+
+    gScore[start] = 0.0f;
+    parentCell[start] = -1;
+    openStamp[start] = searchStamp;
+    open.push(OpenEntry(octile(start, goal), start));
+
+    int expansions = 0;
+    while (!open.empty()) {
+        int current = open.top().second;
+        open.pop();
+        if (closedStamp[current] == searchStamp) continue;   // Entri lama
+        closedStamp[current] = searchStamp;
+
+        if (current == goal) {
+            for (int c = goal; c != -1; c = parentCell[c]) {
+                out.push_back(c);
+            }
+            std::reverse(out.begin(), out.end());
+            return true;
+        }
+
+        if (++expansions > NAV_MAX_EXPANSIONS) {
+            break;
+        }
+
+        int cx = cellX(current), cz = cellZ(current);
+        for (int d = 0; d < 8; d++) {
+            int nx = cx + dirX[d], nz = cz + dirZ[d];
+            if (nx < 0 || nz < 0 || nx >= navGrid.width || nz >= navGrid.height) continue;
+            int next = nz * navGrid.width + nx;
+            if (navGrid.blocked[next] || closedStamp[next] == searchStamp) continue;
+
+            // Diagonal tidak boleh memotong sudut dinding
+            if (d >= 4 && (navGrid.blocked[cz * navGrid.width + nx] ||
+                           navGrid.blocked[nz * navGrid.width + cx])) {
+                continue;
+            }
+
+            float g = gScore[current] + dirCost[d];
+            if (openStamp[next] != searchStamp || g < gScore[next]) {
+                openStamp[next] = searchStamp;
+                gScore[next] = g;
+                parentCell[next] = current;
+                open.push(OpenEntry(g + octile(next, goal), next));
+            }
+        }
+    }
+    return false;
+}
+
+// Cari index sel path terdekat dari (x, z) yang terlihat langsung
+static int findJoinIndex(const NavPath& path, float x, float z) {
+    int best = -1;
+    float bestDist = 0.0f;
+    int limit = std::min((int)path.cells.size(), NAV_JOIN_SEARCH);
+    for (int k = 0; k < limit; k++) {
+        float cx, cz;
+        navCellCenter(path.cells[k], cx, cz);
+        float d = (cx - x) * (cx - x) + (cz - z) * (cz - z);
+        if ((best < 0 || d < bestDist) && navLineOfSight(x, z, cx, cz)) {
+            best = k;
+            bestDist = d;
+        }
+    }
+    return best;
+}
+
+bool navRequestPath(float x, float z, int goalCell, NavPathRef& ref, int& waypoint) {
+    ref.slot = -1;
+    ref.id = 0;
+
+    int start = navNearestWalkable(navCellAt(x, z), 2);
+    if (start < 0 || !navIsWalkable(goalCell)) {
+        navStats.failures++;
+        return false;
+    }
+    int region = regionOf(start);
+
+    // Coba pakai path yang sudah ada
+    for (int s = 0; s < NAV_PATH_CACHE_SIZE; s++) {
+        NavPath& path = pathCache[s];
+        if (path.id == 0 || path.goalCell != goalCell || path.startRegion != region) continue;
+        int join = findJoinIndex(path, x, z);
+        if (join < 0) continue;
+
+        path.lastUsed = navTick;
+        ref.slot = s;
+        ref.id = path.id;
+        waypoint = join;
+        navStats.cacheHits++;
+        return true;
+    }
+
+    // Pilih slot: yang kosong, atau yang paling lama tidak dipakai
+    int slot = 0;
+    for (int s = 0; s < NAV_PATH_CACHE_SIZE; s++) {
+        if (pathCache[s].id == 0) { slot = s; break; }
+        if (pathCache[s].lastUsed < pathCache[slot].lastUsed) slot = s;
+    }
+
+    NavPath& path = pathCache[slot];
+    path.id = 0;
+    if (!findPath(start, goalCell, path.cells)) {
+        navStats.failures++;
+        return false;
+    }
+    path.id = nextPathId++;
+    if (nextPathId == 0) nextPathId = 1;
+    path.startRegion = region;
+    path.goalCell = goalCell;
+    path.lastUsed = navTick;
+
+    ref.slot = slot;
+    ref.id = path.id;
+    waypoint = 0;
+    return true;
+}
+
+const NavPath* navGetPath(const NavPathRef& ref) {
+    if (ref.slot < 0 || ref.slot >= NAV_PATH_CACHE_SIZE) return nullptr;
+    const NavPath& path = pathCache[ref.slot];
+    if (path.id == 0 || path.id != ref.id) return nullptr;
+    return &path;
+}
+
+bool navRetainPath(const NavPathRef& ref) {
+    if (!navGetPath(ref)) return false;
+    pathCache[ref.slot].lastUsed = navTick;
+    return true;
+}
+
+void navBeginTick() {
+    navTick++;
+}
+
+// Mulai build flow field baru di buffer belakang
+static void startFlowBuild(int goalCell) {
+    FlowBuffer& back = flowBuffers[1 - flowFront];
+    if (++back.buildStamp == 0) {
+        std::fill(back.stamp.begin(), back.stamp.end(), 0u);
+        back.buildStamp = 1;
+    }
+    back.goal = goalCell;
+    back.cost[goalCell] = 0.0f;
+    back.next[goalCell] = goalCell;
+    back.stamp[goalCell] = back.buildStamp;
+
+    flowOpen.clear();
+    flowOpen.push_back(OpenEntry(0.0f, goalCell));
+    flowBuilding = true;
+}
+
+void navFlowUpdate(int goalCell, int budget) {
+    if (navGrid.width == 0) return;
+    if (goalCell >= 0 && navIsWalkable(goalCell)) {
+        flowPendingGoal = goalCell;
+    }
+
+    if (!flowBuilding) {
+        if (flowPendingGoal < 0 || flowPendingGoal == flowBuffers[flowFront].goal) {
+            return; // Field depan sudah untuk tujuan terbaru
+        }
+        startFlowBuild(flowPendingGoal);
+    }
+
+    FlowBuffer& back = flowBuffers[1 - flowFront];
+    std::greater<OpenEntry> cmp;
+
+    // Dijkstra dari goal ke luar; parent = sel berikutnya menuju goal
+    while (!flowOpen.empty() && budget-- > 0) {
+        std::pop_heap(flowOpen.begin(), flowOpen.end(), cmp);
+        OpenEntry top = flowOpen.back();
+        flowOpen.pop_back();
+        int current = top.second;
+        if (top.first > back.cost[current]) continue;   // Entri lama
+
+        int cx = cellX(current), cz = cellZ(current);
+        for (int d = 0; d < 8; d++) {
+            int nx = cx + dirX[d], nz = cz + dirZ[d];
+            if (nx < 0 || nz < 0 || nx >= navGrid.width || nz >= navGrid.height) continue;
+            int neighbor = nz * navGrid.width + nx;
+            if (navGrid.blocked[neighbor]) continue;
+            if (d >= 4 && (navGrid.blocked[cz * navGrid.width + nx] ||
+                           navGrid.blocked[nz * navGrid.width + cx])) {
+                continue;
+            }
+
+            float cost = top.first + dirCost[d];
+            if (cost > NAV_FLOW_MAX_COST) continue;
+            if (back.stamp[neighbor] != back.buildStamp || cost < back.cost[neighbor]) {
+                back.stamp[neighbor] = back.buildStamp;
+                back.cost[neighbor] = cost;
+                back.next[neighbor] = current;
+                flowOpen.push_back(OpenEntry(cost, neighbor));
+                std::push_heap(flowOpen.begin(), flowOpen.end(), cmp);
+            }
+        }
+    }
+
+    if (flowOpen.empty()) {
+        // Build selesai: tukar buffer
+        flowFront = 1 - flowFront;
+        flowBuilding = false;
+        navStats.flowBuilds++;
+    }
+}
+
+int navFlowNext(int cell) {
+    const FlowBuffer& front = flowBuffers[flowFront];
+    if (cell < 0 || front.goal < 0 || front.stamp.empty() ||
+        front.stamp[cell] != front.buildStamp) {
+        return -1;
+    }
+    return front.next[cell];
+}
+
+int navFlowGoal() {
+    return flowBuffers[flowFront].goal;
+}
+
+int navRebuildArea(float minX, float minZ, float maxX, float maxZ) {
+    if (navGrid.width == 0) return 0;
+
+    // Perbesar ke batas region (tile) grid
+    int x0 = (int)std::floor((minX - navGrid.originX) / navGrid.cellSize);
+    int z0 = (int)std::floor((minZ - navGrid.originZ) / navGrid.cellSize);
+    int x1 = (int)std::floor((maxX - navGrid.originX) / navGrid.cellSize);
+    int z1 = (int)std::floor((maxZ - navGrid.originZ) / navGrid.cellSize);
+    x0 = std::max(x0 / NAV_REGION_SIZE * NAV_REGION_SIZE, 0);
+    z0 = std::max(z0 / NAV_REGION_SIZE * NAV_REGION_SIZE, 0);
+    x1 = std::min((x1 / NAV_REGION_SIZE + 1) * NAV_REGION_SIZE - 1, navGrid.width - 1);
+    z1 = std::min((z1 / NAV_REGION_SIZE + 1) * NAV_REGION_SIZE - 1, navGrid.height - 1);
+    if (x0 > x1 || z0 > z1) return 0;
+
+    classifyCells(x0, z0, x1, z1);
+
+    // Path yang melewati area ini mungkin menembus dinding baru
+    for (size_t s = 0; s < pathCache.size(); s++) {
+        NavPath& path = pathCache[s];
+        if (path.id == 0) continue;
+        for (size_t c = 0; c < path.cells.size(); c++) {
+            int cx = cellX(path.cells[c]), cz = cellZ(path.cells[c]);
+            if (cx >= x0 && cx <= x1 && cz >= z0 && cz <= z1) {
+                path.id = 0;
+                path.cells.clear();
+                break;
+            }
+        }
+    }
+
+    // Flow field dibangun ulang untuk tujuan yang sama; field lama tetap
+    // dipakai sampai field baru selesai
+    int goal = flowBuilding ? flowPendingGoal : flowBuffers[flowFront].goal;
+    if (goal >= 0 && navIsWalkable(goal)) {
+        flowPendingGoal = goal;
+        startFlowBuild(goal);
+    }
+
+    return ((x1 - x0) / NAV_REGION_SIZE + 1) * ((z1 - z0) / NAV_REGION_SIZE + 1);
+}
@@ -60,6 +60,7 @@
  * - object.h    - Header file dengan deklarasi struct dan fungsi objek
  * - render.h    - Header untuk fungsi rendering dan tekstur
  * - collision.h - Header untuk sistem collision
+ * - atlas.h     - atlasQuad() untuk dinding, atap dan tangga
  * - GL/glut.h   - Library OpenGL untuk rendering 3D
  * - cmath       - Library math untuk operasi matematika
  * 
@@ -83,6 +84,7 @@
 
 #include "object.h"
 #include "render.h"
+#include "atlas.h"
 #include <vector>
 #define _USE_MATH_DEFINES
 #include <cmath>
@@ -90,13 +92,13 @@
 #include <iostream>
 #include "enemy.h"
 #include "combat.h"
+#include "glstate.h"
 
  
 float angle = 0.0;  
 Player player;  
 
 std::vector<BoundingBox> boundingBoxes; // Vector to store bounding boxes
-GLuint quartzTexture = 0; // Global variable for quartz texture
 
 void createHitbox(float x, float y, float z, float width, 
 float height, float depth) {
@@ -104,7 +106,7 @@ float height, float depth) {
     glPushMatrix();
     glTranslatef(x, y, z);
     glScalef(width, height, depth);
-    glColor3f(1.0f, 0.0f, 0.0f); // Red color for the hitbox
+    glsColor3f(1.0f, 0.0f, 0.0f); // Red color for the hitbox
     glutWireCube(1.0f); // Draw a wireframe cube as the hitbox
     glPopMatrix();
     boundingBoxes.push_back({x, y, z, width, height, depth}); // Store the bounding box
@@ -121,7 +123,7 @@ void drawPlayer(const Player& player, bool isShadow) {
     
     // Badan
     glPushMatrix();
-        if (!isShadow) glColor3f(0.2, 0.6, 0.8); // Blue (only if not shadow)
+        if (!isShadow) glsColor3f(0.2, 0.6, 0.8); // Blue (only if not shadow)
         glTranslatef(0.0f, 1.4f, 0.0f);
         glScalef(0.85f, 1.1f, 0.5f);
         glutSolidCube(1.0f);
@@ -129,7 +131,7 @@ void drawPlayer(const Player& player, bool isShadow) {
 
     // Kepala
     glPushMatrix();
-        if (!isShadow) glColor3f(1.0, 0.8, 0.6); // Warna kulit (hanya jika bukan bayangan)
+        if (!isShadow) glsColor3f(1.0, 0.8, 0.6); // Warna kulit (hanya jika bukan bayangan)
         glTranslatef(0.0f, 2.4f, 0.0f);
         glRotatef(player.headRotation, 0.0f, 1.0f, 0.0f);
         glutSolidSphere(0.5f, 20, 20);
@@ -140,12 +142,12 @@ void drawPlayer(const Player& player, bool isShadow) {
             
             if (!isShadow) {
                 // Bagian putih mata
-                glColor3f(1.0f, 1.0f, 1.0f); // Putih
+                glsColor3f(1.0f, 1.0f, 1.0f); // Putih
                 glutSolidSphere(0.1f, 10, 10);
                 
                 // Pupil
                 glTranslatef(0.0f, 0.0f, 0.08f);
-                glColor3f(0.0f, 0.0f, 0.0f); // Hitam
+                glsColor3f(0.0f, 0.0f, 0.0f); // Hitam
                 glutSolidSphere(0.05f, 8, 8);
             } else {
                 glutSolidSphere(0.1f, 10, 10); // Bayangan mata
@@ -158,12 +160,12 @@ void drawPlayer(const Player& player, bool isShadow) {
             
             // Bagian putih mata
             if (!isShadow) {
-                glColor3f(1.0f, 1.0f, 1.0f); // Putih
+                glsColor3f(1.0f, 1.0f, 1.0f); // Putih
                 glutSolidSphere(0.1f, 10, 10);
                 
                 // Pupil
                 glTranslatef(0.0f, 0.0f, 0.08f);
-                glColor3f(0.0f, 0.0f, 0.0f); // Hitam
+                glsColor3f(0.0f, 0.0f, 0.0f); // Hitam
                 glutSolidSphere(0.05f, 8, 8);
             } else {
                 glutSolidSphere(0.1f, 10, 10); // Bayangan mata
@@ -175,7 +177,7 @@ void drawPlayer(const Player& player, bool isShadow) {
         glPushMatrix();
             if (!isShadow) {
                 glTranslatef(0.0f, -0.23f, 0.45f); // Posisi mulut
-                glColor3f(0.8f, 0.2f, 0.2f); // Merah untuk mulut
+                glsColor3f(0.8f, 0.2f, 0.2f); // Merah untuk mulut
                 
                 // Membuat mulut sebagai elips tipis
                 glScalef(0.2f, 0.05f, 0.05f);
@@ -183,7 +185,7 @@ void drawPlayer(const Player& player, bool isShadow) {
             }
             else {
                 glTranslatef(0.0f, -0.1f, 0.4f); // Posisi mulut
-                glColor3f(0.0f, 0.0f, 0.0f); // Hitam untuk bayangan mulut
+                glsColor3f(0.0f, 0.0f, 0.0f); // Hitam untuk bayangan mulut
                 glScalef(0.2f, 0.05f, 0.05f);
                 glutSolidSphere(0.5f, 10, 10);
             }
@@ -193,7 +195,7 @@ void drawPlayer(const Player& player, bool isShadow) {
     
     // Rambut
     glPushMatrix();
-        if (!isShadow) glColor3f(0.0, 0.0, 0.0); // Warna hitam
+        if (!isShadow) glsColor3f(0.0, 0.0, 0.0); // Warna hitam
         glTranslatef(0.0f, 2.6f, 0.0f);
         glRotatef(player.headRotation, 0.0f, 1.0f, 0.0f); // Rotasi kepala
         
@@ -201,19 +203,19 @@ void drawPlayer(const Player& player, bool isShadow) {
         double clipPlane[] = {0.0, 1.0, 0.0, 0.0}; // Bidang XZ (y = 0)
         
         // Aktifkan clipping plane
-        glEnable(GL_CLIP_PLANE0);
+        glsEnable(GL_CLIP_PLANE0);
         glClipPlane(GL_CLIP_PLANE0, clipPlane);
         
         // Gambar bola
         glutSolidSphere(0.50f, 20, 20);
             
         // Nonaktifkan clipping plane
-        glDisable(GL_CLIP_PLANE0);
+        glsDisable(GL_CLIP_PLANE0);
     glPopMatrix();  
     
     // Left arm - Simpler design
     glPushMatrix();
-        if (!isShadow) glColor3f(0.2, 0.6, 0.8); // Blue (only if not shadow)
+        if (!isShadow) glsColor3f(0.2, 0.6, 0.8); // Blue (only if not shadow)
         
         // Position at body side but not too far to the edge
         glTranslatef(0.5f, 1.9f, 0.0f);
@@ -230,7 +232,7 @@ void drawPlayer(const Player& player, bool isShadow) {
         
         // Draw hand at end of arm
         if (!isShadow) {
-            glColor3f(1.0f, 0.8f, 0.6f); // Skin color
+            glsColor3f(1.0f, 0.8f, 0.6f); // Skin color
             glTranslatef(0.0f, -0.8f, 0.0f);
             glutSolidSphere(0.1f, 8, 8);
         }
@@ -238,7 +240,7 @@ void drawPlayer(const Player& player, bool isShadow) {
 
     // Right arm - Simpler design
     glPushMatrix();
-        if (!isShadow) glColor3f(0.2, 0.6, 0.8); // Blue (only if not shadow)
+        if (!isShadow) glsColor3f(0.2, 0.6, 0.8); // Blue (only if not shadow)
         
         // Position at body side but not too far to the edge
         glTranslatef(-0.5f, 1.9f, 0.0f);
@@ -272,7 +274,7 @@ void drawPlayer(const Player& player, bool isShadow) {
                 drawPistol(true);
             } else {
                 // Draw hand or fist depending on punch state
-                glColor3f(1.0f, 0.8f, 0.6f); // Skin color
+                glsColor3f(1.0f, 0.8f, 0.6f); // Skin color
                 if (player.isPunching) {
                     // Fist (slightly larger and rectangular for punching)
                     glPushMatrix();
@@ -289,7 +291,7 @@ void drawPlayer(const Player& player, bool isShadow) {
 
     // Kaki kiri
     glPushMatrix();
-        glColor3f(0.0, 0.0, 0.0); // Hitam
+        glsColor3f(0.0, 0.0, 0.0); // Hitam
         glTranslatef(-0.2f, 0.8f, 0.0f); // Pindahkan ke pangkal kaki
         glRotatef(player.leftLegRotation, 1.0f, 0.0f, 0.0f); // Rotasi kaki kiri
         glTranslatef(0.0f, -0.4f, 0.0f); // Geser ke bawah untuk menggambar kaki
@@ -299,7 +301,7 @@ void drawPlayer(const Player& player, bool isShadow) {
 
     // Kaki kanan
     glPushMatrix();
-        glColor3f(0.0, 0.0, 0.0);
+        glsColor3f(0.0, 0.0, 0.0);
         glTranslatef(0.2f, 0.8f, 0.0f); // Pindahkan ke pangkal kaki
         glRotatef(player.rightLegRotation, 1.0f, 0.0f, 0.0f); // Rotasi kaki kanan
         glTranslatef(0.0f, -0.4f, 0.0f); // Geser ke bawah untuk menggambar kaki
@@ -311,9 +313,6 @@ void drawPlayer(const Player& player, bool isShadow) {
 }
 
 void drawWall( GLfloat x1, GLfloat z1,  GLfloat x2, GLfloat z2, GLfloat y, GLfloat height, GLfloat thickness  ) {
-    // Ensure texture is loaded
-    if (woodTexture == 0) return;
-    
     // Calculate length and angle
     float dx = x2 - x1;
     float dz = z2 - z1;   
@@ -332,9 +331,8 @@ void drawWall( GLfloat x1, GLfloat z1,  GLfloat x2, GLfloat z2, GLfloat y, GLflo
     };
     boundingBoxes.push_back(box);
     
-    // Enable texturing
-    glEnable(GL_TEXTURE_2D);
-    glBindTexture(GL_TEXTURE_2D, woodTexture);
+    // Enable texturing (atlas sudah ter-bind, lihat renderScene)
+    glsEnable(GL_TEXTURE_2D);
     
     // Define texture scale
     float textureScale = 2.0f;
@@ -349,73 +347,50 @@ void drawWall( GLfloat x1, GLfloat z1,  GLfloat x2, GLfloat z2, GLfloat y, GLflo
     glRotatef(angle, 0.0f, 1.0f, 0.0f);
     
     // Draw the wall as a box
-    glColor3f(1.0f, 1.0f, 1.0f); // White for proper texture display
+    glsColor3f(1.0f, 1.0f, 1.0f); // White for proper texture display
     
     // Front face
-    glBegin(GL_QUADS);
     glNormal3f(0.0f, 0.0f, 1.0f);
-    glTexCoord2f(0.0f, 0.0f); glVertex3f(0.0f, 0.0f, thickness);
-    glTexCoord2f(repeatLength, 0.0f); glVertex3f(length, 0.0f, thickness);
-    glTexCoord2f(repeatLength, repeatHeight); glVertex3f(length, height, thickness);
-    glTexCoord2f(0.0f, repeatHeight); glVertex3f(0.0f, height, thickness);
-    glEnd();
+    const GLfloat frontFace[4][3] = {{0.0f, 0.0f, thickness}, {length, 0.0f, thickness},
+                                     {length, height, thickness}, {0.0f, height, thickness}};
+    atlasQuad(ATLAS_QUARTZ, frontFace, repeatLength, repeatHeight);
     
     // Back face
-    glBegin(GL_QUADS);
     glNormal3f(0.0f, 0.0f, -1.0f);
-    glTexCoord2f(0.0f, 0.0f); glVertex3f(0.0f, 0.0f, 0.0f);
-    glTexCoord2f(repeatLength, 0.0f); glVertex3f(length, 0.0f, 0.0f);
-    glTexCoord2f(repeatLength, repeatHeight); glVertex3f(length, height, 0.0f);
-    glTexCoord2f(0.0f, repeatHeight); glVertex3f(0.0f, height, 0.0f);
-    glEnd();
+    const GLfloat backFace[4][3] = {{0.0f, 0.0f, 0.0f}, {length, 0.0f, 0.0f},
+                                    {length, height, 0.0f}, {0.0f, height, 0.0f}};
+    atlasQuad(ATLAS_QUARTZ, backFace, repeatLength, repeatHeight);
     
     // Top face
-    glBegin(GL_QUADS);
     glNormal3f(0.0f, 1.0f, 0.0f);
-    glTexCoord2f(0.0f, 0.0f); glVertex3f(0.0f, height, 0.0f);
-    glTexCoord2f(repeatLength, 0.0f); glVertex3f(length, height, 0.0f);
-    glTexCoord2f(repeatLength, repeatThickness); glVertex3f(length, height, thickness);
-    glTexCoord2f(0.0f, repeatThickness); glVertex3f(0.0f, height, thickness);
-    glEnd();
+    const GLfloat topFace[4][3] = {{0.0f, height, 0.0f}, {length, height, 0.0f},
+                                   {length, height, thickness}, {0.0f, height, thickness}};
+    atlasQuad(ATLAS_QUARTZ, topFace, repeatLength, repeatThickness);
     
     // Bottom face
-    glBegin(GL_QUADS);
     glNormal3f(0.0f, -1.0f, 0.0f);
-    glTexCoord2f(0.0f, 0.0f); glVertex3f(0.0f, 0.0f, 0.0f);
-    glTexCoord2f(repeatLength, 0.0f); glVertex3f(length, 0.0f, 0.0f);
-    glTexCoord2f(repeatLength, repeatThickness); glVertex3f(length, 0.0f, thickness);
-    glTexCoord2f(0.0f, repeatThickness); glVertex3f(0.0f, 0.0f, thickness);
-    glEnd();
+    const GLfloat bottomFace[4][3] = {{0.0f, 0.0f, 0.0f}, {length, 0.0f, 0.0f},
+                                      {length, 0.0f, thickness}, {0.0f, 0.0f, thickness}};
+    atlasQuad(ATLAS_QUARTZ, bottomFace, repeatLength, repeatThickness);
     
     // Left face
-    glBegin(GL_QUADS);
     glNormal3f(-1.0f, 0.0f, 0.0f);
-    glTexCoord2f(0.0f, 0.0f); glVertex3f(0.0f, 0.0f, 0.0f);
-    glTexCoord2f(repeatThickness, 0.0f); glVertex3f(0.0f, 0.0f, thickness);
-    glTexCoord2f(repeatThickness, repeatHeight); glVertex3f(0.0f, height, thickness);
-    glTexCoord2f(0.0f, repeatHeight); glVertex3f(0.0f, height, 0.0f);
-    glEnd();
+    const GLfloat leftFace[4][3] = {{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, thickness},
+                                    {0.0f, height, thickness}, {0.0f, height, 0.0f}};
+    atlasQuad(ATLAS_QUARTZ, leftFace, repeatThickness, repeatHeight);
     
     // Right face
-    glBegin(GL_QUADS);
     glNormal3f(1.0f, 0.0f, 0.0f);
-    glTexCoord2f(0.0f, 0.0f); glVertex3f(length, 0.0f, 0.0f);
-    glTexCoord2f(repeatThickness, 0.0f); glVertex3f(length, 0.0f, thickness);
-    glTexCoord2f(repeatThickness, repeatHeight); glVertex3f(length, height, thickness);
-    glTexCoord2f(0.0f, repeatHeight); glVertex3f(length, height, 0.0f);
-    glEnd();
+    const GLfloat rightFace[4][3] = {{length, 0.0f, 0.0f}, {length, 0.0f, thickness},
+                                     {length, height, thickness}, {length, height, 0.0f}};
+    atlasQuad(ATLAS_QUARTZ, rightFace, repeatThickness, repeatHeight);
     
     glPopMatrix();
     
-    glDisable(GL_TEXTURE_2D);
+    glsDisable(GL_TEXTURE_2D);
 }
 
 void drawRooftop(float x1, float z1, float x2, float z2, float y, float thickness) {
-    // Ensure texture is loaded
-    if (quartzTexture == 0) {
-        quartzTexture = loadBMP("texture/quartz-block.bmp");
-    }
-    
     // Calculate dimensions
     float width = fabs(x2 - x1);
     float length = fabs(z2 - z1);
@@ -427,68 +402,49 @@ void drawRooftop(float x1, float z1, float x2, float z2, float y, float thicknes
     float repeatThickness = thickness * textureScale;
     
     // Aktifkan tekstur
-    glEnable(GL_TEXTURE_2D);
-    glBindTexture(GL_TEXTURE_2D, quartzTexture);
+    glsEnable(GL_TEXTURE_2D);
     
     // Gambar permukaan atas rooftop dengan tekstur
-    glColor3f(1.0f, 1.0f, 1.0f); // White for proper texture display
+    glsColor3f(1.0f, 1.0f, 1.0f); // White for proper texture display
     
     // Top face (atas)
-    glBegin(GL_QUADS);
     glNormal3f(0.0f, 1.0f, 0.0f);
-    glTexCoord2f(0.0f, 0.0f); glVertex3f(x1, y, z1);
-    glTexCoord2f(repeatWidth, 0.0f); glVertex3f(x2, y, z1);
-    glTexCoord2f(repeatWidth, repeatLength); glVertex3f(x2, y, z2);
-    glTexCoord2f(0.0f, repeatLength); glVertex3f(x1, y, z2);
-    glEnd();
+    const GLfloat topFace[4][3] = {{x1, y, z1}, {x2, y, z1},
+                                   {x2, y, z2}, {x1, y, z2}};
+    atlasQuad(ATLAS_QUARTZ, topFace, repeatWidth, repeatLength);
     
     // Bottom face (bawah)
-    glBegin(GL_QUADS);
     glNormal3f(0.0f, -1.0f, 0.0f);
-    glTexCoord2f(0.0f, 0.0f); glVertex3f(x1, y-thickness, z1);
-    glTexCoord2f(repeatWidth, 0.0f); glVertex3f(x2, y-thickness, z1);
-    glTexCoord2f(repeatWidth, repeatLength); glVertex3f(x2, y-thickness, z2);
-    glTexCoord2f(0.0f, repeatLength); glVertex3f(x1, y-thickness, z2);
-    glEnd();
+    const GLfloat bottomFace[4][3] = {{x1, y-thickness, z1}, {x2, y-thickness, z1},
+                                      {x2, y-thickness, z2}, {x1, y-thickness, z2}};
+    atlasQuad(ATLAS_QUARTZ, bottomFace, repeatWidth, repeatLength);
     
     // Front face (depan - z1)
-    glBegin(GL_QUADS);
     glNormal3f(0.0f, 0.0f, 1.0f);
-    glTexCoord2f(0.0f, 0.0f); glVertex3f(x1, y-thickness, z1);
-    glTexCoord2f(repeatWidth, 0.0f); glVertex3f(x2, y-thickness, z1);
-    glTexCoord2f(repeatWidth, repeatThickness); glVertex3f(x2, y, z1);
-    glTexCoord2f(0.0f, repeatThickness); glVertex3f(x1, y, z1);
-    glEnd();
+    const GLfloat frontFace[4][3] = {{x1, y-thickness, z1}, {x2, y-thickness, z1},
+                                     {x2, y, z1}, {x1, y, z1}};
+    atlasQuad(ATLAS_QUARTZ, frontFace, repeatWidth, repeatThickness);
     
     // Back face (belakang - z2)
-    glBegin(GL_QUADS);
     glNormal3f(0.0f, 0.0f, -1.0f);
-    glTexCoord2f(0.0f, 0.0f); glVertex3f(x1, y-thickness, z2);
-    glTexCoord2f(repeatWidth, 0.0f); glVertex3f(x2, y-thickness, z2);
-    glTexCoord2f(repeatWidth, repeatThickness); glVertex3f(x2, y, z2);
-    glTexCoord2f(0.0f, repeatThickness); glVertex3f(x1, y, z2);
-    glEnd();
+    const GLfloat backFace[4][3] = {{x1, y-thickness, z2}, {x2, y-thickness, z2},
+                                    {x2, y, z2}, {x1, y, z2}};
+    atlasQuad(ATLAS_QUARTZ, backFace, repeatWidth, repeatThickness);
     
     // Left face (kiri - x1)
-    glBegin(GL_QUADS);
     glNormal3f(1.0f, 0.0f, 0.0f);
-    glTexCoord2f(0.0f, 0.0f); glVertex3f(x1, y-thickness, z1);
-    glTexCoord2f(repeatLength, 0.0f); glVertex3f(x1, y-thickness, z2);
-    glTexCoord2f(repeatLength, repeatThickness); glVertex3f(x1, y, z2);
-    glTexCoord2f(0.0f, repeatThickness); glVertex3f(x1, y, z1);
-    glEnd();
+    const GLfloat leftFace[4][3] = {{x1, y-thickness, z1}, {x1, y-thickness, z2},
+                                    {x1, y, z2}, {x1, y, z1}};
+    atlasQuad(ATLAS_QUARTZ, leftFace, repeatLength, repeatThickness);
     
     // Right face (kanan - x2)
-    glBegin(GL_QUADS);
     glNormal3f(-1.0f, 0.0f, 0.0f);
-    glTexCoord2f(0.0f, 0.0f); glVertex3f(x2, y-thickness, z1);
-    glTexCoord2f(repeatLength, 0.0f); glVertex3f(x2, y-thickness, z2);
-    glTexCoord2f(repeatLength, repeatThickness); glVertex3f(x2, y, z2);
-    glTexCoord2f(0.0f, repeatThickness); glVertex3f(x2, y, z1);
-    glEnd();
+    const GLfloat rightFace[4][3] = {{x2, y-thickness, z1}, {x2, y-thickness, z2},
+                                     {x2, y, z2}, {x2, y, z1}};
+    atlasQuad(ATLAS_QUARTZ, rightFace, repeatLength, repeatThickness);
 
     // Nonaktifkan tekstur
-    glDisable(GL_TEXTURE_2D);
+    glsDisable(GL_TEXTURE_2D);
 }
 
 void drawSolidCylinder(GLfloat radius, GLfloat height, int slices, int stacks)
@@ -500,16 +456,13 @@ void drawSolidCylinder(GLfloat radius, GLfloat height, int slices, int stacks)
 }
 
 void drawTree(float x, float z) {
-    // Draw tree shadow first
-    drawTreeShadow(x, z, 1.0f);
-    
     // Pohon
     glPushMatrix();
     glTranslatef(x, 0, z);
 
     // Batang pohon
     glPushMatrix();
-    glColor3f(0.5f, 0.35f, 0.05f); // Warna coklat
+    glsColor3f(0.5f, 0.35f, 0.05f); // Warna coklat
     glRotatef(-90, 1, 0, 0);
     drawSolidCylinder(0.2, 2, 20, 20); // radius, height, slices, stacks
     glPopMatrix();
@@ -517,7 +470,7 @@ void drawTree(float x, float z) {
     // Daun pohon
     glPushMatrix();
     glTranslatef(0, 2, 0);
-    glColor3f(0.0f, 0.5f, 0.0f);
+    glsColor3f(0.0f, 0.5f, 0.0f);
     glRotatef(-90, 1, 0, 0);     // Warna hijau
     glutSolidCone(1, 2, 20, 20); // base, height, slices, stacks
     glPopMatrix();
@@ -525,7 +478,7 @@ void drawTree(float x, float z) {
     // Daun pohon
     glPushMatrix();
     glTranslatef(0, 1.5, 0);
-    glColor3f(0.0f, 0.5f, 0.0f);
+    glsColor3f(0.0f, 0.5f, 0.0f);
     glRotatef(-90, 1, 0, 0);     // Warna hijau
     glutSolidCone(1, 2, 20, 20); // base, height, slices, stacks
     glPopMatrix();
@@ -533,7 +486,7 @@ void drawTree(float x, float z) {
     // Daun pohon
     glPushMatrix();
     glTranslatef(0, 1, 0);
-    glColor3f(0.0f, 0.5f, 0.0f);
+    glsColor3f(0.0f, 0.5f, 0.0f);
     glRotatef(-90, 1, 0, 0);     // Warna hijau
     glutSolidCone(1, 2, 20, 20); // base, height, slices, stacks
     glPopMatrix();
@@ -563,7 +516,7 @@ void drawFence(float startX, float startZ, float endX, float endZ, float height,
     // Rotasi untuk mengarah ke titik akhir
     glRotatef(angle, 0.0f, 1.0f, 0.0f);
     
-    glColor3f(0.5f, 0.35f, 0.05f); // Warna coklat untuk pagar kayu
+    glsColor3f(0.5f, 0.35f, 0.05f); // Warna coklat untuk pagar kayu
     
     // Hitung jarak antar tiang
     float postSpacing = length / (float)(numPosts - 1);
@@ -608,17 +561,11 @@ void drawFence(float startX, float startZ, float endX, float endZ, float height,
 }
 
 void drawStaircase(float startX, float startZ, float width, float stepDepth, float stepHeight, int numSteps, float baseY) {
-    // Ensure texture is loaded
-    if (woodTexture == 0) {
-        woodTexture = loadBMP("texture/quartz-block.bmp");
-    }
-    
     // Enable texturing
-    glEnable(GL_TEXTURE_2D);
-    glBindTexture(GL_TEXTURE_2D, woodTexture);
+    glsEnable(GL_TEXTURE_2D);
     
     // Draw each step
-    glColor3f(1.0f, 1.0f, 1.0f);  // White for proper texture display
+    glsColor3f(1.0f, 1.0f, 1.0f);  // White for proper texture display
     // Define texture coordinates
     float textureScale = 1.0f;
     float repeatWidth = width * textureScale;
@@ -632,41 +579,29 @@ void drawStaircase(float startX, float startZ, float width, float stepDepth, flo
         // Draw horizontal part (tread)
         glPushMatrix();
         // Top face of step
-        glBegin(GL_QUADS);
         glNormal3f(0.0f, 1.0f, 0.0f);
-        glTexCoord2f(0.0f, 0.0f); glVertex3f(startX, currentHeight + stepHeight, stepZ);
-        glTexCoord2f(repeatWidth, 0.0f); glVertex3f(startX + width, currentHeight + stepHeight, stepZ);
-        glTexCoord2f(repeatWidth, repeatDepth); glVertex3f(startX + width, currentHeight + stepHeight, stepZ + stepDepth);
-        glTexCoord2f(0.0f, repeatDepth); glVertex3f(startX, currentHeight + stepHeight, stepZ + stepDepth);
-        glEnd();
+        const GLfloat topFace[4][3] = {{startX, currentHeight + stepHeight, stepZ}, {startX + width, currentHeight + stepHeight, stepZ},
+                                       {startX + width, currentHeight + stepHeight, stepZ + stepDepth}, {startX, currentHeight + stepHeight, stepZ + stepDepth}};
+        atlasQuad(ATLAS_QUARTZ, topFace, repeatWidth, repeatDepth);
         
         // Front face of step (riser)
-        glBegin(GL_QUADS);
         glNormal3f(0.0f, 0.0f, 1.0f);
-        glTexCoord2f(0.0f, 0.0f); glVertex3f(startX, currentHeight, stepZ);
-        glTexCoord2f(repeatWidth, 0.0f); glVertex3f(startX + width, currentHeight, stepZ);
-        glTexCoord2f(repeatWidth, repeatHeight); glVertex3f(startX + width, currentHeight + stepHeight, stepZ);
-        glTexCoord2f(0.0f, repeatHeight); glVertex3f(startX, currentHeight + stepHeight, stepZ);
-        glEnd();
+        const GLfloat frontFace[4][3] = {{startX, currentHeight, stepZ}, {startX + width, currentHeight, stepZ},
+                                         {startX + width, currentHeight + stepHeight, stepZ}, {startX, currentHeight + stepHeight, stepZ}};
+        atlasQuad(ATLAS_QUARTZ, frontFace, repeatWidth, repeatHeight);
         
         // Side faces (left and right)
         // Left side
-        glBegin(GL_QUADS);
         glNormal3f(-1.0f, 0.0f, 0.0f);
-        glTexCoord2f(0.0f, 0.0f); glVertex3f(startX, currentHeight, stepZ);
-        glTexCoord2f(repeatDepth, 0.0f); glVertex3f(startX, currentHeight, stepZ + stepDepth);
-        glTexCoord2f(repeatDepth, repeatHeight); glVertex3f(startX, currentHeight + stepHeight, stepZ + stepDepth);
-        glTexCoord2f(0.0f, repeatHeight); glVertex3f(startX, currentHeight + stepHeight, stepZ);
-        glEnd();
+        const GLfloat leftFace[4][3] = {{startX, currentHeight, stepZ}, {startX, currentHeight, stepZ + stepDepth},
+                                        {startX, currentHeight + stepHeight, stepZ + stepDepth}, {startX, currentHeight + stepHeight, stepZ}};
+        atlasQuad(ATLAS_QUARTZ, leftFace, repeatDepth, repeatHeight);
         
         // Right side
-        glBegin(GL_QUADS);
         glNormal3f(1.0f, 0.0f, 0.0f);
-        glTexCoord2f(0.0f, 0.0f); glVertex3f(startX + width, currentHeight, stepZ);
-        glTexCoord2f(repeatDepth, 0.0f); glVertex3f(startX + width, currentHeight, stepZ + stepDepth);
-        glTexCoord2f(repeatDepth, repeatHeight); glVertex3f(startX + width, currentHeight + stepHeight, stepZ + stepDepth);
-        glTexCoord2f(0.0f, repeatHeight); glVertex3f(startX + width, currentHeight + stepHeight, stepZ);
-        glEnd();
+        const GLfloat rightFace[4][3] = {{startX + width, currentHeight, stepZ}, {startX + width, currentHeight, stepZ + stepDepth},
+                                         {startX + width, currentHeight + stepHeight, stepZ + stepDepth}, {startX + width, currentHeight + stepHeight, stepZ}};
+        atlasQuad(ATLAS_QUARTZ, rightFace, repeatDepth, repeatHeight);
         glPopMatrix();
     }
     
@@ -693,7 +628,7 @@ void drawStaircase(float startX, float startZ, float width, float stepDepth, flo
     // glEnd();
     
     // Disable texturing
-    glDisable(GL_TEXTURE_2D);
+    glsDisable(GL_TEXTURE_2D);
 }
 
 Player createPlayer(const std::string& name, float x, float y, float z) {
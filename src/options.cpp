@@ -0,0 +1,171 @@
+/*
+ * ==========================================================================
+ * COMMAND LINE OPTIONS
+ * ==========================================================================
+ *
+ * File: options.cpp
+ * Author: Project Team
+ * Date: June 2025
+ *
+ * DESCRIPTION:
+ * -----------
+ * Membaca argumen command line ke struct GameOptions.
+ *
+ * OPTIONS:
+ * -------
+ * --ai-threads N   - Jumlah thread untuk update AI musuh
+ *                    (0 = sesuai jumlah core, 1 = serial). Default 0.
+ * --seed N         - Master seed RNG (lihat random.h). Tanpa opsi ini seed
+ *                    diambil dari waktu startup dan dicetak ke console.
+ * --lod-bands N,F  - Batas jarak LOD simulasi musuh. Di bawah N (atau
+ *                    terlihat kamera dan di bawah F) update setiap tick,
+ *                    di bawah F setiap 4 tick, sisanya setiap 16 tick.
+ *                    Default 30,80.
+ * --scenery-density F - Pengali jumlah pohon, semak dan batu (jarak antar
+ *                    objek dibagi sqrt(F)). Default 1.0; 80 = ~2700 objek
+ *                    per chunk 64x64.
+ * --chunk-radius R - Chunk dunia dalam jarak R dari player dimuat di
+ *                    background (lihat world.cpp). Default 160.
+ * --chunk-budget-mb N - Batas perkiraan memori chunk; chunk terjauh dibuang
+ *                    lebih dulu. Default 64.
+ * --anisotropy N   - Tingkat filter anisotropik tekstur (dibatasi maksimum
+ *                    driver; diabaikan jika extension tidak ada). 1 = mati,
+ *                    berguna untuk renderer software. Default 8.
+ * --level PATH     - File level biner. Default levels/town.lvl; jika gagal
+ *                    dimuat dipakai layout bawaan (initMap).
+ * --convert-level IN OUT - Konversi level teks IN menjadi biner OUT lalu
+ *                    keluar tanpa membuka window (lihat level.cpp).
+ * --world-cache PATH - File cache dunia hasil generate (lihat worldcache.cpp).
+ *                    Hanya dipakai bersama --seed. Default world.cache.
+ * --no-world-cache - Selalu jalankan generator, tanpa membaca/menulis cache.
+ * --startup-report - Cetak waktu setiap task startup dan critical path
+ *                    setelah semua aset dimuat (lihat loader.cpp).
+ * --shadow-quality N - Bayangan matahari (lihat shadow.cpp): 0 = blob
+ *                    shadow (mesin low-end), 1 = shadow map 1024 tanpa
+ *                    PCF, 2 = 2048 + PCF, 3 = 4096 + PCF. Default 2.
+ * --glsl N         - Jalur lighting (lihat shader.cpp): 330 = GLSL 3.30 +
+ *                    uniform buffer, 120 = GLSL 1.20, 0 = fixed-function.
+ *                    Default: versi tertinggi yang didukung driver.
+ *
+ * ==========================================================================
+ */
+
+#include "options.h"
+#include <cstdlib>
+#include <cstring>
+#include <cstdio>
+#include <iostream>
+
+GameOptions gameOptions = {
+    0,      // aiThreads
+    0,      // seed
+    false,  // seedSet
+    30.0f,  // lodNearDistance
+    80.0f,  // lodFarDistance
+    1.0f,   // sceneryDensity
+    160.0f, // chunkRadius
+    64,     // chunkBudgetMB
+    8,      // anisotropy
+    "levels/town.lvl",  // levelPath
+    nullptr,    // convertInput
+    nullptr,    // convertOutput
+    "world.cache",  // worldCachePath
+    false,      // startupReport
+    2,          // shadowQuality
+    -1          // glslVersion
+};
+
+// Ambil nilai integer untuk opsi di argv[i + 1]
+static bool readIntArg(int argc, char** argv, int& i, int& out) {
+    if (i + 1 >= argc) {
+        std::cerr << "Option " << argv[i] << " needs a value" << std::endl;
+        return false;
+    }
+    out = std::atoi(argv[++i]);
+    return true;
+}
+
+void parseOptions(int argc, char** argv) {
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--ai-threads") == 0) {
+            if (readIntArg(argc, argv, i, gameOptions.aiThreads) && gameOptions.aiThreads < 0) {
+                gameOptions.aiThreads = 0;
+            }
+        } else if (std::strcmp(argv[i], "--seed") == 0) {
+            if (i + 1 < argc) {
+                gameOptions.seed = std::strtoull(argv[++i], nullptr, 0);
+                gameOptions.seedSet = true;
+            } else {
+                std::cerr << "Option --seed needs a value" << std::endl;
+            }
+        } else if (std::strcmp(argv[i], "--scenery-density") == 0) {
+            if (i + 1 < argc && std::atof(argv[i + 1]) > 0.0) {
+                gameOptions.sceneryDensity = (float)std::atof(argv[++i]);
+            } else {
+                std::cerr << "Option --scenery-density needs a positive value" << std::endl;
+                if (i + 1 < argc) i++;
+            }
+        } else if (std::strcmp(argv[i], "--chunk-radius") == 0) {
+            if (i + 1 < argc && std::atof(argv[i + 1]) > 0.0) {
+                gameOptions.chunkRadius = (float)std::atof(argv[++i]);
+            } else {
+                std::cerr << "Option --chunk-radius needs a positive value" << std::endl;
+                if (i + 1 < argc) i++;
+            }
+        } else if (std::strcmp(argv[i], "--chunk-budget-mb") == 0) {
+            if (readIntArg(argc, argv, i, gameOptions.chunkBudgetMB) && gameOptions.chunkBudgetMB < 1) {
+                gameOptions.chunkBudgetMB = 1;
+            }
+        } else if (std::strcmp(argv[i], "--anisotropy") == 0) {
+            if (readIntArg(argc, argv, i, gameOptions.anisotropy) && gameOptions.anisotropy < 1) {
+                gameOptions.anisotropy = 1;
+            }
+        } else if (std::strcmp(argv[i], "--level") == 0) {
+            if (i + 1 < argc) {
+                gameOptions.levelPath = argv[++i];
+            } else {
+                std::cerr << "Option --level needs a path" << std::endl;
+            }
+        } else if (std::strcmp(argv[i], "--convert-level") == 0) {
+            if (i + 2 < argc) {
+                gameOptions.convertInput = argv[++i];
+                gameOptions.convertOutput = argv[++i];
+            } else {
+                std::cerr << "Option --convert-level needs IN and OUT paths" << std::endl;
+                i = argc;
+            }
+        } else if (std::strcmp(argv[i], "--world-cache") == 0) {
+            if (i + 1 < argc) {
+                gameOptions.worldCachePath = argv[++i];
+            } else {
+                std::cerr << "Option --world-cache needs a path" << std::endl;
+            }
+        } else if (std::strcmp(argv[i], "--no-world-cache") == 0) {
+            gameOptions.worldCachePath = nullptr;
+        } else if (std::strcmp(argv[i], "--startup-report") == 0) {
+            gameOptions.startupReport = true;
+        } else if (std::strcmp(argv[i], "--shadow-quality") == 0) {
+            if (readIntArg(argc, argv, i, gameOptions.shadowQuality)) {
+                if (gameOptions.shadowQuality < 0) gameOptions.shadowQuality = 0;
+                if (gameOptions.shadowQuality > 3) gameOptions.shadowQuality = 3;
+            }
+        } else if (std::strcmp(argv[i], "--glsl") == 0) {
+            if (readIntArg(argc, argv, i, gameOptions.glslVersion)
+                && gameOptions.glslVersion != 0 && gameOptions.glslVersion != 120 && gameOptions.glslVersion != 330) {
+                std::cerr << "Option --glsl needs 330, 120 or 0" << std::endl;
+                gameOptions.glslVersion = -1;
+            }
+        } else if (std::strcmp(argv[i], "--lod-bands") == 0) {
+            float nearDist, farDist;
+            if (i + 1 < argc && std::sscanf(argv[++i], "%f,%f", &nearDist, &farDist) == 2
+                && nearDist >= 0.0f && farDist >= nearDist) {
+                gameOptions.lodNearDistance = nearDist;
+                gameOptions.lodFarDistance = farDist;
+            } else {
+                std::cerr << "Option --lod-bands needs NEAR,FAR with 0 <= NEAR <= FAR" << std::endl;
+            }
+        } else {
+            std::cerr << "Unknown option: " << argv[i] << std::endl;
+        }
+    }
+}
@@ -0,0 +1,130 @@
+/*
+ * ==========================================================================
+ * POISSON-DISK SAMPLING
+ * ==========================================================================
+ *
+ * File: poisson.cpp
+ * Author: Project Team
+ * Date: June 2025
+ *
+ * DESCRIPTION:
+ * -----------
+ * Implementasi Bridson (2007) "Fast Poisson Disk Sampling in Arbitrary
+ * Dimensions" untuk 2D. Grid latar dengan sel radius/sqrt(2) menyimpan
+ * paling banyak satu titik per sel, jadi cek jarak cukup melihat 5x5 sel
+ * di sekitar kandidat dan total waktunya O(jumlah titik).
+ *
+ * FUNCTIONS:
+ * ---------
+ * poissonDiskSample() - Mengisi area dengan titik berjarak minimal radius
+ *
+ * DEPENDENCIES:
+ * -----------
+ * - random.h - Stream RNG
+ *
+ * ==========================================================================
+ */
+
+#include "poisson.h"
+#include <cmath>
+#include <algorithm>
+
+namespace {
+
+// Grid latar: satu titik per sel (posisi disalin ke sel)
+struct PoissonGrid {
+    float minX, minZ, cellSize;
+    int width, height;
+    std::vector<PoissonPoint> cellPoint;
+    std::vector<unsigned char> cellUsed;
+
+    int cellX(float x) const { return (int)((x - minX) / cellSize); }
+    int cellZ(float z) const { return (int)((z - minZ) / cellSize); }
+};
+
+void initGrid(PoissonGrid& grid, float minX, float minZ, float maxX, float maxZ, float radius) {
+    grid.minX = minX;
+    grid.minZ = minZ;
+    grid.cellSize = radius / std::sqrt(2.0f);
+    grid.width = (int)std::ceil((maxX - minX) / grid.cellSize);
+    grid.height = (int)std::ceil((maxZ - minZ) / grid.cellSize);
+    grid.cellPoint.assign((size_t)grid.width * grid.height, PoissonPoint());
+    grid.cellUsed.assign((size_t)grid.width * grid.height, 0);
+}
+
+// true jika tidak ada titik lain dalam radius dari (x, z)
+bool isFarEnough(const PoissonGrid& grid, float x, float z, float radiusSq) {
+    int cx = grid.cellX(x), cz = grid.cellZ(z);
+    for (int gz = std::max(cz - 2, 0); gz <= std::min(cz + 2, grid.height - 1); gz++) {
+        for (int gx = std::max(cx - 2, 0); gx <= std::min(cx + 2, grid.width - 1); gx++) {
+            size_t cell = (size_t)gz * grid.width + gx;
+            if (!grid.cellUsed[cell]) continue;
+            float dx = grid.cellPoint[cell].x - x, dz = grid.cellPoint[cell].z - z;
+            if (dx * dx + dz * dz < radiusSq) return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+void poissonDiskSample(float minX, float minZ, float maxX, float maxZ, float radius,
+                       RandomStream& rng, const PoissonAcceptFunc& accept,
+                       std::vector<PoissonPoint>& out, int attemptsPerPoint) {
+    if (radius <= 0.0f || maxX <= minX || maxZ <= minZ) return;
+
+    PoissonGrid grid;
+    initGrid(grid, minX, minZ, maxX, maxZ, radius);
+    float radiusSq = radius * radius;
+
+    // Titik yang sudah ada di out tidak ikut dicek jaraknya
+    std::vector<PoissonPoint> points;
+    std::vector<int> active;
+
+    // Kandidat harus jatuh di dalam area
+    auto tryAdd = [&](float x, float z) {
+        if (x < minX || x >= maxX || z < minZ || z >= maxZ) return false;
+        if (!isFarEnough(grid, x, z, radiusSq)) return false;
+        if (!accept(x, z)) return false;
+
+        PoissonPoint p = {x, z};
+        size_t cell = (size_t)grid.cellZ(z) * grid.width + grid.cellX(x);
+        grid.cellPoint[cell] = p;
+        grid.cellUsed[cell] = 1;
+        active.push_back((int)points.size());
+        points.push_back(p);
+        return true;
+    };
+
+    // Titik awal: satu percobaan per sel kasar (8 x radius) sehingga area
+    // yang terpisah oleh zona terlarang tetap mendapat titik
+    float seedSize = radius * 8.0f;
+    for (float sz = minZ; sz < maxZ; sz += seedSize) {
+        for (float sx = minX; sx < maxX; sx += seedSize) {
+            float x = rng.range(sx, std::min(sx + seedSize, maxX));
+            float z = rng.range(sz, std::min(sz + seedSize, maxZ));
+            tryAdd(x, z);
+        }
+    }
+
+    while (!active.empty()) {
+        int slot = rng.nextInt((int)active.size());
+        const PoissonPoint origin = points[active[slot]];
+        bool placed = false;
+
+        for (int attempt = 0; attempt < attemptsPerPoint && !placed; attempt++) {
+            // Kandidat di cincin [radius, 2 * radius] dari origin
+            float angle = rng.range(0.0f, 6.2831853f);
+            float dist = rng.range(radius, radius * 2.0f);
+            placed = tryAdd(origin.x + std::cos(angle) * dist, origin.z + std::sin(angle) * dist);
+        }
+
+        if (!placed) {
+            // Titik ini sudah tidak bisa memunculkan tetangga baru
+            active[slot] = active.back();
+            active.pop_back();
+        }
+    }
+
+    out.insert(out.end(), points.begin(), points.end());
+}
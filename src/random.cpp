@@ -0,0 +1,119 @@
+/*
+ * ==========================================================================
+ * RANDOM NUMBER STREAMS
+ * ==========================================================================
+ *
+ * File: random.cpp
+ * Author: Project Team
+ * Date: June 2025
+ *
+ * DESCRIPTION:
+ * -----------
+ * Pengganti rand()/srand() berbasis Philox4x32-10 (Salmon et al., 2011).
+ * Philox adalah RNG counter-based: output = bijection(counter, key), jadi
+ * stream berbeda cukup dibedakan dari isi counter tanpa state bersama.
+ *
+ * - Key     : master seed 64-bit (dari --seed atau waktu startup)
+ * - Counter : {nomor blok lo, nomor blok hi, sub-stream, id stream}
+ *
+ * Dengan seed yang sama, setiap stream menghasilkan deret yang sama
+ * tanpa peduli urutan atau thread mana yang memakainya.
+ *
+ * FUNCTIONS:
+ * ---------
+ * initRandom()        - Set master seed
+ * getMasterSeed()     - Ambil master seed (untuk ditampilkan/dicatat)
+ * makeRandomStream()  - Buat stream (id, sub)
+ * randomU32At()       - Ambil satu word dari posisi tertentu di stream
+ *
+ * ==========================================================================
+ */
+
+#include "random.h"
+
+static uint32_t seedKey[2] = {0u, 0u};
+
+// Konstanta Philox4x32
+static const uint32_t PHILOX_M0 = 0xD2511F53u;
+static const uint32_t PHILOX_M1 = 0xCD9E8D57u;
+static const uint32_t PHILOX_W0 = 0x9E3779B9u;
+static const uint32_t PHILOX_W1 = 0xBB67AE85u;
+
+static void philox4x32_10(const uint32_t in[4], uint32_t out[4]) {
+    uint32_t c0 = in[0], c1 = in[1], c2 = in[2], c3 = in[3];
+    uint32_t k0 = seedKey[0], k1 = seedKey[1];
+
+    for (int round = 0; round < 10; round++) {
+        uint64_t p0 = (uint64_t)PHILOX_M0 * c0;
+        uint64_t p1 = (uint64_t)PHILOX_M1 * c2;
+        uint32_t hi0 = (uint32_t)(p0 >> 32), lo0 = (uint32_t)p0;
+        uint32_t hi1 = (uint32_t)(p1 >> 32), lo1 = (uint32_t)p1;
+
+        c0 = hi1 ^ c1 ^ k0;
+        c1 = lo1;
+        c2 = hi0 ^ c3 ^ k1;
+        c3 = lo0;
+
+        k0 += PHILOX_W0;
+        k1 += PHILOX_W1;
+    }
+
+    out[0] = c0; out[1] = c1; out[2] = c2; out[3] = c3;
+}
+
+void initRandom(uint64_t masterSeed) {
+    seedKey[0] = (uint32_t)masterSeed;
+    seedKey[1] = (uint32_t)(masterSeed >> 32);
+}
+
+uint64_t getMasterSeed() {
+    return ((uint64_t)seedKey[1] << 32) | seedKey[0];
+}
+
+RandomStream makeRandomStream(RandomStreamId id, uint32_t sub) {
+    RandomStream stream;
+    stream.counter[0] = 0u;
+    stream.counter[1] = 0u;
+    stream.counter[2] = sub;
+    stream.counter[3] = (uint32_t)id;
+    stream.used = 4;    // Blok pertama dibuat saat nextU32 pertama
+    return stream;
+}
+
+uint32_t RandomStream::nextU32() {
+    if (used == 4) {
+        philox4x32_10(counter, block);
+        // Naikkan nomor blok 64-bit
+        if (++counter[0] == 0u) {
+            counter[1]++;
+        }
+        used = 0;
+    }
+    return block[used++];
+}
+
+float RandomStream::nextFloat() {
+    // 24 bit teratas -> float di [0, 1) tanpa pembulatan ke 1.0
+    return (float)(nextU32() >> 8) * (1.0f / 16777216.0f);
+}
+
+float RandomStream::range(float lo, float hi) {
+    return lo + nextFloat() * (hi - lo);
+}
+
+int RandomStream::nextInt(int n) {
+    if (n <= 0) return 0;
+    return (int)(((uint64_t)nextU32() * (uint32_t)n) >> 32);
+}
+
+uint32_t randomU32At(RandomStreamId id, uint32_t sub, uint64_t index) {
+    uint32_t in[4] = {
+        (uint32_t)(index >> 2),
+        (uint32_t)(index >> 34),
+        sub,
+        (uint32_t)id
+    };
+    uint32_t out[4];
+    philox4x32_10(in, out);
+    return out[index & 3];
+}
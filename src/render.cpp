@@ -13,7 +13,7 @@
  * - Manajemen tekstur untuk objek dan permukaan
  * - Rendering scene dengan objek 3D dan efek grafis
  * - Animasi karakter player dan musuh
- * - Sistem bayangan untuk objek dalam scene
+ * - Shadow map matahari untuk semua objek (shadow.cpp)
  * - Rendering elemen UI seperti teks dan informasi
  * - Grid untuk terrain dasar dengan tekstur
  * 
@@ -23,28 +23,21 @@
  * wallImage[][]       - Data piksel untuk tekstur dinding
  * roofImage[][]       - Data piksel untuk tekstur atap
  * texture[]           - Array ID tekstur OpenGL
- * woodTexture         - ID tekstur untuk material kayu
  * grassTexture        - ID tekstur untuk material rumput
- * shadowMat[]         - Matriks transformasi untuk bayangan
  * cars[]              - Daftar kendaraan pada scene
  * 
  * FUNCTIONS:
  * ---------
- * loadBMP()                 - Memuat tekstur dari file BMP
- * calculateShadowMatrix()   - Menghitung matriks proyeksi bayangan
- * drawPlayerShadowSilhouette() - Menggambar siluet bayangan player
  * updatePlayerAnimation()   - Memperbarui animasi player berdasarkan gerakan
  * updatePunchAnimation()    - Memperbarui animasi pukulan dan deteksi hit
- * drawText()                - Menggambar teks pada layar
  * calculateFPS()            - Menghitung dan mengembalikan frame rate
  * makeCheckImage()          - Membuat tekstur dasar checkerboard
  * makeWallImage()           - Membuat tekstur untuk dinding
  * makeRoofImage()           - Membuat tekstur untuk atap
  * loadTexture()             - Memuat semua tekstur ke memori GPU
- * Grid()                    - Menggambar grid terrain dasar dengan tekstur rumput
+ * submitGround()            - Kirim tile tanah bertekstur rumput di sekitar kamera ke render queue
  * displayBoundingBoxesOnScreen() - Menampilkan informasi collision boxes
- * drawPlayerShadow()        - Menggambar bayangan player pada permukaan
- * renderScene()             - Fungsi utama untuk rendering seluruh scene
+ * renderScene()             - Kirim seluruh scene ke render queue lalu eksekusi
  * 
  * DEPENDENCIES:
  * -----------
@@ -55,24 +48,36 @@
  * - map.h         - Header untuk akses ke elemen peta
  * - enemy.h       - Header untuk akses ke musuh
  * - combat.h      - Header untuk akses ke sistem pertarungan
+ * - frustum.h     - Culling tile tanah
+ * - atlas.h       - Atlas tekstur dunia statis
+ * - shadow.h      - Pass kedalaman dan sampling shadow map
+ * - renderqueue.h - Item gambar dengan sort key
+ * - shader.h      - Program lighting per-pixel untuk seluruh scene
+ * - lights.h      - Grid cluster cahaya titik
+ * - glstate.h     - Cache state GL (glsEnable, glsBindTexture, glsColor3f, ...)
  * 
  * TEXTURE MANAGEMENT:
  * -----------------
  * - Tekstur prosedural untuk checkerboard, dinding, dan atap
- * - Tekstur dari file BMP untuk material kayu dan rumput
+ * - Tekstur rumput dari file (BMP/PNG, lewat texture manager), dimuat
+ *   asinkron oleh loader.cpp bersama atlas
+ * - Dinding, atap, tangga, gedung dan scenery memakai satu atlas (atlas.cpp);
+ *   render queue mengelompokkan item per tekstur sehingga atlas dan rumput
+ *   masing-masing di-bind sekali per frame
  * - Support untuk transformasi tekstur dan pengulangan (repeating)
  * 
  * SHADOW SYSTEM:
  * ------------
- * - Implementasi bayangan menggunakan stencil buffer
- * - Proyeksi bayangan pada permukaan datar
- * - Siluet bayangan untuk performa yang lebih baik
+ * - Satu pass kedalaman dari matahari untuk semua caster (shadow.cpp),
+ *   disampling dengan PCF oleh semua geometri di pass utama
+ * - Jika shadow map mati atau tidak didukung driver: blob shadow untuk
+ *   semua caster dalam satu draw call (drawBlobShadows)
  * 
  * HOW TO USE:
  * ----------
  * 1. Panggil loadTexture() di awal program untuk memuat semua tekstur
  * 2. Panggil renderScene() di loop utama untuk menggambar seluruh scene
- * 3. Gunakan drawPlayerShadow() untuk menambahkan bayangan ke player
+ * 3. Panggil initShadows() setelah window dibuat untuk shadow map
  * 4. Gunakan updatePlayerAnimation() untuk animasi player berdasarkan gerakan
  * 5. Panggil calculateFPS() untuk monitoring performa
  * 
@@ -93,6 +98,17 @@
 #include "enemy.h"
 #include "combat.h"
 #include "scenery.h"
+#include "world.h"
+#include "camera.h"
+#include "frustum.h"
+#include "atlas.h"
+#include "shadow.h"
+#include "renderqueue.h"
+#include "glstate.h"
+#include "shader.h"
+#include "lights.h"
+#include <vector>
+#include <utility>
 
 #define checkImageWidth 64
 #define checkImageHeight 64
@@ -105,97 +121,8 @@ GLubyte roofImage[checkImageWidth][checkImageHeight][3];
 GLuint texture[3];
  
 Player* pla = &player;
-GLuint woodTexture;
 GLuint grassTexture; 
  
-GLuint loadBMP(const char* filename) {
-    FILE* file = fopen(filename, "rb");
-    if (!file) {
-        std::cerr << "Failed to load BMP file: " << filename << std::endl;
-        return 0;
-    }
-
-    unsigned char header[54];
-    fread(header, sizeof(unsigned char), 54, file); // Baca header BMP
-
-    int width = *(int*)&header[18];
-    int height = *(int*)&header[22];
-    int imageSize = 3 * width * height;
-
-    unsigned char* data = new unsigned char[imageSize];
-    fread(data, sizeof(unsigned char), imageSize, file); // Baca data piksel
-    fclose(file);
-
-    // Balikkan data vertikal karena BMP disimpan terbalik
-    for (int i = 0; i < height / 2; i++) {
-        for (int j = 0; j < width * 3; j++) {
-            std::swap(data[i * width * 3 + j], data[(height - i - 1) * width * 3 + j]);
-        }
-    }
-
-    GLuint textureID;
-    glGenTextures(1, &textureID);
-    glBindTexture(GL_TEXTURE_2D, textureID);
-
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, width, height, 0, GL_BGR, GL_UNSIGNED_BYTE, data);
-
-    delete[] data;
-    return textureID;
-}
-
-GLfloat shadowMat[16];
-
-// Fungsi untuk menghitung matriks proyeksi bayangan
-void calculateShadowMatrix(GLfloat shadowMat[16], GLfloat groundplane[4], GLfloat lightpos[4]) {
-    GLfloat dot;
-    
-    // Menghitung dot product dari light position dan ground plane
-    dot = groundplane[0] * lightpos[0] +
-          groundplane[1] * lightpos[1] +
-          groundplane[2] * lightpos[2] +
-          groundplane[3] * lightpos[3];
-    
-    // Menghitung matriks proyeksi bayangan
-    shadowMat[0]  = dot - lightpos[0] * groundplane[0];
-    shadowMat[4]  = -lightpos[0] * groundplane[1];
-    shadowMat[8]  = -lightpos[0] * groundplane[2];
-    shadowMat[12] = -lightpos[0] * groundplane[3];
-    
-    shadowMat[1]  = -lightpos[1] * groundplane[0];
-    shadowMat[5]  = dot - lightpos[1] * groundplane[1];
-    shadowMat[9]  = -lightpos[1] * groundplane[2];
-    shadowMat[13] = -lightpos[1] * groundplane[3];
-    
-    shadowMat[2]  = -lightpos[2] * groundplane[0];
-    shadowMat[6]  = -lightpos[2] * groundplane[1];
-    shadowMat[10] = dot - lightpos[2] * groundplane[2];
-    shadowMat[14] = -lightpos[2] * groundplane[3];
-    
-    shadowMat[3]  = -lightpos[3] * groundplane[0];
-    shadowMat[7]  = -lightpos[3] * groundplane[1];
-    shadowMat[11] = -lightpos[3] * groundplane[2];
-    shadowMat[15] = dot - lightpos[3] * groundplane[3];
-}
-
-
-void drawPlayerShadowSilhouette(const Player& player) {
-    glPushMatrix();
-    glScalef(0.8f, 0.05f, 0.8f); // Buat bayangan jauh lebih tipis (0.05f untuk ketebalan)
-    
-    // Gambar siluet tubuh sebagai elips sederhana
-    GLUquadricObj *diskQuadric = gluNewQuadric();
-    glRotatef(90.0f, 1.0f, 0.0f, 0.0f); // Rotasi disk agar menghadap ke atas
-    gluDisk(diskQuadric, 0.0f, 0.4f, 32, 1); // Gambar disk sederhana untuk tubuh
-    gluDeleteQuadric(diskQuadric);
-    
-    glPopMatrix();
-}
-
 void updatePlayerAnimation(Player& player, float deltaTime, bool isMoving) {
     static float animationTime = 0.0f;
 
@@ -224,9 +151,7 @@ void updatePunchAnimation(Player& player, float deltaTime) {
         // Check if punch has just reached its peak (around 50% of animation)
         if (oldProgress < 0.5f && player.punchProgress >= 0.5f) {
             // Check for enemy hits at the peak of the punch
-            for (auto& enemy : enemies) {
-                checkPlayerAttack(player, enemy);
-            }
+            checkPlayerMeleeHits(player);
         }
         
         if (player.punchProgress >= 1.0f) {
@@ -236,13 +161,6 @@ void updatePunchAnimation(Player& player, float deltaTime) {
     }
 }
 
-void drawText(const char* text, int x, int y, void* font) {
-    glRasterPos2i(x, y); 
-    for (const char* c = text; *c != '\0'; c++) {
-        glutBitmapCharacter(font, *c); 
-    }
-}
-
 float calculateFPS() {
     static int frameCount = 0;
     static float fps = 0.0f;
@@ -315,7 +233,7 @@ void loadTexture(void) {
     glGenTextures(2, texture);
 
     // Wall texture
-    glBindTexture(GL_TEXTURE_2D, texture[1]);
+    glsBindTexture(texture[1]);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
@@ -324,7 +242,7 @@ void loadTexture(void) {
 
     
     // Roof texture
-    glBindTexture(GL_TEXTURE_2D, texture[2]); // Gunakan indeks 2 untuk rooftop
+    glsBindTexture(texture[2]); // Gunakan indeks 2 untuk rooftop
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
@@ -337,250 +255,176 @@ void loadTexture(void) {
         std::cout << "Rooftop texture loaded successfully. Texture ID: " << texture[2] << std::endl;
     }
     
-    // Load wood texture
-    woodTexture = loadBMP("texture/quartz-block.bmp"); // Ganti "wood.bmp" dengan path file BMP kayu
-    grassTexture = loadBMP("texture/grass.bmp"); 
+    // Tekstur rumput dan atlas dunia statis dimuat oleh loader.cpp
 }
 
-void Grid() { 
-    double i;
-    const float Z_MIN = -300, Z_MAX = 500;
-    const float X_MIN = -300, X_MAX = 500;
-    const float gap = 1.5;
- 
-    glEnable(GL_TEXTURE_2D);
-    glBindTexture(GL_TEXTURE_2D, grassTexture);
-
-    glColor3f(1.0, 1.0, 1.0); // Warna putih agar tekstur terlihat jelas
-    glBegin(GL_QUADS);
+// Tanah disusun dari tile persegi yang mengikuti kamera. Semua tile memakai
+// satu display list (mesh di origin) yang digeser dengan glTranslatef, jadi
+// koordinat tekstur tetap kecil dan sambungan antar tile tetap rapi
+// selama jumlah ulangan tekstur per tile bulat.
+static const float GROUND_TILE_SIZE = 32.0f;
+static const int GROUND_TILE_SUBDIVISIONS = 8;     // Quad per sisi tile
+static const float GROUND_REPEAT_PER_UNIT = 1.0f;   // Ulangan tekstur rumput per unit
+static const float GROUND_RADIUS = 400.0f;          // Jarak tile terjauh dari kamera
+static const float GROUND_Y = -0.11f;
+static GLuint groundTileList = 0;
+
+GroundStats groundStats = {0, 0};
+
+static void buildGroundTile() {
+    groundTileList = glGenLists(1);
+    glsNewList(groundTileList);
+    const float step = GROUND_TILE_SIZE / GROUND_TILE_SUBDIVISIONS;
+    const float texStep = step * GROUND_REPEAT_PER_UNIT;
     glNormal3f(0.0f, 1.0f, 0.0f); // Normal menghadap ke atas
- 
-    float repeatX = 3000.0f; // Ulangi tekstur 10 kali di sumbu X
-    float repeatY = 3000.0f; // Ulangi tekstur 10 kali di sumbu Y
-
-    // Ulangi tekstur 50 kali di setiap sumbu
-    glTexCoord2f(0.0f, 0.0f); glVertex3f(X_MIN, -0.11f, Z_MIN);
-    glTexCoord2f(repeatX, 0.0f); glVertex3f(X_MAX, -0.11f, Z_MIN);
-    glTexCoord2f(repeatX, repeatY); glVertex3f(X_MAX, -0.11f, Z_MAX);
-    glTexCoord2f(0.0f, repeatY); glVertex3f(X_MIN, -0.11f, Z_MAX);
-    glEnd();
-
-    glDisable(GL_TEXTURE_2D);
+    for (int row = 0; row < GROUND_TILE_SUBDIVISIONS; row++) {
+        glBegin(GL_QUAD_STRIP);
+        for (int col = 0; col <= GROUND_TILE_SUBDIVISIONS; col++) {
+            glTexCoord2f(col * texStep, (row + 1) * texStep);
+            glVertex3f(col * step, 0.0f, (row + 1) * step);
+            glTexCoord2f(col * texStep, row * texStep);
+            glVertex3f(col * step, 0.0f, row * step);
+        }
+        glEnd();
+    }
+    glsEndList();
 }
 
-void drawPlayerShadow(const Player& player) {
-    // Definisikan bidang lantai
-    GLfloat floorPlane[4] = {0.0f, 1.0f, 0.0f, 0.11f};
-    
-    // Definisikan posisi sumber cahaya (arah cahaya dari samping kanan atas)
-    GLfloat lightPos[4] = {50.0f, 100.0f, -30.0f, 1.0f}; // Ubah posisi cahaya
-    
-    // Hitung matriks bayangan
-    calculateShadowMatrix(shadowMat, floorPlane, lightPos);
-    
-    // Simpan state saat ini
-    glPushAttrib(GL_ALL_ATTRIB_BITS);
-    
-    // Setup stencil buffer
-    glEnable(GL_STENCIL_TEST);
-    glStencilFunc(GL_ALWAYS, 1, 0xFF);
-    glStencilOp(GL_REPLACE, GL_REPLACE, GL_REPLACE);
-    glStencilMask(0xFF);
-    glDepthMask(GL_FALSE);
-    glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
-    
-    // Reset stencil buffer
-    glClear(GL_STENCIL_BUFFER_BIT);
-    
-    // Gambar lantai ke stencil buffer
-    glBegin(GL_QUADS);
-    glVertex3f(-1000.0f, -0.11f, -1000.0f);
-    glVertex3f( 1000.0f, -0.11f, -1000.0f);
-    glVertex3f( 1000.0f, -0.11f,  1000.0f);
-    glVertex3f(-1000.0f, -0.11f,  1000.0f);
-    glEnd();
-    
-    // Setup untuk menggambar bayangan
-    glStencilFunc(GL_EQUAL, 1, 0xFF);
-    glStencilMask(0x00);
-    glDepthMask(GL_TRUE);
-    glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
-    
-    // Nonaktifkan lighting dan texture
-    glDisable(GL_LIGHTING);
-    glDisable(GL_TEXTURE_2D);
-    
-    // Gunakan alpha blending untuk bayangan transparan
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-    
-    // Polygon offset untuk menghindari z-fighting
-    glEnable(GL_POLYGON_OFFSET_FILL);
-    glPolygonOffset(-1.5, -1.5);
-    
-    glPushMatrix();
-    
-    // Terapkan matriks bayangan
-    glMultMatrixf(shadowMat);
-    
-    // Translasi ke posisi player
-    glTranslatef(player.position.x, player.position.y, player.position.z);
-    glRotatef(player.rotationY, 0.0f, 1.0f, 0.0f);
-    
-    // Gambar bayangan dengan warna hitam yang lebih pekat
-    glColor4f(0.0f, 0.0f, 0.0f, 0.7f); // Tingkatkan alpha ke 0.7
-    
-    // Gunakan fungsi siluet
-    drawPlayerShadowSilhouette(player);
-    
-    glPopMatrix();   
-    // Kembalikan state
-    glDisable(GL_POLYGON_OFFSET_FILL);
-    glDisable(GL_STENCIL_TEST);
-    glPopAttrib();
-}
+// Origin tile tanah yang lolos culling frame ini (index item queue)
+static std::vector<std::pair<float, float>> groundTiles;
 
-void drawTreeShadow(float x, float z, float scale) {
-    // Save current attributes
-    glPushAttrib(GL_ALL_ATTRIB_BITS);
-    
-    // Disable lighting and texture for shadow
-    glDisable(GL_LIGHTING);
-    glDisable(GL_TEXTURE_2D);
-    
-    // Enable blending for semi-transparent shadow
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-    
-    // Use polygon offset to prevent z-fighting with ground
-    glEnable(GL_POLYGON_OFFSET_FILL);
-    glPolygonOffset(-1.5, -1.5);
-    
-    // Shadow color (dark with transparency)
-    glColor4f(0.0f, 0.0f, 0.0f, 0.5f);
-    
+static void drawGroundTile(int index) {
+    glsColor3f(1.0, 1.0, 1.0); // Warna putih agar tekstur terlihat jelas
     glPushMatrix();
-    // Position just above ground to prevent z-fighting
-    glTranslatef(x, -0.09f, z);
-    
-    // No offset needed now since light is directly overhead
-    // Apply scale - we're keeping the same scale for the shadow
-    float shadowScale = scale * 1.2f;
-    
-    // Flatten the shadow onto the ground
-    glScalef(shadowScale, 0.01f, shadowScale);
-    
-    // Rotate to lay flat on the ground
-    glRotatef(90.0f, 1.0f, 0.0f, 0.0f);
-    
-    // Draw trunk shadow as a cylinder silhouette
-    GLUquadricObj *quadric = gluNewQuadric();
-    gluDisk(quadric, 0.0f, 0.2f, 12, 1);
-    
-    // Draw foliage shadow - directly below without offsets
-    gluDisk(quadric, 0.0f, 0.9f, 16, 1);
-    
-    // With overhead light, we don't need to offset the overlapping disks
-    // They should all be centered to create a circular shadow
-    
-    gluDeleteQuadric(quadric);
+    glTranslatef(groundTiles[index].first, GROUND_Y, groundTiles[index].second);
+    glsCallList(groundTileList);
     glPopMatrix();
-    
-    // Restore previous state
-    glDisable(GL_POLYGON_OFFSET_FILL);
-    glPopAttrib();
 }
 
-void drawPineTreeShadow(float x, float z, float scale) {
-    // Save current attributes
-    glPushAttrib(GL_ALL_ATTRIB_BITS);
-    
-    // Disable lighting and texture for shadow
-    glDisable(GL_LIGHTING);
-    glDisable(GL_TEXTURE_2D);
-    
-    // Enable blending for semi-transparent shadow
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-    
-    // Use polygon offset to prevent z-fighting with ground
-    glEnable(GL_POLYGON_OFFSET_FILL);
-    glPolygonOffset(-1.5, -1.5);
-    
-    // Shadow color (dark with transparency)
-    glColor4f(0.0f, 0.0f, 0.0f, 0.5f);
-    
-    glPushMatrix();
-    // Position just above ground to prevent z-fighting
-    glTranslatef(x, -0.09f, z);
-    
-    // Apply scale
-    float shadowScale = scale * 1.2f;
-    
-    // Flatten the shadow onto the ground
-    glScalef(shadowScale, 0.01f, shadowScale);
-    
-    // Rotate to lay flat on the ground
-    glRotatef(90.0f, 1.0f, 0.0f, 0.0f);
-    
-    // Draw trunk shadow
-    GLUquadricObj *quadric = gluNewQuadric();
-    gluDisk(quadric, 0.0f, 0.15f, 10, 1);
-    
-    // Draw pine tree shadow - nested concentric circles for conical shape
-    // With overhead light, the shadow should be a series of concentric circles
-    gluDisk(quadric, 0.0f, 0.9f, 16, 1); // Base layer
-    gluDisk(quadric, 0.0f, 0.7f, 14, 1); // Middle layer
-    gluDisk(quadric, 0.0f, 0.5f, 12, 1); // Upper layer
-    gluDisk(quadric, 0.0f, 0.3f, 10, 1); // Top layer
-    
-    gluDeleteQuadric(quadric);
-    glPopMatrix();
-    
-    // Restore previous state
-    glDisable(GL_POLYGON_OFFSET_FILL);
-    glPopAttrib();
+void submitGround() {
+    // Dunia tidak dibatasi: tile dalam GROUND_RADIUS dari kamera dikirim ke
+    // render queue, tile di luar frustum dilewati
+    if (groundTileList == 0) {
+        buildGroundTile();
+    }
+
+    int tileX0 = (int)std::floor((cameraX - GROUND_RADIUS) / GROUND_TILE_SIZE);
+    int tileX1 = (int)std::floor((cameraX + GROUND_RADIUS) / GROUND_TILE_SIZE);
+    int tileZ0 = (int)std::floor((cameraZ - GROUND_RADIUS) / GROUND_TILE_SIZE);
+    int tileZ1 = (int)std::floor((cameraZ + GROUND_RADIUS) / GROUND_TILE_SIZE);
+
+    groundTiles.clear();
+    groundStats.tilesInRange = 0;
+    groundStats.tilesDrawn = 0;
+    for (int tz = tileZ0; tz <= tileZ1; tz++) {
+        for (int tx = tileX0; tx <= tileX1; tx++) {
+            float minX = tx * GROUND_TILE_SIZE, minZ = tz * GROUND_TILE_SIZE;
+            float maxX = minX + GROUND_TILE_SIZE, maxZ = minZ + GROUND_TILE_SIZE;
+
+            // Jarak kamera ke titik terdekat tile
+            float dx = std::max(std::max(minX - cameraX, cameraX - maxX), 0.0f);
+            float dz = std::max(std::max(minZ - cameraZ, cameraZ - maxZ), 0.0f);
+            if (dx * dx + dz * dz > GROUND_RADIUS * GROUND_RADIUS) continue;
+            groundStats.tilesInRange++;
+
+            if (!frustumBoxVisible(minX, GROUND_Y, minZ, maxX, GROUND_Y, maxZ)) continue;
+            groundStats.tilesDrawn++;
+
+            uint64_t key = makeRenderKey(RENDER_PASS_OPAQUE, RENDER_LIGHTING | RENDER_TEXTURE | RENDER_SHADOWED,
+                                         grassTexture, dx * dx + dz * dz);
+            submitRenderItem(key, drawGroundTile, (int)groundTiles.size());
+            groundTiles.push_back(std::make_pair(minX, minZ));
+        }
+    }
+}
+
+// Item queue untuk objek yang datanya dimiliki modul lain
+static void drawMapItem(int) {
+    drawMap();
+}
+
+static void drawBulletsItem(int) {
+    drawBullets();
+}
+
+static void drawEnemyItem(int index) {
+    drawEnemy((size_t)index);
+}
+
+static void drawPlayerItem(int) {
+    drawPlayer(player);
+}
+
+static void drawSkyboxItem(int) {
+    drawSkybox();
+}
+
+static void drawDistantSceneryItem(int) {
+    drawDistantScenery();
+}
+
+static void drawBlobShadowsItem(int) {
+    drawBlobShadows();
 }
 
 void renderScene() {
     std::cout << "Rendering scene" << std::endl;
+
+    // Program lighting (jika ada) dipakai sampai queue selesai, termasuk
+    // pass kedalaman; MODELVIEW di sini = matriks kamera
+    beginShaderFrame();
+
+    // Shadow map dulu: jalur tanpa FBO memakai back buffer yang di-clear di bawah
+    renderShadowPass();
     
     // Clear the screen and depth buffer
     glClearColor(0.529f, 0.808f, 0.922f, 1.0f); // Light blue sky
-    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
-    
-    // Draw skybox
-    drawSkybox();
-    
-    // Draw ground grid 
-    Grid();
-    
-    // Draw distant scenery first (buildings, mountains)
-    drawDistantScenery();
-    
-    // Draw all scenery objects
-    drawScenery();
-    
-    // Draw the map (walls, fences, etc)
-    drawMap();
-    
-    // Draw bullets
-    drawBullets();
-
-    // Draw enemies
-    for (auto& enemy : enemies) {
-        if (enemy.isAlive) {
-            drawEnemy(enemy);
-        }
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    
+    // Bidang frustum untuk culling tile tanah, chunk dunia dan cahaya titik
+    updateFrustum();
+    buildLightClusters();
+
+    // Semua subsistem mengirim item ke render queue; urutan gambar dan
+    // perubahan state ditentukan sort key (lihat renderqueue.cpp).
+    // Langit dan gunung jauh: tanpa lighting dan tanpa bayangan
+    submitRenderItem(makeRenderKey(RENDER_PASS_BACKGROUND, 0, 0, 1.0e6f), drawSkyboxItem, 0);
+    submitRenderItem(makeRenderKey(RENDER_PASS_BACKGROUND, 0, 0, 0.0f), drawDistantSceneryItem, 0);
+
+    // Tanah, scenery, chunk dunia dan peta (atlas / rumput)
+    submitGround();
+    submitScenery();
+    submitWorldChunks();
+    // Peta menutupi banyak layar: digambar paling awal di grupnya
+    submitRenderItem(makeRenderKey(RENDER_PASS_OPAQUE, RENDER_LIGHTING | RENDER_SHADOWED, atlasTexture, 0.0f),
+                     drawMapItem, 0);
+
+    // Objek dinamis tanpa tekstur
+    const unsigned dynamicState = RENDER_LIGHTING | RENDER_SHADOWED;
+    submitRenderItem(makeRenderKey(RENDER_PASS_OPAQUE, dynamicState, 0, 0.0f), drawBulletsItem, 0);
+    for (size_t i = 0; i < enemyPool.size(); i++) {
+        const Position& pos = enemyPool.position[i];
+        submitRenderItem(makeRenderKey(RENDER_PASS_OPAQUE, dynamicState, 0, renderDistanceSq(pos.x, pos.y, pos.z)),
+                         drawEnemyItem, (int)i);
     }
 
     // Draw player only if not in first-person mode
     extern bool isFirstPersonView;
     if (!isFirstPersonView) {
-        // Draw player and player shadow
-        drawPlayer(player);
-        drawPlayerShadow(player);
+        // Bayangannya dari shadow map atau blob shadow
+        float distanceSq = renderDistanceSq(player.position.x, player.position.y, player.position.z);
+        submitRenderItem(makeRenderKey(RENDER_PASS_OPAQUE, dynamicState, 0, distanceSq), drawPlayerItem, 0);
+    }
+
+    // Mode tanpa shadow map: semua blob shadow dalam satu item translucent
+    if (!shadowsEnabled()) {
+        submitRenderItem(makeRenderKey(RENDER_PASS_TRANSLUCENT, RENDER_BLEND, 0, 0.0f), drawBlobShadowsItem, 0);
     }
+
+    // Queue selesai dengan state default dan tanpa shadow map, jadi HUD
+    // dan menu digambar seperti biasa
+    executeRenderQueue();
+    endShaderFrame();
     
     std::cout << "Scene rendered" << std::endl;
 }
@@ -589,68 +433,60 @@ void drawSkybox() {
     // Save matrix state
     glPushMatrix();
     
-    // Move skybox with camera position
+    // Move skybox with camera position (lighting sudah mati, lihat renderScene)
     extern float cameraX, cameraY, cameraZ;
     glTranslatef(cameraX, 0, cameraZ);
     
-    // Disable lighting for skybox
-    glDisable(GL_LIGHTING);
-    
     // Draw sky as a gradient
     glBegin(GL_QUADS);
     
     // Top - lighter blue
-    glColor3f(0.4f, 0.7f, 1.0f);
+    glsColor3f(0.4f, 0.7f, 1.0f);
     glVertex3f(-500.0f, 300.0f, -500.0f);
     glVertex3f(-500.0f, 300.0f,  500.0f);
     glVertex3f( 500.0f, 300.0f,  500.0f);
     glVertex3f( 500.0f, 300.0f, -500.0f);
 
     // Front, blend from top to horizon
-    glColor3f(0.4f, 0.7f, 1.0f);
+    glsColor3f(0.4f, 0.7f, 1.0f);
     glVertex3f(-500.0f, 300.0f, -500.0f);
     glVertex3f( 500.0f, 300.0f, -500.0f);
-    glColor3f(0.7f, 0.85f, 1.0f);  // Lighter at horizon
+    glsColor3f(0.7f, 0.85f, 1.0f);  // Lighter at horizon
     glVertex3f( 500.0f, 0.0f, -500.0f);
     glVertex3f(-500.0f, 0.0f, -500.0f);
 
     // Back
-    glColor3f(0.4f, 0.7f, 1.0f);
+    glsColor3f(0.4f, 0.7f, 1.0f);
     glVertex3f(-500.0f, 300.0f, 500.0f);
     glVertex3f( 500.0f, 300.0f, 500.0f);
-    glColor3f(0.7f, 0.85f, 1.0f);
+    glsColor3f(0.7f, 0.85f, 1.0f);
     glVertex3f( 500.0f, 0.0f, 500.0f);
     glVertex3f(-500.0f, 0.0f, 500.0f);
 
     // Left
-    glColor3f(0.4f, 0.7f, 1.0f);
+    glsColor3f(0.4f, 0.7f, 1.0f);
     glVertex3f(-500.0f, 300.0f, -500.0f);
     glVertex3f(-500.0f, 300.0f,  500.0f);
-    glColor3f(0.7f, 0.85f, 1.0f);
+    glsColor3f(0.7f, 0.85f, 1.0f);
     glVertex3f(-500.0f, 0.0f,  500.0f);
     glVertex3f(-500.0f, 0.0f, -500.0f);
 
     // Right
-    glColor3f(0.4f, 0.7f, 1.0f);
+    glsColor3f(0.4f, 0.7f, 1.0f);
     glVertex3f(500.0f, 300.0f, -500.0f);
     glVertex3f(500.0f, 300.0f,  500.0f);
-    glColor3f(0.7f, 0.85f, 1.0f);
+    glsColor3f(0.7f, 0.85f, 1.0f);
     glVertex3f(500.0f, 0.0f,  500.0f);
     glVertex3f(500.0f, 0.0f, -500.0f);
     
     glEnd();
     
-    // Re-enable lighting
-    glEnable(GL_LIGHTING);
-    
     glPopMatrix();
 }
 
 void drawDistantScenery() {
     glPushMatrix();
     
-    glDisable(GL_LIGHTING);
-    
     // Draw mountain range
     for (int i = 0; i < 10; i++) {
         float mountainX = -400 + i * 100;
@@ -658,7 +494,7 @@ void drawDistantScenery() {
         float mountainHeight = 120 + (i % 3) * 40;  // Varied heights
         
         // Blue-gray mountain color
-        glColor3f(0.5f, 0.55f, 0.6f);
+        glsColor3f(0.5f, 0.55f, 0.6f);
         
         // Simple triangle for distant mountain
         glBegin(GL_TRIANGLES);
@@ -668,8 +504,6 @@ void drawDistantScenery() {
         glEnd();
     }
     
-    glEnable(GL_LIGHTING);
-    
     glPopMatrix();
 }
 
@@ -0,0 +1,196 @@
+/*
+ * ==========================================================================
+ * RENDER QUEUE
+ * ==========================================================================
+ *
+ * File: renderqueue.cpp
+ * Author: Project Team
+ * Date: June 2025
+ *
+ * DESCRIPTION:
+ * -----------
+ * Subsistem tidak lagi menggambar langsung dari renderScene(); mereka
+ * mengirim item (fungsi gambar + index) dengan sort key 64 bit:
+ *
+ *   63..62  pass       background, opaque, translucent
+ *   61..56  state      RENDER_LIGHTING | RENDER_TEXTURE | RENDER_BLEND | RENDER_SHADOWED
+ *   55..32  tekstur    ID tekstur unit 0 (0 = item tidak memakai tekstur)
+ *   31..0   kedalaman  bit float jarak kuadrat ke kamera; dibalik untuk
+ *                      pass translucent (belakang ke depan)
+ *
+ * Setiap frame queue diurutkan dengan radix sort LSD 8 bit (stabil, O(n)).
+ * Digit yang sama untuk semua item (misalnya pass saat hanya ada satu
+ * pass) dilewati. Saat dieksekusi, queue hanya memanggil glEnable/
+ * glDisable/glBindTexture untuk state yang berbeda dari item sebelumnya,
+ * jadi item dengan material sama digambar berurutan tanpa perubahan
+ * state, dan geometri opaque digambar depan ke belakang agar fragmen yang
+ * tertutup ditolak oleh depth test lebih awal.
+ *
+ * Kontrak fungsi gambar: state di atas sudah diatur queue saat fungsi
+ * dipanggil; fungsi boleh mengubahnya sementara (misalnya tekstur untuk
+ * sebagian objek) tapi harus mengembalikannya sebelum selesai.
+ *
+ * FUNCTIONS:
+ * ---------
+ * makeRenderKey()      - Susun sort key
+ * renderDistanceSq()   - Jarak kuadrat ke kamera untuk kedalaman key
+ * submitRenderItem()   - Tambah item ke queue frame ini
+ * executeRenderQueue() - Radix sort, gambar, kosongkan queue
+ *
+ * DEPENDENCIES:
+ * -----------
+ * - renderqueue.h - Deklarasi
+ * - camera.h      - Posisi kamera
+ * - shadow.h      - begin/endShadowReceivers untuk RENDER_SHADOWED
+ * - glstate.h     - Perubahan state lewat cache state GL
+ *
+ * ==========================================================================
+ */
+
+#include "renderqueue.h"
+#include "camera.h"
+#include "shadow.h"
+#include "glstate.h"
+#include <chrono>
+#include <cstring>
+#include <vector>
+
+RenderQueueStats renderQueueStats = {0, 0, 0, 0, 0.0f};
+
+struct RenderItem {
+    uint64_t key;
+    RenderDrawFn draw;
+    int index;
+};
+
+static std::vector<RenderItem> queueItems;
+static std::vector<RenderItem> sortBuffer;     // Buffer ping-pong radix sort
+
+static const int KEY_PASS_SHIFT = 62;
+static const int KEY_STATE_SHIFT = 56;
+static const int KEY_TEXTURE_SHIFT = 32;
+static const uint64_t KEY_STATE_MASK = 0x3F;
+static const uint64_t KEY_TEXTURE_MASK = 0xFFFFFF;
+
+// State awal dan akhir queue (sama dengan yang diasumsikan kode lain)
+static const unsigned BASE_STATE = RENDER_LIGHTING;
+
+uint64_t makeRenderKey(RenderPass pass, unsigned state, GLuint texture, float distanceSq) {
+    // Float non-negatif: urutan bit sama dengan urutan nilai
+    if (!(distanceSq > 0.0f)) distanceSq = 0.0f;
+    uint32_t depth;
+    std::memcpy(&depth, &distanceSq, sizeof(depth));
+    if (pass == RENDER_PASS_TRANSLUCENT) depth = ~depth;
+
+    return ((uint64_t)pass << KEY_PASS_SHIFT)
+         | (((uint64_t)state & KEY_STATE_MASK) << KEY_STATE_SHIFT)
+         | (((uint64_t)texture & KEY_TEXTURE_MASK) << KEY_TEXTURE_SHIFT)
+         | depth;
+}
+
+float renderDistanceSq(float x, float y, float z) {
+    float dx = x - cameraX, dy = y - cameraY, dz = z - cameraZ;
+    return dx * dx + dy * dy + dz * dz;
+}
+
+void submitRenderItem(uint64_t key, RenderDrawFn draw, int index) {
+    RenderItem item = {key, draw, index};
+    queueItems.push_back(item);
+}
+
+// Radix sort LSD per byte; hasil akhir selalu di queueItems
+static void sortQueue() {
+    size_t count = queueItems.size();
+    sortBuffer.resize(count);
+    RenderItem* src = queueItems.data();
+    RenderItem* dst = sortBuffer.data();
+
+    for (int shift = 0; shift < 64; shift += 8) {
+        size_t offsets[256] = {0};
+        for (size_t i = 0; i < count; i++) {
+            offsets[(src[i].key >> shift) & 0xFF]++;
+        }
+        // Semua item punya digit yang sama: urutan tidak berubah
+        if (offsets[(src[0].key >> shift) & 0xFF] == count) continue;
+
+        size_t total = 0;
+        for (int digit = 0; digit < 256; digit++) {
+            size_t bucket = offsets[digit];
+            offsets[digit] = total;
+            total += bucket;
+        }
+        for (size_t i = 0; i < count; i++) {
+            dst[offsets[(src[i].key >> shift) & 0xFF]++] = src[i];
+        }
+        std::swap(src, dst);
+    }
+
+    if (src != queueItems.data()) {
+        queueItems.swap(sortBuffer);
+    }
+}
+
+static void setCapability(GLenum capability, bool enable) {
+    if (enable) glsEnable(capability);
+    else glsDisable(capability);
+    renderQueueStats.stateChanges++;
+}
+
+// Terapkan hanya bit state yang berubah
+static void applyState(unsigned current, unsigned wanted) {
+    unsigned changed = current ^ wanted;
+    if (changed & RENDER_LIGHTING) setCapability(GL_LIGHTING, (wanted & RENDER_LIGHTING) != 0);
+    if (changed & RENDER_TEXTURE) setCapability(GL_TEXTURE_2D, (wanted & RENDER_TEXTURE) != 0);
+    if (changed & RENDER_BLEND) {
+        if (wanted & RENDER_BLEND) glsBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+        setCapability(GL_BLEND, (wanted & RENDER_BLEND) != 0);
+    }
+    if (changed & RENDER_SHADOWED) {
+        if (wanted & RENDER_SHADOWED) beginShadowReceivers();
+        else endShadowReceivers();
+        renderQueueStats.stateChanges++;
+    }
+}
+
+void executeRenderQueue() {
+    renderQueueStats.items = (int)queueItems.size();
+    renderQueueStats.stateChanges = 0;
+    renderQueueStats.textureBinds = 0;
+    renderQueueStats.skippedChanges = 0;
+    if (queueItems.empty()) {
+        renderQueueStats.sortMs = 0.0f;
+        return;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    sortQueue();
+    renderQueueStats.sortMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    // Mulai dari state yang diketahui; tekstur 0 = belum ada yang di-bind
+    glsEnable(GL_LIGHTING);
+    glsDisable(GL_TEXTURE_2D);
+    glsDisable(GL_BLEND);
+    unsigned state = BASE_STATE;
+    GLuint boundTexture = 0;
+
+    for (const RenderItem& item : queueItems) {
+        unsigned wanted = (unsigned)((item.key >> KEY_STATE_SHIFT) & KEY_STATE_MASK);
+        GLuint texture = (GLuint)((item.key >> KEY_TEXTURE_SHIFT) & KEY_TEXTURE_MASK);
+        bool rebind = texture != 0 && texture != boundTexture;
+
+        if (wanted == state && !rebind) {
+            renderQueueStats.skippedChanges++;
+        }
+        applyState(state, wanted);
+        state = wanted;
+        if (rebind) {
+            glsBindTexture(texture);
+            boundTexture = texture;
+            renderQueueStats.textureBinds++;
+        }
+        item.draw(item.index);
+    }
+
+    applyState(state, BASE_STATE);
+    queueItems.clear();
+}
@@ -4,186 +4,236 @@
 #include <cstdlib>
 #include <iostream>
 #include <ctime> 
+#include <algorithm>
+#include "random.h"
+#include "poisson.h"
+#include "spatialhash.h"
+#include "options.h"
+#include "level.h"
+#include "atlas.h"
+#include "renderqueue.h"
+#include "glstate.h"
+#include "lighting.h"
 
 std::vector<SceneryObject> sceneryObjects;
 std::vector<Building> buildings;
-GLuint buildingTexture;
-GLuint rockTexture;
-GLuint flowerTexture;
 
-void initScenery() {
-    // Seed random number generator
-    std::srand(static_cast<unsigned int>(std::time(nullptr)));
-    
-    // Clear any existing scenery
-    sceneryObjects.clear();
-    buildings.clear();
+// Aturan sebaran per tipe scenery (untuk --scenery-density 1.0).
+// radius    : jarak minimum antar objek tipe yang sama (Poisson-disk)
+// clearance : jarak minimum ke objek tipe lain yang sudah ditempatkan
+// Kedua jarak dibagi sqrt(density) sehingga jumlah objek ~ density.
+struct SceneryScatterRule {
+    SceneryType type;
+    float radius;
+    float clearance;
+    float minScale, maxScale;
+    bool castShadow;
+};
+
+static const SceneryScatterRule sceneryScatterRules[] = {
+    {SCENERY_TREE,      16.0f, 0.0f, 0.8f, 1.6f, true},
+    {SCENERY_PINE_TREE, 16.0f, 6.0f, 0.7f, 1.4f, true},   // 6 unit dari pohon biasa
+    {SCENERY_BUSH,      14.0f, 2.0f, 0.5f, 1.0f, false},
+    {SCENERY_ROCK,      17.0f, 2.0f, 0.3f, 0.8f, true}
+};
+
+// Zona terlarang berbentuk persegi di bidang XZ
+struct SceneryExclusionZone {
+    float minX, minZ, maxX, maxZ;
+};
+
+// Rumah utama, area spawn player (plaza + air mancur) dan footprint gedung jauh
+static void getSceneryExclusionZones(std::vector<SceneryExclusionZone>& zones) {
+    SceneryExclusionZone house = {-15.0f, 0.0f, 15.0f, 35.0f};
+    SceneryExclusionZone spawnArea = {-8.0f, -12.0f, 8.0f, 0.0f};
+    zones.push_back(house);
+    zones.push_back(spawnArea);
+    for (const auto& building : buildings) {
+        const float margin = 3.0f;
+        SceneryExclusionZone zone = {
+            building.position.x - building.width * 0.5f - margin,
+            building.position.z - building.length * 0.5f - margin,
+            building.position.x + building.width * 0.5f + margin,
+            building.position.z + building.length * 0.5f + margin
+        };
+        zones.push_back(zone);
+    }
+}
+
+// Sub-stream RNG_SCENERY untuk satu tipe di satu chunk
+static uint32_t sceneryChunkStream(int chunkX, int chunkZ, size_t rule) {
+    return ((uint32_t)chunkX * 73856093u) ^ ((uint32_t)chunkZ * 19349663u) ^ ((uint32_t)(rule + 1) * 83492791u);
+}
+
+// Titik Poisson-disk mentah satu tipe di satu chunk (hanya zona terlarang)
+static void sampleSceneryRule(int chunkX, int chunkZ, float chunkSize, size_t rule, float radius,
+                              const std::vector<SceneryExclusionZone>& zones,
+                              std::vector<PoissonPoint>& out) {
+    RandomStream rng = makeRandomStream(RNG_SCENERY, sceneryChunkStream(chunkX, chunkZ, rule));
+    float minX = chunkX * chunkSize, minZ = chunkZ * chunkSize;
+    poissonDiskSample(minX, minZ, minX + chunkSize, minZ + chunkSize, radius, rng,
+                      [&](float x, float z) {
+                          for (const auto& zone : zones) {
+                              if (x >= zone.minX && x <= zone.maxX && z >= zone.minZ && z <= zone.maxZ) {
+                                  return false;
+                              }
+                          }
+                          return true;
+                      },
+                      out);
+}
+
+// Sebar pohon, semak dan batu di satu chunk. Setiap tipe diisi dengan
+// Poisson-disk per chunk; objek tipe sebelumnya dimasukkan ke spatial hash
+// agar tipe berikutnya menjaga clearance. Di perbatasan chunk, titik yang
+// terlalu dekat dengan titik mentah chunk tetangga yang lebih dulu (urutan
+// z lalu x) dibuang, jadi jarak minimum tetap terjaga tanpa bergantung pada
+// urutan chunk dimuat. Hanya membaca buildings dan gameOptions.
+void generateSceneryChunk(int chunkX, int chunkZ, float chunkSize, std::vector<SceneryObject>& out) {
+    float density = std::max(gameOptions.sceneryDensity, 0.01f);
+    float spacingScale = 1.0f / std::sqrt(density);
+    float minX = chunkX * chunkSize, minZ = chunkZ * chunkSize;
+    
+    std::vector<SceneryExclusionZone> zones;
+    getSceneryExclusionZones(zones);
+    
+    // Perkiraan jumlah objek (untuk ukuran tabel hash) dan clearance terbesar
+    SpatialHash placed;
+    float maxClearance = 0.0f;
+    size_t expectedCount = 0;
+    for (const auto& rule : sceneryScatterRules) {
+        float radius = rule.radius * spacingScale;
+        maxClearance = std::max(maxClearance, rule.clearance * spacingScale);
+        expectedCount += (size_t)(chunkSize * chunkSize / (radius * radius));
+    }
+    placed.reset(std::max(maxClearance, 1.0f), expectedCount);
     
-    // Load textures
-    buildingTexture = loadBMP("texture/quartz-block.bmp");
-    rockTexture = loadBMP("texture/rock.bmp");
-    flowerTexture = loadBMP("texture/flowers.bmp");
-    
-    // Define the main building area to avoid placing trees there
-    float buildingMinX = -15.0f;
-    float buildingMaxX = 15.0f;
-    float buildingMinZ = 0.0f;
-    float buildingMaxZ = 35.0f;
-    
-    // Define the fence boundary (slightly inside actual fence for aesthetics)
-    float fenceMinX = -95.0f;
-    float fenceMaxX = 95.0f;
-    float fenceMinZ = -95.0f;
-    float fenceMaxZ = 95.0f;
-    
-    // Distribute trees evenly throughout the entire fenced area
-    // More trees for denser forest feel
-    int numRegularTrees = 60;
-    int numPineTrees = 60;
-    
-    // Add regular trees throughout the map
-    for (int i = 0; i < numRegularTrees; i++) {
-        SceneryObject tree;
+    const size_t ruleCount = sizeof(sceneryScatterRules) / sizeof(sceneryScatterRules[0]);
+    for (size_t r = 0; r < ruleCount; r++) {
+        const SceneryScatterRule& rule = sceneryScatterRules[r];
+        float radius = rule.radius * spacingScale;
+        float clearance = rule.clearance * spacingScale;
         
-        // Keep trying positions until we find one not in the building area
-        bool validPosition = false;
-        float x, z;
+        std::vector<PoissonPoint> points;
+        sampleSceneryRule(chunkX, chunkZ, chunkSize, r, radius, zones, points);
         
-        int attempts = 0;
-        const int maxAttempts = 10;
-        
-        while (!validPosition && attempts < maxAttempts) {
-            x = fenceMinX + static_cast<float>(rand()) / RAND_MAX * (fenceMaxX - fenceMinX);
-            z = fenceMinZ + static_cast<float>(rand()) / RAND_MAX * (fenceMaxZ - fenceMinZ);
-            
-            // Check if this position is far enough from the building
-            if (x < buildingMinX || x > buildingMaxX || z < buildingMinZ || z > buildingMaxZ) {
-                // Also ensure trees aren't too close to each other
-                bool tooClose = false;
-                for (const auto& obj : sceneryObjects) {
-                    if (obj.type == SCENERY_TREE || obj.type == SCENERY_PINE_TREE) {
-                        float dx = obj.position.x - x;
-                        float dz = obj.position.z - z;
-                        float distSquared = dx*dx + dz*dz;
-                        
-                        // Minimum distance between trees (squared)
-                        if (distSquared < 36.0f) {  // 6.0 units minimum distance
-                            tooClose = true;
-                            break;
-                        }
-                    }
-                }
-                
-                if (!tooClose) {
-                    validPosition = true;
+        // Titik mentah tetangga yang lebih dulu, hanya yang dekat perbatasan
+        SpatialHash seam;
+        seam.reset(radius, 0);
+        const int earlier[4][2] = {{-1, -1}, {0, -1}, {1, -1}, {-1, 0}};
+        for (int n = 0; n < 4; n++) {
+            std::vector<PoissonPoint> neighbour;
+            sampleSceneryRule(chunkX + earlier[n][0], chunkZ + earlier[n][1], chunkSize, r, radius, zones, neighbour);
+            for (size_t i = 0; i < neighbour.size(); i++) {
+                float x = neighbour[i].x, z = neighbour[i].z;
+                if (x > minX - radius && x < minX + chunkSize + radius &&
+                    z > minZ - radius && z < minZ + chunkSize + radius) {
+                    seam.insert(0, x, z);
                 }
             }
-            
-            attempts++;
         }
         
-        if (validPosition) {
-            tree.position = {x, 0.0f, z};
-            tree.rotationY = static_cast<float>(rand() % 360);
-            tree.scale = 0.8f + static_cast<float>(rand()) / RAND_MAX * 0.8f;  // Scale between 0.8 and 1.6
-            tree.type = SCENERY_TREE;
-            tree.castShadow = true;
-            sceneryObjects.push_back(tree);
-        }
-    }
-    
-    // Add pine trees throughout the map for variety
-    for (int i = 0; i < numPineTrees; i++) {
-        SceneryObject pineTree;
-        
-        bool validPosition = false;
-        float x, z;
-        
-        int attempts = 0;
-        const int maxAttempts = 10;
-        
-        while (!validPosition && attempts < maxAttempts) {
-            x = fenceMinX + static_cast<float>(rand()) / RAND_MAX * (fenceMaxX - fenceMinX);
-            z = fenceMinZ + static_cast<float>(rand()) / RAND_MAX * (fenceMaxZ - fenceMinZ);
+        // Rotasi dan skala dari stream terpisah; dipakai untuk setiap titik
+        // mentah (juga yang dibuang) agar atribut tidak bergeser
+        RandomStream attrRng = makeRandomStream(RNG_SCENERY, sceneryChunkStream(chunkX, chunkZ, r) ^ 0x5bd1e995u);
+        for (size_t i = 0; i < points.size(); i++) {
+            float x = points[i].x, z = points[i].z;
+            float rotationY = static_cast<float>(attrRng.nextInt(360));
+            float scale = attrRng.range(rule.minScale, rule.maxScale);
             
-            // Check if this position is far enough from the building
-            if (x < buildingMinX || x > buildingMaxX || z < buildingMinZ || z > buildingMaxZ) {
-                // Also ensure trees aren't too close to each other
-                bool tooClose = false;
-                for (const auto& obj : sceneryObjects) {
-                    if (obj.type == SCENERY_TREE || obj.type == SCENERY_PINE_TREE) {
-                        float dx = obj.position.x - x;
-                        float dz = obj.position.z - z;
-                        float distSquared = dx*dx + dz*dz;
-                        
-                        // Minimum distance between trees (squared)
-                        if (distSquared < 36.0f) {
-                            tooClose = true;
-                            break;
-                        }
-                    }
-                }
-                
-                if (!tooClose) {
-                    validPosition = true;
-                }
+            bool blocked = false;
+            seam.forEachNear(x, z, radius, [&](int, float, float, float distSq) {
+                if (distSq < radius * radius) blocked = true;
+            });
+            if (!blocked && clearance > 0.0f) {
+                placed.forEachNear(x, z, clearance, [&](int, float, float, float) {
+                    blocked = true;
+                });
             }
+            if (blocked) continue;
             
-            attempts++;
+            SceneryObject obj;
+            obj.position = {x, 0.0f, z};
+            obj.rotationY = rotationY;
+            obj.scale = scale;
+            obj.type = rule.type;
+            obj.castShadow = rule.castShadow;
+            out.push_back(obj);
         }
         
-        if (validPosition) {
-            pineTree.position = {x, 0.0f, z};
-            pineTree.rotationY = static_cast<float>(rand() % 360);
-            pineTree.scale = 0.7f + static_cast<float>(rand()) / RAND_MAX * 0.7f;  // Scale between 0.7 and 1.4
-            pineTree.type = SCENERY_PINE_TREE;
-            pineTree.castShadow = true;
-            sceneryObjects.push_back(pineTree);
+        // Tipe berikutnya menjaga clearance dari semua objek yang sudah ada
+        for (size_t i = 0; i < out.size(); i++) {
+            if (out[i].type == rule.type) {
+                placed.insert((int)i, out[i].position.x, out[i].position.z);
+            }
         }
     }
+}
+
+bool getSceneryCollider(const SceneryObject& obj, float& radius, float& height) {
+    switch (obj.type) {
+        case SCENERY_TREE:          // Batang pohon (lihat drawTree)
+            radius = 0.2f * obj.scale;
+            height = 2.5f * obj.scale;
+            return true;
+        case SCENERY_PINE_TREE:     // Batang cemara (lihat drawPineTree)
+            radius = 0.15f * obj.scale;
+            height = 2.8f * obj.scale;
+            return true;
+        case SCENERY_ROCK:          // Bola terbesar batu (lihat drawRock)
+            radius = 0.7f * obj.scale;
+            height = 0.42f * obj.scale;
+            return true;
+        default:
+            return false;
+    }
+}
+
+void initScenery() {
+    // Stream acak khusus scenery (deterministik untuk master seed yang sama)
+    RandomStream rng = makeRandomStream(RNG_SCENERY);
     
-    // Add some bushes scattered around
-    for (int i = 0; i < 80; i++) {
-        SceneryObject bush;
-        bush.position = {
-            fenceMinX + static_cast<float>(rand()) / RAND_MAX * (fenceMaxX - fenceMinX),
-            0.0f,
-            fenceMinZ + static_cast<float>(rand()) / RAND_MAX * (fenceMaxZ - fenceMinZ)
-        };
-        
-        // Check if this position is far enough from the building
-        if (bush.position.x >= buildingMinX && bush.position.x <= buildingMaxX && 
-            bush.position.z >= buildingMinZ && bush.position.z <= buildingMaxZ) {
-            continue;  // Skip this bush if it's in the building area
-        }
-        
-        bush.rotationY = static_cast<float>(rand() % 360);
-        bush.scale = 0.5f + static_cast<float>(rand()) / RAND_MAX * 0.5f;
-        bush.type = SCENERY_BUSH;
-        bush.castShadow = false;
-        sceneryObjects.push_back(bush);
+    // Clear any existing scenery
+    sceneryObjects.clear();
+    buildings.clear();
+    
+    // Distant buildings dibuat lebih dulu: footprint-nya menjadi zona terlarang generateSceneryChunk
+    for (int i = 0; i < 3; i++) {
+        Building building;
+        building.position = {-60.0f + i * 60.0f, 0.0f, -80.0f};
+        building.width = 20.0f + rng.nextInt(10);
+        building.length = 15.0f + rng.nextInt(8);
+        building.height = 20.0f + rng.nextInt(15);
+        building.rotationY = 0.0f;
+        building.numWindows = 4;
+        building.numFloors = 4;
+        building.baseColor = {0.7f, 0.7f, 0.7f};
+        building.roofColor = {0.4f, 0.4f, 0.4f};
+        buildings.push_back(building);
     }
     
-    // Add some rocks for additional variety
-    for (int i = 0; i < 50; i++) {
-        SceneryObject rock;
-        rock.position = {
-            fenceMinX + static_cast<float>(rand()) / RAND_MAX * (fenceMaxX - fenceMinX),
-            0.0f,
-            fenceMinZ + static_cast<float>(rand()) / RAND_MAX * (fenceMaxZ - fenceMinZ)
-        };
-        
-        // Check if this position is far enough from the building
-        if (rock.position.x >= buildingMinX && rock.position.x <= buildingMaxX && 
-            rock.position.z >= buildingMinZ && rock.position.z <= buildingMaxZ) {
-            continue;  // Skip this rock if it's in the building area
-        }
-        
-        rock.rotationY = static_cast<float>(rand() % 360);
-        rock.scale = 0.3f + static_cast<float>(rand()) / RAND_MAX * 0.5f;
-        rock.type = SCENERY_ROCK;
-        rock.castShadow = true;
-        sceneryObjects.push_back(rock);
+    // Add a few more buildings for additional variety
+    for (int i = 0; i < 3; i++) {
+        Building building;
+        building.position = {-70.0f + i * 70.0f, 0.0f, 80.0f};
+        building.width = 25.0f + rng.nextInt(10);
+        building.length = 18.0f + rng.nextInt(8);
+        building.height = 18.0f + rng.nextInt(15);
+        building.rotationY = 180.0f;
+        building.numWindows = 5;
+        building.numFloors = 3;
+        building.baseColor = {0.75f, 0.75f, 0.8f};
+        building.roofColor = {0.45f, 0.45f, 0.5f};
+        buildings.push_back(building);
+    }
+    
+    // Pohon, semak dan batu dibangkitkan per chunk oleh world streaming
+    // (lihat generateSceneryChunk dan world.cpp)
+    
+    // Scenery authored dari file level; penempatan bawaan di bawah hanya
+    // dipakai jika level tidak dimuat
+    if (getLevelScenery(sceneryObjects)) {
+        return;
     }
     
     // Keep your existing lamp posts, benches, fountain, and other specific scenery items
@@ -234,96 +284,81 @@ void initScenery() {
         flowerBed.castShadow = false;
         sceneryObjects.push_back(flowerBed);
     }
-    
-    // Distant buildings - keep these as they are
-    for (int i = 0; i < 3; i++) {
-        Building building;
-        building.position = {-60.0f + i * 60.0f, 0.0f, -80.0f};
-        building.width = 20.0f + (rand() % 10);
-        building.length = 15.0f + (rand() % 8);
-        building.height = 20.0f + (rand() % 15);
-        building.rotationY = 0.0f;
-        building.numWindows = 4;
-        building.numFloors = 4;
-        building.baseColor = {0.7f, 0.7f, 0.7f};
-        building.roofColor = {0.4f, 0.4f, 0.4f};
-        building.texture = buildingTexture;
-        buildings.push_back(building);
+}
+
+// Draw one scenery object (juga dipakai saat bake display list chunk)
+void drawSceneryObject(const SceneryObject& obj) {
+    glPushMatrix();
+    glTranslatef(obj.position.x, obj.position.y, obj.position.z);
+    glRotatef(obj.rotationY, 0.0f, 1.0f, 0.0f);
+    glScalef(obj.scale, obj.scale, obj.scale);
+    
+    switch(obj.type) {
+        case SCENERY_TREE:
+            drawTree(0, 0, 0, 1.0f);
+            break;
+        case SCENERY_PINE_TREE:
+            drawPineTree(0, 0, 0, 1.0f);
+            break;
+        case SCENERY_BUSH:
+            drawBush(0, 0, 0, 1.0f);
+            break;
+        case SCENERY_ROCK:
+            drawRock(0, 0, 0, 1.0f);
+            break;
+        case SCENERY_BENCH:
+            drawBench(0, 0, 0, 0, 1.0f);
+            break;
+        case SCENERY_LAMPPOST:
+            drawLampPost(0, 0, 0, 1.0f);
+            break;
+        case SCENERY_FOUNTAIN:
+            drawFountain(0, 0, 0, 1.0f);
+            break;
+        case SCENERY_FLOWER_BED:
+            drawFlowerBed(0, 0, 0, 2.0f, 1.0f, 0);
+            break;
     }
     
-    // Add a few more buildings for additional variety
-    for (int i = 0; i < 3; i++) {
-        Building building;
-        building.position = {-70.0f + i * 70.0f, 0.0f, 80.0f};
-        building.width = 25.0f + (rand() % 10);
-        building.length = 18.0f + (rand() % 8);
-        building.height = 18.0f + (rand() % 15);
-        building.rotationY = 180.0f;
-        building.numWindows = 5;
-        building.numFloors = 3;
-        building.baseColor = {0.75f, 0.75f, 0.8f};
-        building.roofColor = {0.45f, 0.45f, 0.5f};
-        building.texture = buildingTexture;
-        buildings.push_back(building);
-    }
+    glPopMatrix();
 }
 
-// Draw all scenery
-void drawScenery() {
-    // Draw all scenery objects based on their types
-    for (const auto& obj : sceneryObjects) {
-        glPushMatrix();
-        glTranslatef(obj.position.x, obj.position.y, obj.position.z);
-        glRotatef(obj.rotationY, 0.0f, 1.0f, 0.0f);
-        glScalef(obj.scale, obj.scale, obj.scale);
-        
-        switch(obj.type) {
-            case SCENERY_TREE:
-                drawTree(0, 0, 0, 1.0f);
-                break;
-            case SCENERY_PINE_TREE:
-                drawPineTree(0, 0, 0, 1.0f);
-                break;
-            case SCENERY_BUSH:
-                drawBush(0, 0, 0, 1.0f);
-                break;
-            case SCENERY_ROCK:
-                drawRock(0, 0, 0, 1.0f);
-                break;
-            case SCENERY_BENCH:
-                drawBench(0, 0, 0, 0, 1.0f);
-                break;
-            case SCENERY_LAMPPOST:
-                drawLampPost(0, 0, 0, 1.0f);
-                break;
-            case SCENERY_FOUNTAIN:
-                drawFountain(0, 0, 0, 1.0f);
-                break;
-            case SCENERY_FLOWER_BED:
-                drawFlowerBed(0, 0, 0, 2.0f, 1.0f, 0);
-                break;
-        }
-        
-        glPopMatrix();
+static void drawSceneryItem(int index) {
+    drawSceneryObject(sceneryObjects[index]);
+}
+
+static void drawBuildingItem(int index) {
+    drawDistantBuilding(buildings[index]);
+}
+
+// Send all scenery to the render queue
+void submitScenery() {
+    // Objek authored (bench, lamp, fountain, ...); pohon/semak/batu
+    // dikirim per chunk oleh submitWorldChunks()
+    const unsigned state = RENDER_LIGHTING | RENDER_SHADOWED;
+    for (size_t i = 0; i < sceneryObjects.size(); i++) {
+        const Position& pos = sceneryObjects[i].position;
+        submitRenderItem(makeRenderKey(RENDER_PASS_OPAQUE, state, atlasTexture, renderDistanceSq(pos.x, pos.y, pos.z)),
+                         drawSceneryItem, (int)i);
     }
     
-    // Draw all buildings
-    for (const auto& building : buildings) {
-        drawDistantBuilding(building);
+    // All buildings
+    for (size_t i = 0; i < buildings.size(); i++) {
+        const Building& building = buildings[i];
+        float distanceSq = renderDistanceSq(building.position.x, building.position.y + building.height * 0.5f,
+                                            building.position.z);
+        submitRenderItem(makeRenderKey(RENDER_PASS_OPAQUE, state, atlasTexture, distanceSq),
+                         drawBuildingItem, (int)i);
     }
 }
 
 void drawTree(float x, float y, float z, float scale) {
-    // Draw tree shadow first
-    //drawTreeShadow(x, z, scale);
-    
-
     glPushMatrix();
     glTranslatef(x, y, z);
     glScalef(scale, scale, scale);
     
     // Trunk
-    glColor3f(0.5f, 0.35f, 0.05f);
+    glsColor3f(0.5f, 0.35f, 0.05f);
     glPushMatrix();
     glRotatef(-90, 1, 0, 0);
     GLUquadricObj *trunk = gluNewQuadric();
@@ -333,7 +368,7 @@ void drawTree(float x, float y, float z, float scale) {
     glPopMatrix();
     
     // Leaves - multiple layers for fuller appearance
-    glColor3f(0.1f, 0.6f, 0.1f);
+    glsColor3f(0.1f, 0.6f, 0.1f);
     
     // Bottom layer - widest
     glPushMatrix();
@@ -358,15 +393,12 @@ void drawTree(float x, float y, float z, float scale) {
 
 // Pine tree - different style for variety
 void drawPineTree(float x, float y, float z, float scale) {
-    // Draw tree shadow first
-    //drawPineTreeShadow(x, z, scale);
-    
     glPushMatrix();
     glTranslatef(x, y, z);
     glScalef(scale, scale, scale);
     
     // Trunk
-    glColor3f(0.45f, 0.30f, 0.05f);
+    glsColor3f(0.45f, 0.30f, 0.05f);
     glPushMatrix();
     glRotatef(-90, 1, 0, 0);
     GLUquadricObj *trunk = gluNewQuadric();
@@ -376,7 +408,7 @@ void drawPineTree(float x, float y, float z, float scale) {
     glPopMatrix();
     
     // Pine needles - multiple cones stacked
-    glColor3f(0.0f, 0.5f, 0.1f);
+    glsColor3f(0.0f, 0.5f, 0.1f);
     
     // Bottom layer - widest
     glPushMatrix();
@@ -416,7 +448,7 @@ void drawBush(float x, float y, float z, float scale) {
     glScalef(scale, scale * 0.7f, scale);
     
     // Main bush shape
-    glColor3f(0.0f, 0.5f, 0.0f);
+    glsColor3f(0.0f, 0.5f, 0.0f);
     
     // Multiple spheres for more detailed shape
     glutSolidSphere(0.6f, 12, 12);
@@ -450,9 +482,12 @@ void drawRock(float x, float y, float z, float scale) {
     glTranslatef(x, y, z);
     glScalef(scale, scale * 0.6f, scale);
     
-    glEnable(GL_TEXTURE_2D);
-    glBindTexture(GL_TEXTURE_2D, rockTexture);
-    glColor3f(0.7f, 0.7f, 0.7f);
+    // Bola glut tidak punya texcoord: satu warna dari tile batu
+    glsEnable(GL_TEXTURE_2D);
+    atlasSolidTexCoord(ATLAS_STONE);
+    glsColor3f(0.7f, 0.7f, 0.7f);
+    // Batu kasar: kilau lemah dan lebar
+    glsMaterial(0.1f, 12.0f);
     
     // Create irregular rock shape with multiple spheres
     glutSolidSphere(0.7f, 10, 10);
@@ -467,7 +502,8 @@ void drawRock(float x, float y, float z, float scale) {
     glutSolidSphere(0.4f, 8, 8);
     glPopMatrix();
     
-    glDisable(GL_TEXTURE_2D);
+    glsMaterial(DEFAULT_SPECULAR, DEFAULT_SHININESS);
+    glsDisable(GL_TEXTURE_2D);
     glPopMatrix();
 }
 
@@ -479,11 +515,11 @@ void drawBench(float x, float y, float z, float rotationY, float scale) {
     glScalef(scale, scale, scale);
     
     // Wood texture for bench
-    glEnable(GL_TEXTURE_2D);
-    glBindTexture(GL_TEXTURE_2D, woodTexture);
+    glsEnable(GL_TEXTURE_2D);
+    atlasSolidTexCoord(ATLAS_QUARTZ);
     
     // Bench legs (metal)
-    glColor3f(0.3f, 0.3f, 0.3f);
+    glsColor3f(0.3f, 0.3f, 0.3f);
     
     // Left front leg
     glPushMatrix();
@@ -514,7 +550,7 @@ void drawBench(float x, float y, float z, float rotationY, float scale) {
     glPopMatrix();
     
     // Bench seat (wooden slats)
-    glColor3f(0.6f, 0.4f, 0.2f);
+    glsColor3f(0.6f, 0.4f, 0.2f);
     
     // Draw 5 wooden slats for the seat
     for (int i = 0; i < 5; i++) {
@@ -538,7 +574,7 @@ void drawBench(float x, float y, float z, float rotationY, float scale) {
         glPopMatrix();
     }
     
-    glDisable(GL_TEXTURE_2D);
+    glsDisable(GL_TEXTURE_2D);
     glPopMatrix();
 }
 
@@ -549,7 +585,7 @@ void drawLampPost(float x, float y, float z, float scale) {
     glScalef(scale, scale, scale);
     
     // Post (metal gray)
-    glColor3f(0.4f, 0.4f, 0.4f);
+    glsColor3f(0.4f, 0.4f, 0.4f);
     
     // Main pole
     glPushMatrix();
@@ -564,7 +600,7 @@ void drawLampPost(float x, float y, float z, float scale) {
     glTranslatef(0.0f, 3.0f, 0.0f);
     
     // Lamp base
-    glColor3f(0.3f, 0.3f, 0.3f);
+    glsColor3f(0.3f, 0.3f, 0.3f);
     glPushMatrix();
     glRotatef(-90, 1, 0, 0);
     GLUquadricObj *base = gluNewQuadric();
@@ -572,13 +608,19 @@ void drawLampPost(float x, float y, float z, float scale) {
     gluDeleteQuadric(base);
     glPopMatrix();
     
-    // Lamp globe
-    glColor4f(0.9f, 0.9f, 0.6f, 0.8f);
-    glutSolidSphere(0.25f, 12, 12);
-    
-    // Light emission effect with smaller brighter sphere
-    glColor4f(1.0f, 1.0f, 0.7f, 1.0f);
-    glutSolidSphere(0.15f, 12, 12);
+    // Lamp globe. Cahaya titiknya ada di pusat bola (lights.cpp), jadi bola
+    // digambar tanpa lighting supaya tampak menyala, bukan gelap dari dalam
+    {
+        static const GLenum globeCaps[] = {GL_LIGHTING};
+        GLStateBlock stateBlock(globeCaps, 1);
+        glsDisable(GL_LIGHTING);
+        glsColor4f(0.9f, 0.9f, 0.6f, 0.8f);
+        glutSolidSphere(0.25f, 12, 12);
+        
+        // Light emission effect with smaller brighter sphere
+        glsColor4f(1.0f, 1.0f, 0.7f, 1.0f);
+        glutSolidSphere(0.15f, 12, 12);
+    }
     
     glPopMatrix();
     
@@ -591,12 +633,11 @@ void drawDistantBuilding(const Building& building) {
     glTranslatef(building.position.x, building.position.y, building.position.z);
     glRotatef(building.rotationY, 0.0f, 1.0f, 0.0f);
     
-    // Enable texture
-    glEnable(GL_TEXTURE_2D);
-    glBindTexture(GL_TEXTURE_2D, building.texture);
+    // Enable texture (atlas sudah ter-bind, lihat renderScene)
+    glsEnable(GL_TEXTURE_2D);
     
     // Main building body
-    glColor3f(building.baseColor.r, building.baseColor.g, building.baseColor.b);
+    glsColor3f(building.baseColor.r, building.baseColor.g, building.baseColor.b);
     
     // Draw the building box
     float width = building.width;
@@ -604,44 +645,32 @@ void drawDistantBuilding(const Building& building) {
     float height = building.height;
     
     // Front face with windows
-    glBegin(GL_QUADS);
     glNormal3f(0.0f, 0.0f, 1.0f);
-    glTexCoord2f(0.0f, 0.0f); glVertex3f(-width/2, 0.0f, length/2);
-    glTexCoord2f(3.0f, 0.0f); glVertex3f(width/2, 0.0f, length/2);
-    glTexCoord2f(3.0f, 3.0f); glVertex3f(width/2, height, length/2);
-    glTexCoord2f(0.0f, 3.0f); glVertex3f(-width/2, height, length/2);
-    glEnd();
+    const GLfloat frontFace[4][3] = {{-width/2, 0.0f, length/2}, {width/2, 0.0f, length/2},
+                                     {width/2, height, length/2}, {-width/2, height, length/2}};
+    atlasQuad(ATLAS_QUARTZ, frontFace, 3.0f, 3.0f);
     
     // Back face
-    glBegin(GL_QUADS);
     glNormal3f(0.0f, 0.0f, -1.0f);
-    glTexCoord2f(0.0f, 0.0f); glVertex3f(-width/2, 0.0f, -length/2);
-    glTexCoord2f(3.0f, 0.0f); glVertex3f(width/2, 0.0f, -length/2);
-    glTexCoord2f(3.0f, 3.0f); glVertex3f(width/2, height, -length/2);
-    glTexCoord2f(0.0f, 3.0f); glVertex3f(-width/2, height, -length/2);
-    glEnd();
+    const GLfloat backFace[4][3] = {{-width/2, 0.0f, -length/2}, {width/2, 0.0f, -length/2},
+                                    {width/2, height, -length/2}, {-width/2, height, -length/2}};
+    atlasQuad(ATLAS_QUARTZ, backFace, 3.0f, 3.0f);
     
     // Left face
-    glBegin(GL_QUADS);
     glNormal3f(-1.0f, 0.0f, 0.0f);
-    glTexCoord2f(0.0f, 0.0f); glVertex3f(-width/2, 0.0f, -length/2);
-    glTexCoord2f(3.0f, 0.0f); glVertex3f(-width/2, 0.0f, length/2);
-    glTexCoord2f(3.0f, 3.0f); glVertex3f(-width/2, height, length/2);
-    glTexCoord2f(0.0f, 3.0f); glVertex3f(-width/2, height, -length/2);
-    glEnd();
+    const GLfloat leftFace[4][3] = {{-width/2, 0.0f, -length/2}, {-width/2, 0.0f, length/2},
+                                    {-width/2, height, length/2}, {-width/2, height, -length/2}};
+    atlasQuad(ATLAS_QUARTZ, leftFace, 3.0f, 3.0f);
     
     // Right face
-    glBegin(GL_QUADS);
     glNormal3f(1.0f, 0.0f, 0.0f);
-    glTexCoord2f(0.0f, 0.0f); glVertex3f(width/2, 0.0f, -length/2);
-    glTexCoord2f(3.0f, 0.0f); glVertex3f(width/2, 0.0f, length/2);
-    glTexCoord2f(3.0f, 3.0f); glVertex3f(width/2, height, length/2);
-    glTexCoord2f(0.0f, 3.0f); glVertex3f(width/2, height, -length/2);
-    glEnd();
+    const GLfloat rightFace[4][3] = {{width/2, 0.0f, -length/2}, {width/2, 0.0f, length/2},
+                                     {width/2, height, length/2}, {width/2, height, -length/2}};
+    atlasQuad(ATLAS_QUARTZ, rightFace, 3.0f, 3.0f);
     
     // Roof with different color
-    glDisable(GL_TEXTURE_2D);
-    glColor3f(building.roofColor.r, building.roofColor.g, building.roofColor.b);
+    glsDisable(GL_TEXTURE_2D);
+    glsColor3f(building.roofColor.r, building.roofColor.g, building.roofColor.b);
     
     glBegin(GL_QUADS);
     glNormal3f(0.0f, 1.0f, 0.0f);
@@ -652,8 +681,8 @@ void drawDistantBuilding(const Building& building) {
     glEnd();
     
     // Draw windows
-    glDisable(GL_TEXTURE_2D);
-    glColor3f(0.9f, 0.9f, 0.6f);
+    glsDisable(GL_TEXTURE_2D);
+    glsColor3f(0.9f, 0.9f, 0.6f);
     
     int numWindows = building.numWindows;
     int numFloors = building.numFloors;
@@ -695,7 +724,7 @@ void drawFountain(float x, float y, float z, float scale) {
     glScalef(scale, scale, scale);
     
     // Base
-    glColor3f(0.7f, 0.7f, 0.7f);
+    glsColor3f(0.7f, 0.7f, 0.7f);
     glPushMatrix();
     glTranslatef(0.0f, 0.1f, 0.0f);
     glScalef(3.0f, 0.2f, 3.0f);
@@ -712,7 +741,7 @@ void drawFountain(float x, float y, float z, float scale) {
     glPopMatrix();
     
     // Inner pool
-    glColor3f(0.2f, 0.4f, 0.8f); // Water blue
+    glsColor3f(0.2f, 0.4f, 0.8f); // Water blue
     glPushMatrix();
     glTranslatef(0.0f, 0.37f, 0.0f);
     glRotatef(-90, 1, 0, 0);
@@ -722,7 +751,7 @@ void drawFountain(float x, float y, float z, float scale) {
     glPopMatrix();
     
     // Central pillar
-    glColor3f(0.7f, 0.7f, 0.7f);
+    glsColor3f(0.7f, 0.7f, 0.7f);
     glPushMatrix();
     glTranslatef(0.0f, 0.3f, 0.0f);
     glRotatef(-90, 1, 0, 0);
@@ -741,9 +770,9 @@ void drawFountain(float x, float y, float z, float scale) {
     glPopMatrix();
     
     // Water particles/spray
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-    glColor4f(0.6f, 0.8f, 1.0f, 0.6f);
+    glsEnable(GL_BLEND);
+    glsBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    glsColor4f(0.6f, 0.8f, 1.0f, 0.6f);
     
     // Generate water droplets in a circular pattern
     for (int i = 0; i < 12; i++) {
@@ -763,7 +792,7 @@ void drawFountain(float x, float y, float z, float scale) {
     glutSolidSphere(0.08f, 10, 10);
     glPopMatrix();
     
-    glDisable(GL_BLEND);
+    glsDisable(GL_BLEND);
     glPopMatrix();
 }
 
@@ -774,14 +803,14 @@ void drawFlowerBed(float x, float y, float z, float width, float length, float r
     glRotatef(rotationY, 0, 1, 0);
     
     // Soil/dirt area
-    glColor3f(0.3f, 0.2f, 0.1f);
+    glsColor3f(0.3f, 0.2f, 0.1f);
     glPushMatrix();
     glScalef(width, 0.1f, length);
     glutSolidCube(1.0f);
     glPopMatrix();
     
     // Border stones
-    glColor3f(0.6f, 0.6f, 0.6f);
+    glsColor3f(0.6f, 0.6f, 0.6f);
     
     // Four sides of border stones
     float halfWidth = width / 2;
@@ -820,24 +849,26 @@ void drawFlowerBed(float x, float y, float z, float width, float length, float r
     }
     
     // Enable texture for flowers
-    glEnable(GL_TEXTURE_2D);
-    glBindTexture(GL_TEXTURE_2D, woodTexture);
+    glsEnable(GL_TEXTURE_2D);
+    atlasSolidTexCoord(ATLAS_QUARTZ);
     
     // Random flowers
-    srand(x + z); // Use position as seed for consistent random pattern
+    // Stream kosmetik dengan posisi bed sebagai sub-stream: pola selalu sama
+    // setiap frame tanpa me-reseed generator global
+    RandomStream rng = makeRandomStream(RNG_COSMETIC, ((uint32_t)(int)x * 73856093u) ^ ((uint32_t)(int)z * 19349663u));
     
     for (int i = 0; i < 20; i++) {
-        float posX = ((float)rand() / RAND_MAX) * width - width/2;
-        float posZ = ((float)rand() / RAND_MAX) * length - length/2;
-        float height = 0.3f + ((float)rand() / RAND_MAX) * 0.15f;
+        float posX = rng.nextFloat() * width - width/2;
+        float posZ = rng.nextFloat() * length - length/2;
+        float height = rng.range(0.3f, 0.45f);
         
         // Randomize flower colors
-        float r = 0.1f + ((float)rand() / RAND_MAX) * 0.9f;
-        float g = 0.1f + ((float)rand() / RAND_MAX) * 0.2f;
-        float b = 0.1f + ((float)rand() / RAND_MAX) * 0.2;
+        float r = rng.range(0.1f, 1.0f);
+        float g = rng.range(0.1f, 0.3f);
+        float b = rng.range(0.1f, 0.3f);
         
         // Stem
-        glColor3f(0.1f, 0.5f, 0.1f);
+        glsColor3f(0.1f, 0.5f, 0.1f);
         glPushMatrix();
         glTranslatef(posX, 0.1f, posZ);
         glRotatef(-90, 1, 0, 0);
@@ -847,13 +878,13 @@ void drawFlowerBed(float x, float y, float z, float width, float length, float r
         glPopMatrix();
         
         // Flower
-        glColor3f(r, g, b);
+        glsColor3f(r, g, b);
         glPushMatrix();
         glTranslatef(posX, 0.1f + height, posZ);
         glutSolidSphere(0.18f, 8, 8);
         glPopMatrix();
     }
     
-    glDisable(GL_TEXTURE_2D);
+    glsDisable(GL_TEXTURE_2D);
     glPopMatrix();
 }
\ No newline at end of file
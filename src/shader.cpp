@@ -0,0 +1,587 @@
+/*
+ * ==========================================================================
+ * SHADER LIGHTING
+ * ==========================================================================
+ *
+ * File: shader.cpp
+ * Author: Project Team
+ * Date: June 2025
+ *
+ * DESCRIPTION:
+ * -----------
+ * Program GLSL untuk lighting per-pixel yang menggantikan GL_LIGHT0
+ * fixed-function di seluruh scene. Satu program dipakai untuk semua
+ * objek; perbedaan per objek lewat uniform:
+ * - useTexture / useLighting mengikuti GL_TEXTURE_2D / GL_LIGHTING.
+ *   glstate.cpp meneruskan setiap perubahan capability itu ke sini, dan
+ *   saat display list di-compile glUniform ikut direkam ke list, jadi
+ *   chunk dunia dan peta yang sudah di-bake tetap benar.
+ * - material (kekuatan specular, shininess) per draw lewat glsMaterial().
+ * - Warna objek tetap dari glColor (gl_Color), jadi kode gambar tidak
+ *   berubah.
+ *
+ * Cahaya titik (lampu jalan, peluru, muzzle flash) memakai clustered
+ * forward shading: lights.cpp membagi frustum kamera menjadi froxel
+ * (tile layar x slice kedalaman logaritmik) dan menulis daftar cahaya
+ * per froxel ke tekstur float. Fragment shader mencari froxel-nya dari
+ * gl_FragCoord dan kedalaman view space, lalu hanya mengulang cahaya di
+ * froxel itu (paling banyak MAX_CLUSTER_LIGHTS). Data diambil dengan
+ * texelFetch (330) atau texture2D di tengah texel (120).
+ *
+ * Versi:
+ * - 330: "#version 330 compatibility". Kamera (matriks view, matriks
+ *   shadow) dan cahaya di uniform buffer (blok std140 Camera dan Light),
+ *   di-upload sekali per frame / sekali saat init.
+ * - 120: fallback untuk driver lama, uniform biasa dengan nama yang sama.
+ * - 0: tanpa shader, initLighting() tetap memakai fixed-function.
+ *
+ * Game memakai immediate mode, display list dan objek GLUT, jadi context
+ * tetap compatibility profile: vertex shader membaca gl_Vertex, gl_Normal,
+ * gl_Color dan matriks built-in, bukan atribut generik core profile.
+ * Normal dinormalisasi per pixel (GL_NORMALIZE tidak dipakai oleh
+ * program) dan two-sided lighting memakai gl_FrontFacing.
+ *
+ * Program tetap ter-bind selama pass kedalaman shadow map, karena uniform
+ * yang direkam di display list hanya valid untuk program ini. HUD dan
+ * menu digambar setelah endShaderFrame() dengan fixed-function.
+ *
+ * FUNCTIONS:
+ * ---------
+ * getGLProcAddress()        - Load fungsi GL extension
+ * initShaders()             - Pilih versi, compile dan link program
+ * shadersEnabled()          - Program lighting aktif?
+ * setShaderLight()          - Parameter cahaya matahari
+ * beginShaderFrame()        - Bind program, upload matriks kamera
+ * endShaderFrame()          - Kembali ke fixed-function
+ * setShaderShadowMap()      - Matriks dan filter shadow map
+ * setShaderShadowing()      - Sampling shadow map on/off
+ * setShaderClusters()       - Grid cluster cahaya titik
+ * shaderCapabilityChanged() - Hook glstate untuk lighting/tekstur
+ * shaderMaterialChanged()   - Hook glstate untuk material
+ *
+ * DEPENDENCIES:
+ * -----------
+ * - shader.h  - Deklarasi
+ * - options.h - gameOptions.glslVersion
+ * - lights.h  - MAX_CLUSTER_LIGHTS (batas loop shader)
+ *
+ * ==========================================================================
+ */
+
+#include "shader.h"
+#include "options.h"
+#include "lights.h"
+#include <GL/glext.h>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <GL/glx.h>
+#endif
+
+ShaderStats shaderStats = {0, false};
+
+static PFNGLCREATESHADERPROC createShader = nullptr;
+static PFNGLSHADERSOURCEPROC shaderSource = nullptr;
+static PFNGLCOMPILESHADERPROC compileShader = nullptr;
+static PFNGLGETSHADERIVPROC getShaderiv = nullptr;
+static PFNGLGETSHADERINFOLOGPROC getShaderInfoLog = nullptr;
+static PFNGLDELETESHADERPROC deleteShader = nullptr;
+static PFNGLCREATEPROGRAMPROC createProgram = nullptr;
+static PFNGLATTACHSHADERPROC attachShader = nullptr;
+static PFNGLLINKPROGRAMPROC linkProgram = nullptr;
+static PFNGLGETPROGRAMIVPROC getProgramiv = nullptr;
+static PFNGLGETPROGRAMINFOLOGPROC getProgramInfoLog = nullptr;
+static PFNGLDELETEPROGRAMPROC deleteProgram = nullptr;
+static PFNGLUSEPROGRAMPROC useProgram = nullptr;
+static PFNGLGETUNIFORMLOCATIONPROC getUniformLocation = nullptr;
+static PFNGLUNIFORM1IPROC uniform1i = nullptr;
+static PFNGLUNIFORM1FPROC uniform1f = nullptr;
+static PFNGLUNIFORM2FPROC uniform2f = nullptr;
+static PFNGLUNIFORM4FPROC uniform4f = nullptr;
+static PFNGLUNIFORM4FVPROC uniform4fv = nullptr;
+static PFNGLUNIFORMMATRIX4FVPROC uniformMatrix4fv = nullptr;
+// Uniform buffer (GLSL 330 saja)
+static PFNGLGETUNIFORMBLOCKINDEXPROC getUniformBlockIndex = nullptr;
+static PFNGLUNIFORMBLOCKBINDINGPROC uniformBlockBinding = nullptr;
+static PFNGLGENBUFFERSPROC genBuffers = nullptr;
+static PFNGLBINDBUFFERPROC bindBuffer = nullptr;
+static PFNGLBUFFERDATAPROC bufferData = nullptr;
+static PFNGLBUFFERSUBDATAPROC bufferSubData = nullptr;
+static PFNGLBINDBUFFERBASEPROC bindBufferBase = nullptr;
+
+// Binding point dan layout std140 blok uniform
+static const GLuint CAMERA_BINDING = 0;
+static const GLuint LIGHT_BINDING = 1;
+static const int CAMERA_VIEW_OFFSET = 0;                // mat4 cameraView
+static const int CAMERA_SHADOW_OFFSET = 16 * sizeof(GLfloat);  // mat4 eyeToShadow
+static const int CAMERA_BLOCK_SIZE = 32 * sizeof(GLfloat);
+static const int LIGHT_BLOCK_SIZE = 16 * sizeof(GLfloat);    // 4 x vec4
+
+static GLuint program = 0;
+static GLuint cameraBuffer = 0;
+static GLuint lightBuffer = 0;
+static bool frameActive = false;
+
+// Lokasi uniform; -1 = tidak ada / dioptimasi compiler
+static GLint useTextureLocation = -1;
+static GLint useLightingLocation = -1;
+static GLint useShadowLocation = -1;
+static GLint shadowPcfLocation = -1;
+static GLint shadowTexelLocation = -1;
+static GLint materialLocation = -1;
+static GLint cameraViewLocation = -1;
+static GLint eyeToShadowLocation = -1;
+static GLint lightLocations[4] = {-1, -1, -1, -1};  // direction, ambient, diffuse, specular
+static GLint useClustersLocation = -1;
+static GLint clusterGridLocation = -1;
+static GLint clusterScreenLocation = -1;
+static GLint clusterDepthLocation = -1;
+static GLint textureSizeLocations[3] = {-1, -1, -1};  // cahaya, cluster, index (hanya 120)
+
+// Nilai terakhir dari glstate di luar compile list; di-upload saat frame mulai
+static bool textureEnabled = false;
+static bool lightingEnabled = false;
+static GLfloat materialSpecular = 1.0f;
+static GLfloat materialShininess = 100.0f;
+
+// ---- Source GLSL ----------------------------------------------------------
+
+static const char* PREAMBLE_330 =
+    "#version 330 compatibility\n"
+    "layout(std140) uniform Camera {\n"
+    "    mat4 cameraView;\n"
+    "    mat4 eyeToShadow;\n"
+    "};\n"
+    "layout(std140) uniform Light {\n"
+    "    vec4 lightDirection;\n"
+    "    vec4 lightAmbient;\n"
+    "    vec4 lightDiffuse;\n"
+    "    vec4 lightSpecular;\n"
+    "};\n"
+    "#define VERTEX_OUT out\n"
+    "#define FRAGMENT_IN in\n"
+    "#define TEXTURE_2D(s, c) texture(s, c)\n"
+    "#define SHADOW_PROJ(s, c) textureProj(s, c)\n"
+    "#define FETCH(s, c, size) texelFetch(s, ivec2(c), 0)\n";
+
+static const char* PREAMBLE_120 =
+    "#version 120\n"
+    "uniform mat4 cameraView;\n"
+    "uniform mat4 eyeToShadow;\n"
+    "uniform vec4 lightDirection;\n"
+    "uniform vec4 lightAmbient;\n"
+    "uniform vec4 lightDiffuse;\n"
+    "uniform vec4 lightSpecular;\n"
+    "#define VERTEX_OUT varying\n"
+    "#define FRAGMENT_IN varying\n"
+    "#define TEXTURE_2D(s, c) texture2D(s, c)\n"
+    // GL_DEPTH_TEXTURE_MODE = GL_ALPHA: hasil perbandingan ada di alpha
+    "#define SHADOW_PROJ(s, c) shadow2DProj(s, c).a\n"
+    // Tanpa texelFetch: sampling NEAREST tepat di tengah texel
+    "#define FETCH(s, c, size) texture2D(s, ((c) + 0.5) / (size))\n";
+
+static const char* VERTEX_BODY =
+    "VERTEX_OUT vec3 eyePosition;\n"
+    "VERTEX_OUT vec3 eyeNormal;\n"
+    "VERTEX_OUT vec3 eyeLight;\n"
+    "VERTEX_OUT vec4 vertexColor;\n"
+    "VERTEX_OUT vec2 texCoord;\n"
+    "VERTEX_OUT vec4 shadowCoord;\n"
+    "void main() {\n"
+    "    vec4 eye = gl_ModelViewMatrix * gl_Vertex;\n"
+    "    eyePosition = eye.xyz;\n"
+    "    eyeNormal = gl_NormalMatrix * gl_Normal;\n"
+    "    eyeLight = mat3(cameraView) * lightDirection.xyz;\n"
+    "    vertexColor = gl_Color;\n"
+    "    texCoord = gl_MultiTexCoord0.xy;\n"
+    "    shadowCoord = eyeToShadow * eye;\n"
+    "    gl_ClipVertex = eye;\n"
+    "    gl_Position = gl_ProjectionMatrix * eye;\n"
+    "}\n";
+
+static const char* FRAGMENT_BODY =
+    "FRAGMENT_IN vec3 eyePosition;\n"
+    "FRAGMENT_IN vec3 eyeNormal;\n"
+    "FRAGMENT_IN vec3 eyeLight;\n"
+    "FRAGMENT_IN vec4 vertexColor;\n"
+    "FRAGMENT_IN vec2 texCoord;\n"
+    "FRAGMENT_IN vec4 shadowCoord;\n"
+    "uniform sampler2D diffuseMap;\n"
+    "uniform sampler2DShadow shadowMap;\n"
+    "uniform bool useTexture;\n"
+    "uniform bool useLighting;\n"
+    "uniform bool useShadow;\n"
+    "uniform bool shadowPcf;\n"
+    "uniform float shadowTexel;\n"
+    "uniform vec2 material;\n"      // x = kekuatan specular, y = shininess
+    "uniform sampler2D lightData;\n"       // Baris 0: posisi view space + radius, baris 1: warna
+    "uniform sampler2D clusterData;\n"     // Per cluster: offset (L) dan jumlah (A)
+    "uniform sampler2D lightIndices;\n"    // Index cahaya, berurutan per cluster
+    "uniform bool useClusters;\n"
+    "uniform vec4 clusterGrid;\n"          // Tile X, tile Y, slice
+    "uniform vec4 clusterScreen;\n"        // Pojok viewport, ukuran tile
+    "uniform vec4 clusterDepth;\n"         // near, (slice - 1) / log(far / near), far
+    "uniform vec2 lightTextureSize;\n"
+    "uniform vec2 clusterTextureSize;\n"
+    "uniform vec2 indexTextureSize;\n"
+    "float shadowFactor() {\n"
+    "    if (!useShadow) return 1.0;\n"
+    "    if (!shadowPcf) return SHADOW_PROJ(shadowMap, shadowCoord);\n"
+    // 4 tap, masing-masing sudah PCF 2x2 dari filter GL_LINEAR
+    "    float d = shadowTexel * shadowCoord.w;\n"
+    "    return 0.25 * (SHADOW_PROJ(shadowMap, shadowCoord + vec4(-d, -d, 0.0, 0.0))\n"
+    "                 + SHADOW_PROJ(shadowMap, shadowCoord + vec4( d, -d, 0.0, 0.0))\n"
+    "                 + SHADOW_PROJ(shadowMap, shadowCoord + vec4(-d,  d, 0.0, 0.0))\n"
+    "                 + SHADOW_PROJ(shadowMap, shadowCoord + vec4( d,  d, 0.0, 0.0)));\n"
+    "}\n"
+    "vec3 pointLights(vec3 n) {\n"
+    "    float depth = -eyePosition.z;\n"
+    "    if (!useClusters || depth >= clusterDepth.z) return vec3(0.0);\n"
+    "    float slice = 0.0;\n"
+    "    if (depth > clusterDepth.x) {\n"
+    "        slice = min(floor(log(depth / clusterDepth.x) * clusterDepth.y) + 1.0, clusterGrid.z - 1.0);\n"
+    "    }\n"
+    "    vec2 tile = clamp(floor((gl_FragCoord.xy - clusterScreen.xy) / clusterScreen.zw),\n"
+    "                      vec2(0.0), clusterGrid.xy - 1.0);\n"
+    "    vec4 cluster = FETCH(clusterData, vec2(tile.x + tile.y * clusterGrid.x, slice), clusterTextureSize);\n"
+    "    vec3 sum = vec3(0.0);\n"
+    "    for (int i = 0; i < MAX_CLUSTER_LIGHTS; i++) {\n"
+    "        if (float(i) >= cluster.a) break;\n"
+    "        float entry = cluster.r + float(i);\n"
+    "        vec2 entryCoord = vec2(mod(entry, indexTextureSize.x), floor(entry / indexTextureSize.x));\n"
+    "        float index = FETCH(lightIndices, entryCoord, indexTextureSize).r;\n"
+    "        vec4 light = FETCH(lightData, vec2(index, 0.0), lightTextureSize);\n"
+    "        vec3 toLight = light.xyz - eyePosition;\n"
+    "        float distanceSq = dot(toLight, toLight);\n"
+    "        float radiusSq = light.w * light.w;\n"
+    "        if (distanceSq >= radiusSq) continue;\n"
+    // Falloff halus yang tepat nol di radius cahaya
+    "        float falloff = 1.0 - distanceSq / radiusSq;\n"
+    "        float diffuse = max(dot(n, toLight * inversesqrt(distanceSq)), 0.0);\n"
+    "        sum += FETCH(lightData, vec2(index, 1.0), lightTextureSize).rgb * (diffuse * falloff * falloff);\n"
+    "    }\n"
+    "    return sum;\n"
+    "}\n"
+    "void main() {\n"
+    "    vec4 color = vertexColor;\n"
+    "    if (useTexture) color *= TEXTURE_2D(diffuseMap, texCoord);\n"
+    "    if (useLighting) {\n"
+    "        vec3 n = normalize(eyeNormal);\n"
+    "        if (!gl_FrontFacing) n = -n;\n"
+    "        vec3 l = normalize(eyeLight);\n"
+    "        float diffuse = max(dot(n, l), 0.0);\n"
+    "        float specular = 0.0;\n"
+    "        if (diffuse > 0.0) {\n"
+    "            vec3 h = normalize(l + normalize(-eyePosition));\n"
+    "            specular = material.x * pow(max(dot(n, h), 0.0), material.y);\n"
+    "        }\n"
+    "        float lit = shadowFactor();\n"
+    "        color.rgb = color.rgb * (lightAmbient.rgb + lit * diffuse * lightDiffuse.rgb + pointLights(n))\n"
+    "                  + lit * specular * lightSpecular.rgb;\n"
+    "    }\n"
+    "    gl_FragColor = color;\n"
+    "}\n";
+
+// ---- Helper ---------------------------------------------------------------
+
+void* getGLProcAddress(const char* name) {
+#ifdef _WIN32
+    return (void*)wglGetProcAddress(name);
+#else
+    return (void*)glXGetProcAddressARB((const GLubyte*)name);
+#endif
+}
+
+template <typename T>
+static bool loadProc(T& function, const char* name) {
+    function = (T)getGLProcAddress(name);
+    return function != nullptr;
+}
+
+static bool loadShaderFunctions() {
+    return loadProc(createShader, "glCreateShader") && loadProc(shaderSource, "glShaderSource")
+        && loadProc(compileShader, "glCompileShader") && loadProc(getShaderiv, "glGetShaderiv")
+        && loadProc(getShaderInfoLog, "glGetShaderInfoLog") && loadProc(deleteShader, "glDeleteShader")
+        && loadProc(createProgram, "glCreateProgram") && loadProc(attachShader, "glAttachShader")
+        && loadProc(linkProgram, "glLinkProgram") && loadProc(getProgramiv, "glGetProgramiv")
+        && loadProc(getProgramInfoLog, "glGetProgramInfoLog") && loadProc(deleteProgram, "glDeleteProgram")
+        && loadProc(useProgram, "glUseProgram") && loadProc(getUniformLocation, "glGetUniformLocation")
+        && loadProc(uniform1i, "glUniform1i") && loadProc(uniform1f, "glUniform1f")
+        && loadProc(uniform2f, "glUniform2f") && loadProc(uniform4f, "glUniform4f")
+        && loadProc(uniform4fv, "glUniform4fv")
+        && loadProc(uniformMatrix4fv, "glUniformMatrix4fv");
+}
+
+static bool loadUniformBufferFunctions() {
+    return loadProc(getUniformBlockIndex, "glGetUniformBlockIndex")
+        && loadProc(uniformBlockBinding, "glUniformBlockBinding")
+        && loadProc(genBuffers, "glGenBuffers") && loadProc(bindBuffer, "glBindBuffer")
+        && loadProc(bufferData, "glBufferData") && loadProc(bufferSubData, "glBufferSubData")
+        && loadProc(bindBufferBase, "glBindBufferBase");
+}
+
+static GLuint compileStage(GLenum stage, const char* preamble, const char* body) {
+    GLuint shader = createShader(stage);
+    char limits[64];
+    std::snprintf(limits, sizeof(limits), "#define MAX_CLUSTER_LIGHTS %d\n", MAX_CLUSTER_LIGHTS);
+    const char* sources[3] = {preamble, limits, body};
+    shaderSource(shader, 3, sources, nullptr);
+    compileShader(shader);
+    GLint status = GL_FALSE;
+    getShaderiv(shader, GL_COMPILE_STATUS, &status);
+    if (status != GL_TRUE) {
+        char log[1024] = "";
+        getShaderInfoLog(shader, sizeof(log), nullptr, log);
+        std::cerr << (stage == GL_VERTEX_SHADER ? "Vertex" : "Fragment") << " shader error:\n" << log << std::endl;
+        deleteShader(shader);
+        return 0;
+    }
+    return shader;
+}
+
+// Compile dan link satu versi; 0 jika gagal
+static GLuint buildProgram(const char* preamble) {
+    GLuint vertex = compileStage(GL_VERTEX_SHADER, preamble, VERTEX_BODY);
+    if (vertex == 0) return 0;
+    GLuint fragment = compileStage(GL_FRAGMENT_SHADER, preamble, FRAGMENT_BODY);
+    if (fragment == 0) {
+        deleteShader(vertex);
+        return 0;
+    }
+    GLuint linked = createProgram();
+    attachShader(linked, vertex);
+    attachShader(linked, fragment);
+    linkProgram(linked);
+    // Shader dihapus bersama program
+    deleteShader(vertex);
+    deleteShader(fragment);
+    GLint status = GL_FALSE;
+    getProgramiv(linked, GL_LINK_STATUS, &status);
+    if (status != GL_TRUE) {
+        char log[1024] = "";
+        getProgramInfoLog(linked, sizeof(log), nullptr, log);
+        std::cerr << "Shader link error:\n" << log << std::endl;
+        deleteProgram(linked);
+        return 0;
+    }
+    return linked;
+}
+
+static bool setupUniformBuffers() {
+    GLuint cameraBlock = getUniformBlockIndex(program, "Camera");
+    GLuint lightBlock = getUniformBlockIndex(program, "Light");
+    if (cameraBlock == GL_INVALID_INDEX || lightBlock == GL_INVALID_INDEX) return false;
+    uniformBlockBinding(program, cameraBlock, CAMERA_BINDING);
+    uniformBlockBinding(program, lightBlock, LIGHT_BINDING);
+
+    GLuint buffers[2];
+    genBuffers(2, buffers);
+    cameraBuffer = buffers[0];
+    lightBuffer = buffers[1];
+    // Matriks shadow identitas sampai pass kedalaman pertama
+    GLfloat camera[32] = {0.0f};
+    for (int i = 0; i < 4; i++) {
+        camera[i * 5] = 1.0f;
+        camera[16 + i * 5] = 1.0f;
+    }
+    bindBuffer(GL_UNIFORM_BUFFER, cameraBuffer);
+    bufferData(GL_UNIFORM_BUFFER, CAMERA_BLOCK_SIZE, camera, GL_DYNAMIC_DRAW);
+    bindBuffer(GL_UNIFORM_BUFFER, lightBuffer);
+    bufferData(GL_UNIFORM_BUFFER, LIGHT_BLOCK_SIZE, nullptr, GL_STATIC_DRAW);
+    bindBuffer(GL_UNIFORM_BUFFER, 0);
+    bindBufferBase(GL_UNIFORM_BUFFER, CAMERA_BINDING, cameraBuffer);
+    bindBufferBase(GL_UNIFORM_BUFFER, LIGHT_BINDING, lightBuffer);
+    return true;
+}
+
+// ---- API ------------------------------------------------------------------
+
+bool initShaders() {
+    int requested = gameOptions.glslVersion;
+    if (requested == 0) {
+        std::cout << "Lighting: fixed-function (--glsl 0)" << std::endl;
+        return false;
+    }
+
+    // "1.20", "3.30 ...", "4.60 NVIDIA ..." -> 120, 330, 460
+    const char* versionString = (const char*)glGetString(GL_SHADING_LANGUAGE_VERSION);
+    int major = 0, minor = 0;
+    if (versionString == nullptr || std::sscanf(versionString, "%d.%d", &major, &minor) != 2
+        || !loadShaderFunctions()) {
+        std::cout << "Lighting: GLSL not supported by driver, using fixed-function" << std::endl;
+        return false;
+    }
+    int supported = major * 100 + minor;
+
+    // Versi tertinggi yang diminta dan didukung, turun ke 120 jika gagal
+    if (supported >= 330 && requested != 120 && loadUniformBufferFunctions()) {
+        program = buildProgram(PREAMBLE_330);
+        if (program != 0 && !setupUniformBuffers()) {
+            deleteProgram(program);
+            program = 0;
+        }
+        if (program != 0) {
+            shaderStats.glslVersion = 330;
+            shaderStats.uniformBuffers = true;
+        }
+    }
+    if (program == 0 && supported >= 120) {
+        program = buildProgram(PREAMBLE_120);
+        if (program != 0) shaderStats.glslVersion = 120;
+    }
+    if (program == 0) {
+        std::cout << "Lighting: shader compile failed, using fixed-function" << std::endl;
+        return false;
+    }
+
+    useTextureLocation = getUniformLocation(program, "useTexture");
+    useLightingLocation = getUniformLocation(program, "useLighting");
+    useShadowLocation = getUniformLocation(program, "useShadow");
+    shadowPcfLocation = getUniformLocation(program, "shadowPcf");
+    shadowTexelLocation = getUniformLocation(program, "shadowTexel");
+    materialLocation = getUniformLocation(program, "material");
+    useClustersLocation = getUniformLocation(program, "useClusters");
+    clusterGridLocation = getUniformLocation(program, "clusterGrid");
+    clusterScreenLocation = getUniformLocation(program, "clusterScreen");
+    clusterDepthLocation = getUniformLocation(program, "clusterDepth");
+    textureSizeLocations[0] = getUniformLocation(program, "lightTextureSize");
+    textureSizeLocations[1] = getUniformLocation(program, "clusterTextureSize");
+    textureSizeLocations[2] = getUniformLocation(program, "indexTextureSize");
+    if (!shaderStats.uniformBuffers) {
+        cameraViewLocation = getUniformLocation(program, "cameraView");
+        eyeToShadowLocation = getUniformLocation(program, "eyeToShadow");
+        lightLocations[0] = getUniformLocation(program, "lightDirection");
+        lightLocations[1] = getUniformLocation(program, "lightAmbient");
+        lightLocations[2] = getUniformLocation(program, "lightDiffuse");
+        lightLocations[3] = getUniformLocation(program, "lightSpecular");
+    }
+
+    // Sampler tetap: unit 0 = tekstur objek, unit 1 = shadow map,
+    // unit 2..4 = grid cluster cahaya titik
+    useProgram(program);
+    uniform1i(getUniformLocation(program, "diffuseMap"), 0);
+    uniform1i(getUniformLocation(program, "shadowMap"), 1);
+    uniform1i(getUniformLocation(program, "lightData"), 2);
+    uniform1i(getUniformLocation(program, "clusterData"), 3);
+    uniform1i(getUniformLocation(program, "lightIndices"), 4);
+    uniform1i(useShadowLocation, 0);
+    uniform1i(useClustersLocation, 0);
+    useProgram(0);
+
+    std::cout << "Lighting: GLSL " << shaderStats.glslVersion << " per-pixel"
+              << (shaderStats.uniformBuffers ? " (uniform buffers)" : "") << std::endl;
+    return true;
+}
+
+bool shadersEnabled() {
+    return program != 0;
+}
+
+void setShaderLight(const GLfloat direction[3], const GLfloat ambient[4],
+                    const GLfloat diffuse[4], const GLfloat specular[4]) {
+    if (program == 0) return;
+    GLfloat block[16] = {direction[0], direction[1], direction[2], 0.0f};
+    std::memcpy(block + 4, ambient, 4 * sizeof(GLfloat));
+    std::memcpy(block + 8, diffuse, 4 * sizeof(GLfloat));
+    std::memcpy(block + 12, specular, 4 * sizeof(GLfloat));
+
+    if (shaderStats.uniformBuffers) {
+        bindBuffer(GL_UNIFORM_BUFFER, lightBuffer);
+        bufferSubData(GL_UNIFORM_BUFFER, 0, LIGHT_BLOCK_SIZE, block);
+        bindBuffer(GL_UNIFORM_BUFFER, 0);
+    } else {
+        useProgram(program);
+        for (int i = 0; i < 4; i++) uniform4fv(lightLocations[i], 1, block + i * 4);
+        useProgram(0);
+    }
+}
+
+void beginShaderFrame() {
+    if (program == 0) return;
+    GLfloat view[16];
+    glGetFloatv(GL_MODELVIEW_MATRIX, view);
+
+    useProgram(program);
+    frameActive = true;
+    if (shaderStats.uniformBuffers) {
+        bindBuffer(GL_UNIFORM_BUFFER, cameraBuffer);
+        bufferSubData(GL_UNIFORM_BUFFER, CAMERA_VIEW_OFFSET, 16 * sizeof(GLfloat), view);
+        bindBuffer(GL_UNIFORM_BUFFER, 0);
+    } else {
+        uniformMatrix4fv(cameraViewLocation, 1, GL_FALSE, view);
+    }
+    // Perubahan di luar frame tidak dikirim; samakan sekarang
+    uniform1i(useTextureLocation, textureEnabled ? 1 : 0);
+    uniform1i(useLightingLocation, lightingEnabled ? 1 : 0);
+    uniform1i(useShadowLocation, 0);
+    uniform1i(useClustersLocation, 0);
+    uniform2f(materialLocation, materialSpecular, materialShininess);
+}
+
+void endShaderFrame() {
+    if (!frameActive) return;
+    useProgram(0);
+    frameActive = false;
+}
+
+void setShaderShadowMap(const GLfloat eyeToShadow[16], float texelSize, bool pcf) {
+    if (!frameActive) return;
+    if (shaderStats.uniformBuffers) {
+        bindBuffer(GL_UNIFORM_BUFFER, cameraBuffer);
+        bufferSubData(GL_UNIFORM_BUFFER, CAMERA_SHADOW_OFFSET, 16 * sizeof(GLfloat), eyeToShadow);
+        bindBuffer(GL_UNIFORM_BUFFER, 0);
+    } else {
+        uniformMatrix4fv(eyeToShadowLocation, 1, GL_FALSE, eyeToShadow);
+    }
+    uniform1f(shadowTexelLocation, texelSize);
+    uniform1i(shadowPcfLocation, pcf ? 1 : 0);
+}
+
+void setShaderShadowing(bool enable) {
+    if (!frameActive) return;
+    uniform1i(useShadowLocation, enable ? 1 : 0);
+}
+
+void setShaderClusters(const ShaderClusterGrid* grid) {
+    if (!frameActive) return;
+    if (grid == nullptr) {
+        uniform1i(useClustersLocation, 0);
+        return;
+    }
+    uniform1i(useClustersLocation, 1);
+    uniform4f(clusterGridLocation, (float)grid->tilesX, (float)grid->tilesY, (float)grid->slices, 0.0f);
+    uniform4f(clusterScreenLocation, grid->viewportX, grid->viewportY, grid->tileWidth, grid->tileHeight);
+    uniform4f(clusterDepthLocation, grid->sliceNear,
+              (grid->slices - 1) / std::log(grid->sliceFar / grid->sliceNear), grid->sliceFar, 0.0f);
+    uniform2f(textureSizeLocations[0], (float)grid->lightTextureWidth, 2.0f);
+    uniform2f(textureSizeLocations[1], (float)grid->clusterTextureWidth, (float)grid->clusterTextureHeight);
+    uniform2f(textureSizeLocations[2], (float)grid->indexTextureWidth, (float)grid->indexTextureHeight);
+}
+
+void shaderCapabilityChanged(GLenum cap, bool enable, bool compiling) {
+    GLint location;
+    if (cap == GL_TEXTURE_2D) {
+        location = useTextureLocation;
+        if (!compiling) textureEnabled = enable;
+    } else if (cap == GL_LIGHTING) {
+        location = useLightingLocation;
+        if (!compiling) lightingEnabled = enable;
+    } else {
+        return;
+    }
+    if (program != 0 && (compiling || frameActive)) uniform1i(location, enable ? 1 : 0);
+}
+
+void shaderMaterialChanged(GLfloat specular, GLfloat shininess, bool compiling) {
+    if (!compiling) {
+        materialSpecular = specular;
+        materialShininess = shininess;
+    }
+    if (program != 0 && (compiling || frameActive)) uniform2f(materialLocation, specular, shininess);
+}
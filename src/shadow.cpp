@@ -0,0 +1,588 @@
+/*
+ * ==========================================================================
+ * SHADOW MAP
+ * ==========================================================================
+ *
+ * File: shadow.cpp
+ * Author: Project Team
+ * Date: June 2025
+ *
+ * DESCRIPTION:
+ * -----------
+ * Bayangan dari matahari memakai satu shadow map untuk semua caster,
+ * menggantikan bayangan planar stencil per objek.
+ *
+ * Pass kedalaman (renderShadowPass):
+ * - Kamera ortografis dari arah matahari, berpusat di player dengan radius
+ *   SHADOW_RADIUS. Pusatnya dibulatkan ke ukuran texel supaya tepi
+ *   bayangan tidak bergetar saat player bergerak.
+ * - Hanya depth yang ditulis (color mask mati, polygon offset untuk
+ *   mencegah shadow acne). Caster: chunk dunia (di-cull dengan frustum
+ *   cahaya), scenery authored yang castShadow, gedung, peta, musuh dan
+ *   player.
+ * - Target: FBO (GL_EXT_framebuffer_object) jika ada. Tanpa FBO, pass
+ *   digambar ke back buffer lalu disalin dengan glCopyTexSubImage2D;
+ *   resolusinya dibatasi ukuran window.
+ *
+ * Pass utama dengan shader lighting (shader.cpp): shadow map di unit 1
+ * sebagai sampler2DShadow. Koordinatnya dihitung vertex shader dari
+ * posisi mata dikali eyeToShadow = bias x P x V cahaya x invers kamera.
+ * Area bayangan hanya kehilangan cahaya diffuse dan specular; PCF = 4
+ * tap yang masing-masing sudah PCF 2x2 dari filter GL_LINEAR.
+ *
+ * Pass utama tanpa shader (begin/endShadowReceivers), fixed-function:
+ * - Unit 1: shadow map dengan texgen eye-linear = bias x P x V cahaya dan
+ *   GL_COMPARE_R_TO_TEXTURE. Dengan filter GL_LINEAR driver melakukan
+ *   PCF 2x2 di hardware. Combiner menyimpan faktor cahaya
+ *   f = mix(ambient, 1, s) di alpha, warna diteruskan apa adanya.
+ * - Unit 2: warna = warna x f. Objek transparan di area terang ikut
+ *   dikalikan alpha-nya sendiri (sedikit lebih gelap).
+ * Jadi biaya bayangan = satu pass kedalaman + dua unit tekstur, tanpa
+ * perubahan state per objek.
+ *
+ * Kualitas (--shadow-quality): 0 = blob shadow, 1 = 1024 tanpa PCF,
+ * 2 = 2048 + PCF, 3 = 4096 + PCF.
+ *
+ * Blob shadow (mode low-end, juga dipakai jika driver tidak mendukung
+ * shadow map): setiap caster dalam BLOB_SHADOW_DISTANCE dari player
+ * (scenery castShadow authored dan chunk, musuh, player) menjadi satu
+ * cakram di kakinya, hitam di tengah dan memudar ke tepi. Semua cakram
+ * ditulis ke satu vertex array yang dipakai ulang tiap frame lalu
+ * digambar dengan satu glDrawArrays dan satu setup state blending.
+ *
+ * FUNCTIONS:
+ * ---------
+ * initShadows()          - Cek extension, load fungsi GL, buat tekstur/FBO
+ * shadowsEnabled()       - Shadow map aktif?
+ * renderShadowPass()     - Pass kedalaman dari arah matahari
+ * beginShadowReceivers() - Aktifkan sampling shadow map (unit 1 dan 2)
+ * endShadowReceivers()   - Kembalikan ke satu unit tekstur
+ * drawBlobShadows()      - Semua blob shadow dalam satu draw call
+ *
+ * DEPENDENCIES:
+ * -----------
+ * - options.h  - gameOptions.shadowQuality
+ * - frustum.h  - Culling chunk dengan frustum cahaya
+ * - world.h, scenery.h, map.h, enemy.h, object.h - Caster
+ * - camera.h   - isFirstPersonView
+ * - glstate.h  - Cache state GL (unit 0); unit 1 dan 2 diatur langsung
+ * - shader.h   - Uniform shadow map dan load fungsi GL
+ * - lighting.h - SUN_DIRECTION
+ *
+ * ==========================================================================
+ */
+
+#include "shadow.h"
+#include "options.h"
+#include "frustum.h"
+#include "object.h"
+#include "world.h"
+#include "scenery.h"
+#include "map.h"
+#include "enemy.h"
+#include "camera.h"
+#include "glstate.h"
+#include "shader.h"
+#include "lighting.h"
+#include <GL/glut.h>
+#include <GL/glext.h>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+ShadowStats shadowStats = {0, 0, false, 0};
+
+// Jangkauan shadow map di sekitar player dan kedalaman kamera cahaya
+static const float SHADOW_RADIUS = 60.0f;
+static const float SHADOW_DEPTH_RANGE = 150.0f;
+// Faktor cahaya di dalam bayangan (sesuai ambient di lighting.cpp)
+static const float SHADOW_AMBIENT = 0.55f;
+// Kotak pembatas model musuh per unit scale (lengan ke samping, kepala di atas)
+static const float ENEMY_CASTER_REACH = 1.0f;
+static const float ENEMY_CASTER_HEIGHT = 3.0f;
+
+// Blob shadow: jangkauan dari player, jumlah segmen cakram, alpha di tengah
+static const float BLOB_SHADOW_DISTANCE = 60.0f;
+static const int BLOB_SEGMENTS = 12;
+static const GLubyte BLOB_ALPHA = 140;
+// Sedikit di atas tanah (GROUND_Y = -0.11) seperti bayangan planar lama
+static const float BLOB_LIFT = -0.09f;
+
+static PFNGLACTIVETEXTUREARBPROC activeTexture = nullptr;
+static PFNGLGENFRAMEBUFFERSEXTPROC genFramebuffers = nullptr;
+static PFNGLBINDFRAMEBUFFEREXTPROC bindFramebuffer = nullptr;
+static PFNGLFRAMEBUFFERTEXTURE2DEXTPROC framebufferTexture2D = nullptr;
+static PFNGLCHECKFRAMEBUFFERSTATUSEXTPROC checkFramebufferStatus = nullptr;
+static PFNGLDELETEFRAMEBUFFERSEXTPROC deleteFramebuffers = nullptr;
+
+static bool enabled = false;
+static int requestedSize = 0;       // Resolusi dari --shadow-quality
+static GLuint shadowTexture = 0;
+static GLuint shadowFramebuffer = 0;
+static int textureSize = 0;         // Ukuran tekstur yang sudah dialokasikan
+
+// bias x P x V cahaya (column-major), dipakai sebagai bidang texgen
+static GLfloat shadowMatrix[16];
+
+static bool hasExtension(const char* extensions, const char* name) {
+    size_t length = std::strlen(name);
+    for (const char* p = extensions; (p = std::strstr(p, name)) != nullptr; p += length) {
+        if ((p == extensions || p[-1] == ' ') && (p[length] == ' ' || p[length] == '\0')) return true;
+    }
+    return false;
+}
+
+// a x b, keduanya column-major 4x4
+static void multiplyMatrix(const GLfloat a[16], const GLfloat b[16], GLfloat out[16]) {
+    for (int col = 0; col < 4; col++) {
+        for (int row = 0; row < 4; row++) {
+            out[col * 4 + row] = a[0 * 4 + row] * b[col * 4 + 0] + a[1 * 4 + row] * b[col * 4 + 1]
+                               + a[2 * 4 + row] * b[col * 4 + 2] + a[3 * 4 + row] * b[col * 4 + 3];
+        }
+    }
+}
+
+// Invers matriks rotasi + translasi (matriks kamera gluLookAt)
+static void invertRigidMatrix(const GLfloat m[16], GLfloat out[16]) {
+    for (int col = 0; col < 3; col++) {
+        for (int row = 0; row < 3; row++) out[col * 4 + row] = m[row * 4 + col];
+        out[col * 4 + 3] = 0.0f;
+    }
+    for (int row = 0; row < 3; row++) {
+        out[12 + row] = -(out[row] * m[12] + out[4 + row] * m[13] + out[8 + row] * m[14]);
+    }
+    out[15] = 1.0f;
+}
+
+// Alokasi tekstur kedalaman ukuran size x size (dan FBO jika ada)
+static bool allocateShadowTexture(int size) {
+    if (shadowTexture == 0) glGenTextures(1, &shadowTexture);
+    glsBindTexture(shadowTexture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT24_ARB, size, size, 0,
+                 GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, nullptr);
+    // Kualitas 1 tanpa PCF; selain itu GL_LINEAR + compare = PCF 2x2
+    GLint filter = gameOptions.shadowQuality >= 2 ? GL_LINEAR : GL_NEAREST;
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, filter);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, filter);
+    // Di luar peta: border kedalaman 1 = selalu terang
+    GLfloat border[4] = {1.0f, 1.0f, 1.0f, 1.0f};
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_BORDER_ARB);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_BORDER_ARB);
+    glTexParameterfv(GL_TEXTURE_2D, GL_TEXTURE_BORDER_COLOR, border);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_COMPARE_MODE_ARB, GL_COMPARE_R_TO_TEXTURE_ARB);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_COMPARE_FUNC_ARB, GL_LEQUAL);
+    glTexParameteri(GL_TEXTURE_2D, GL_DEPTH_TEXTURE_MODE_ARB, GL_ALPHA);
+    glsBindTexture(0);
+    textureSize = size;
+
+    if (genFramebuffers == nullptr) return true;
+    if (shadowFramebuffer == 0) genFramebuffers(1, &shadowFramebuffer);
+    bindFramebuffer(GL_FRAMEBUFFER_EXT, shadowFramebuffer);
+    framebufferTexture2D(GL_FRAMEBUFFER_EXT, GL_DEPTH_ATTACHMENT_EXT, GL_TEXTURE_2D, shadowTexture, 0);
+    glDrawBuffer(GL_NONE);
+    glReadBuffer(GL_NONE);
+    bool complete = checkFramebufferStatus(GL_FRAMEBUFFER_EXT) == GL_FRAMEBUFFER_COMPLETE_EXT;
+    bindFramebuffer(GL_FRAMEBUFFER_EXT, 0);
+    if (!complete) {
+        // Pakai jalur salin dari back buffer
+        std::cerr << "Shadow map: framebuffer incomplete, copying from back buffer" << std::endl;
+        deleteFramebuffers(1, &shadowFramebuffer);
+        shadowFramebuffer = 0;
+        genFramebuffers = nullptr;
+    }
+    return true;
+}
+
+void initShadows() {
+    static const int sizes[4] = {0, 1024, 2048, 4096};
+    int quality = gameOptions.shadowQuality;
+    if (quality <= 0) {
+        std::cout << "Shadow map off (--shadow-quality 0), using blob shadows" << std::endl;
+        return;
+    }
+    if (quality > 3) quality = 3;
+
+    // Shader hanya butuh unit 1; fixed-function butuh unit 1, 2 dan combiner
+    const char* extensions = (const char*)glGetString(GL_EXTENSIONS);
+    GLint units = 0;
+    glGetIntegerv(GL_MAX_TEXTURE_UNITS_ARB, &units);
+    bool combiners = !shadersEnabled();
+    if (extensions == nullptr || units < (combiners ? 3 : 2)
+        || !hasExtension(extensions, "GL_ARB_multitexture")
+        || (combiners && !hasExtension(extensions, "GL_ARB_texture_env_combine"))
+        || !hasExtension(extensions, "GL_ARB_depth_texture")
+        || !hasExtension(extensions, "GL_ARB_shadow")
+        || !hasExtension(extensions, "GL_ARB_texture_border_clamp")) {
+        std::cout << "Shadow map not supported by driver, using blob shadows" << std::endl;
+        return;
+    }
+    activeTexture = (PFNGLACTIVETEXTUREARBPROC)getGLProcAddress("glActiveTextureARB");
+    if (activeTexture == nullptr) return;
+
+    if (hasExtension(extensions, "GL_EXT_framebuffer_object")) {
+        genFramebuffers = (PFNGLGENFRAMEBUFFERSEXTPROC)getGLProcAddress("glGenFramebuffersEXT");
+        bindFramebuffer = (PFNGLBINDFRAMEBUFFEREXTPROC)getGLProcAddress("glBindFramebufferEXT");
+        framebufferTexture2D = (PFNGLFRAMEBUFFERTEXTURE2DEXTPROC)getGLProcAddress("glFramebufferTexture2DEXT");
+        checkFramebufferStatus = (PFNGLCHECKFRAMEBUFFERSTATUSEXTPROC)getGLProcAddress("glCheckFramebufferStatusEXT");
+        deleteFramebuffers = (PFNGLDELETEFRAMEBUFFERSEXTPROC)getGLProcAddress("glDeleteFramebuffersEXT");
+        if (!genFramebuffers || !bindFramebuffer || !framebufferTexture2D
+            || !checkFramebufferStatus || !deleteFramebuffers) {
+            genFramebuffers = nullptr;
+        }
+    }
+
+    GLint maxSize = 0;
+    glGetIntegerv(GL_MAX_TEXTURE_SIZE, &maxSize);
+    requestedSize = sizes[quality];
+    while (requestedSize > maxSize) requestedSize /= 2;
+    if (genFramebuffers != nullptr) {
+        GLint maxRenderbuffer = 0;
+        glGetIntegerv(GL_MAX_RENDERBUFFER_SIZE_EXT, &maxRenderbuffer);
+        while (maxRenderbuffer > 0 && requestedSize > maxRenderbuffer) requestedSize /= 2;
+    }
+
+    enabled = allocateShadowTexture(requestedSize);
+    shadowStats.framebuffer = shadowFramebuffer != 0;
+    std::cout << "Shadow map " << requestedSize << "x" << requestedSize
+              << (quality >= 2 ? " with PCF" : "")
+              << (shadowFramebuffer != 0 ? " (FBO)" : " (back buffer copy)") << std::endl;
+}
+
+bool shadowsEnabled() {
+    return enabled;
+}
+
+// Matriks V dan P kamera cahaya untuk frame ini
+static void computeLightMatrices(GLfloat view[16], GLfloat projection[16], int size) {
+    float length = std::sqrt(SUN_DIRECTION[0] * SUN_DIRECTION[0] + SUN_DIRECTION[1] * SUN_DIRECTION[1]
+                             + SUN_DIRECTION[2] * SUN_DIRECTION[2]);
+    // f = arah pandang (dari matahari ke bawah), s dan u = sumbu layar
+    float f[3] = {-SUN_DIRECTION[0] / length, -SUN_DIRECTION[1] / length, -SUN_DIRECTION[2] / length};
+    float s[3] = {-f[2], 0.0f, f[0]};   // f x (0, 1, 0)
+    float sLength = std::sqrt(s[0] * s[0] + s[2] * s[2]);
+    s[0] /= sLength;
+    s[2] /= sLength;
+    float u[3] = {s[1] * f[2] - s[2] * f[1], s[2] * f[0] - s[0] * f[2], s[0] * f[1] - s[1] * f[0]};
+
+    // Rotasi saja; posisi kamera diatur lewat batas ortho
+    GLfloat v[16] = {
+        s[0], u[0], -f[0], 0.0f,
+        s[1], u[1], -f[1], 0.0f,
+        s[2], u[2], -f[2], 0.0f,
+        0.0f, 0.0f, 0.0f, 1.0f
+    };
+    std::memcpy(view, v, sizeof(v));
+
+    const Position& center = player.position;
+    float centerS = s[0] * center.x + s[1] * center.y + s[2] * center.z;
+    float centerU = u[0] * center.x + u[1] * center.y + u[2] * center.z;
+    float centerF = f[0] * center.x + f[1] * center.y + f[2] * center.z;
+    float texel = 2.0f * SHADOW_RADIUS / size;
+    centerS = std::floor(centerS / texel) * texel;
+    centerU = std::floor(centerU / texel) * texel;
+
+    float left = centerS - SHADOW_RADIUS, right = centerS + SHADOW_RADIUS;
+    float bottom = centerU - SHADOW_RADIUS, top = centerU + SHADOW_RADIUS;
+    float nearZ = centerF - SHADOW_DEPTH_RANGE, farZ = centerF + SHADOW_DEPTH_RANGE;
+    GLfloat p[16] = {
+        2.0f / (right - left), 0.0f, 0.0f, 0.0f,
+        0.0f, 2.0f / (top - bottom), 0.0f, 0.0f,
+        0.0f, 0.0f, -2.0f / (farZ - nearZ), 0.0f,
+        -(right + left) / (right - left), -(top + bottom) / (top - bottom), -(farZ + nearZ) / (farZ - nearZ), 1.0f
+    };
+    std::memcpy(projection, p, sizeof(p));
+}
+
+// Semua caster; hasilnya jumlah objek/batch yang digambar
+static int drawShadowCasters() {
+    int casters = 0;
+    for (const auto& obj : sceneryObjects) {
+        if (!obj.castShadow) continue;
+        drawSceneryObject(obj);
+        casters++;
+    }
+    for (const auto& building : buildings) {
+        drawDistantBuilding(building);
+        casters++;
+    }
+    drawWorldChunks();
+    casters += worldStats.visibleChunks;
+    drawMap();
+    casters++;
+    // Musuh di luar kotak ortho cahaya tidak ikut depth pass
+    for (size_t i = 0; i < enemyPool.size(); i++) {
+        const Position& pos = enemyPool.position[i];
+        float reach = ENEMY_CASTER_REACH * enemyPool.scale[i];
+        if (!frustumBoxVisible(pos.x - reach, pos.y, pos.z - reach,
+                               pos.x + reach, pos.y + ENEMY_CASTER_HEIGHT * enemyPool.scale[i], pos.z + reach)) continue;
+        drawEnemy(i);
+        casters++;
+    }
+    if (!isFirstPersonView) {
+        drawPlayer(player, true);
+        casters++;
+    }
+    return casters;
+}
+
+void renderShadowPass() {
+    if (!enabled) {
+        shadowStats.mapSize = 0;
+        shadowStats.casters = 0;
+        return;
+    }
+
+    int size = requestedSize;
+    GLint viewport[4];
+    glGetIntegerv(GL_VIEWPORT, viewport);
+    if (shadowFramebuffer == 0) {
+        // Jalur salin: tidak boleh lebih besar dari viewport window
+        while (size > viewport[2] || size > viewport[3]) size /= 2;
+        if (size < 64) {
+            shadowStats.mapSize = 0;
+            return;
+        }
+    }
+    if (size != textureSize) allocateShadowTexture(size);
+
+    // MODELVIEW masih matriks kamera
+    GLfloat cameraView[16];
+    glGetFloatv(GL_MODELVIEW_MATRIX, cameraView);
+
+    GLfloat view[16], projection[16], viewProjection[16];
+    computeLightMatrices(view, projection, size);
+    multiplyMatrix(projection, view, viewProjection);
+    // Clip space [-1, 1] ke koordinat tekstur [0, 1]
+    static const GLfloat bias[16] = {
+        0.5f, 0.0f, 0.0f, 0.0f,
+        0.0f, 0.5f, 0.0f, 0.0f,
+        0.0f, 0.0f, 0.5f, 0.0f,
+        0.5f, 0.5f, 0.5f, 1.0f
+    };
+    multiplyMatrix(bias, viewProjection, shadowMatrix);
+    if (shadersEnabled()) {
+        GLfloat cameraInverse[16], eyeToShadow[16];
+        invertRigidMatrix(cameraView, cameraInverse);
+        multiplyMatrix(shadowMatrix, cameraInverse, eyeToShadow);
+        setShaderShadowMap(eyeToShadow, 1.0f / size, gameOptions.shadowQuality >= 2);
+    }
+
+    // State yang diubah pass ini dikembalikan eksplisit di akhir fungsi
+    static const GLenum passCaps[] = {GL_LIGHTING, GL_TEXTURE_2D, GL_BLEND, GL_POLYGON_OFFSET_FILL};
+    GLStateBlock stateBlock(passCaps, 4);
+    glMatrixMode(GL_PROJECTION);
+    glPushMatrix();
+    glLoadMatrixf(projection);
+    glMatrixMode(GL_MODELVIEW);
+    glPushMatrix();
+    glLoadMatrixf(view);
+
+    if (shadowFramebuffer != 0) bindFramebuffer(GL_FRAMEBUFFER_EXT, shadowFramebuffer);
+    glViewport(0, 0, size, size);
+    glClear(GL_DEPTH_BUFFER_BIT);
+
+    glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+    glsDisable(GL_LIGHTING);
+    glsDisable(GL_TEXTURE_2D);
+    glsDisable(GL_BLEND);
+    glShadeModel(GL_FLAT);
+    glsEnable(GL_POLYGON_OFFSET_FILL);
+    glPolygonOffset(2.0f, 4.0f);
+
+    // Chunk dunia di-cull terhadap volume cahaya, bukan kamera
+    updateFrustum();
+    shadowStats.casters = drawShadowCasters();
+
+    if (shadowFramebuffer != 0) {
+        bindFramebuffer(GL_FRAMEBUFFER_EXT, 0);
+    } else {
+        glsBindTexture(shadowTexture);
+        glCopyTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 0, 0, size, size);
+        glsBindTexture(0);
+    }
+
+    glMatrixMode(GL_PROJECTION);
+    glPopMatrix();
+    glMatrixMode(GL_MODELVIEW);
+    glPopMatrix();
+    glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+    glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+    glShadeModel(GL_SMOOTH);
+    shadowStats.mapSize = size;
+}
+
+void beginShadowReceivers() {
+    if (!enabled || shadowStats.mapSize == 0) return;
+
+    // Shader: cukup bind shadow map di unit 1, sampling di fragment shader
+    if (shadersEnabled()) {
+        activeTexture(GL_TEXTURE1_ARB);
+        glBindTexture(GL_TEXTURE_2D, shadowTexture);
+        activeTexture(GL_TEXTURE0_ARB);
+        setShaderShadowing(true);
+        return;
+    }
+
+    // Unit 1: faktor cahaya f = mix(ambient, 1, s) ke alpha
+    activeTexture(GL_TEXTURE1_ARB);
+    glBindTexture(GL_TEXTURE_2D, shadowTexture);
+    glEnable(GL_TEXTURE_2D);
+    // Bidang eye-linear dikali invers MODELVIEW saat ini (kamera), jadi
+    // koordinat yang dihasilkan = shadowMatrix x posisi dunia
+    static const GLenum coords[4] = {GL_S, GL_T, GL_R, GL_Q};
+    static const GLenum gens[4] = {GL_TEXTURE_GEN_S, GL_TEXTURE_GEN_T, GL_TEXTURE_GEN_R, GL_TEXTURE_GEN_Q};
+    for (int i = 0; i < 4; i++) {
+        GLfloat plane[4] = {shadowMatrix[i], shadowMatrix[4 + i], shadowMatrix[8 + i], shadowMatrix[12 + i]};
+        glTexGeni(coords[i], GL_TEXTURE_GEN_MODE, GL_EYE_LINEAR);
+        glTexGenfv(coords[i], GL_EYE_PLANE, plane);
+        glEnable(gens[i]);
+    }
+    GLfloat ambient[4] = {0.0f, 0.0f, 0.0f, SHADOW_AMBIENT};
+    glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_COMBINE_ARB);
+    glTexEnvfv(GL_TEXTURE_ENV, GL_TEXTURE_ENV_COLOR, ambient);
+    glTexEnvi(GL_TEXTURE_ENV, GL_COMBINE_RGB_ARB, GL_REPLACE);
+    glTexEnvi(GL_TEXTURE_ENV, GL_SOURCE0_RGB_ARB, GL_PREVIOUS_ARB);
+    glTexEnvi(GL_TEXTURE_ENV, GL_OPERAND0_RGB_ARB, GL_SRC_COLOR);
+    glTexEnvi(GL_TEXTURE_ENV, GL_COMBINE_ALPHA_ARB, GL_INTERPOLATE_ARB);
+    glTexEnvi(GL_TEXTURE_ENV, GL_SOURCE0_ALPHA_ARB, GL_PREVIOUS_ARB);
+    glTexEnvi(GL_TEXTURE_ENV, GL_OPERAND0_ALPHA_ARB, GL_SRC_ALPHA);
+    glTexEnvi(GL_TEXTURE_ENV, GL_SOURCE1_ALPHA_ARB, GL_CONSTANT_ARB);
+    glTexEnvi(GL_TEXTURE_ENV, GL_OPERAND1_ALPHA_ARB, GL_SRC_ALPHA);
+    glTexEnvi(GL_TEXTURE_ENV, GL_SOURCE2_ALPHA_ARB, GL_TEXTURE);
+    glTexEnvi(GL_TEXTURE_ENV, GL_OPERAND2_ALPHA_ARB, GL_SRC_ALPHA);
+
+    // Unit 2: warna x f. Tekstur hanya supaya unit aktif, tidak disampling
+    activeTexture(GL_TEXTURE2_ARB);
+    glBindTexture(GL_TEXTURE_2D, shadowTexture);
+    glEnable(GL_TEXTURE_2D);
+    glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_COMBINE_ARB);
+    glTexEnvi(GL_TEXTURE_ENV, GL_COMBINE_RGB_ARB, GL_MODULATE);
+    glTexEnvi(GL_TEXTURE_ENV, GL_SOURCE0_RGB_ARB, GL_PREVIOUS_ARB);
+    glTexEnvi(GL_TEXTURE_ENV, GL_OPERAND0_RGB_ARB, GL_SRC_COLOR);
+    glTexEnvi(GL_TEXTURE_ENV, GL_SOURCE1_RGB_ARB, GL_PREVIOUS_ARB);
+    glTexEnvi(GL_TEXTURE_ENV, GL_OPERAND1_RGB_ARB, GL_SRC_ALPHA);
+    glTexEnvi(GL_TEXTURE_ENV, GL_COMBINE_ALPHA_ARB, GL_REPLACE);
+    glTexEnvi(GL_TEXTURE_ENV, GL_SOURCE0_ALPHA_ARB, GL_PREVIOUS_ARB);
+    glTexEnvi(GL_TEXTURE_ENV, GL_OPERAND0_ALPHA_ARB, GL_SRC_ALPHA);
+
+    // Kode gambar lain hanya menyentuh unit 0
+    activeTexture(GL_TEXTURE0_ARB);
+}
+
+void endShadowReceivers() {
+    if (!enabled || shadowStats.mapSize == 0) return;
+    if (shadersEnabled()) {
+        setShaderShadowing(false);
+        activeTexture(GL_TEXTURE1_ARB);
+        glBindTexture(GL_TEXTURE_2D, 0);
+        activeTexture(GL_TEXTURE0_ARB);
+        return;
+    }
+    activeTexture(GL_TEXTURE2_ARB);
+    glDisable(GL_TEXTURE_2D);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    activeTexture(GL_TEXTURE1_ARB);
+    glDisable(GL_TEXTURE_GEN_S);
+    glDisable(GL_TEXTURE_GEN_T);
+    glDisable(GL_TEXTURE_GEN_R);
+    glDisable(GL_TEXTURE_GEN_Q);
+    glDisable(GL_TEXTURE_2D);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    activeTexture(GL_TEXTURE0_ARB);
+}
+
+// Radius cakram per tipe scenery (sebelum scale); 0 = tidak punya blob
+static float blobRadius(SceneryType type) {
+    switch (type) {
+        case SCENERY_TREE:      return 1.1f;
+        case SCENERY_PINE_TREE: return 1.0f;
+        case SCENERY_BUSH:      return 0.8f;
+        case SCENERY_ROCK:      return 0.6f;
+        case SCENERY_BENCH:     return 0.9f;
+        case SCENERY_LAMPPOST:  return 0.3f;
+        case SCENERY_FOUNTAIN:  return 2.0f;
+        default:                return 0.0f;
+    }
+}
+
+// Vertex (x, y, z) dan warna (RGBA) semua blob, dipakai ulang tiap frame
+static std::vector<GLfloat> blobVertices;
+static std::vector<GLubyte> blobColors;
+
+static void addBlob(float x, float y, float z, float radius) {
+    // Titik cakram satuan, dihitung sekali
+    static float unitX[BLOB_SEGMENTS + 1], unitZ[BLOB_SEGMENTS + 1];
+    static bool unitReady = false;
+    if (!unitReady) {
+        for (int i = 0; i <= BLOB_SEGMENTS; i++) {
+            float angle = 2.0f * (float)M_PI * i / BLOB_SEGMENTS;
+            unitX[i] = std::cos(angle);
+            unitZ[i] = std::sin(angle);
+        }
+        unitReady = true;
+    }
+
+    y += BLOB_LIFT;
+    for (int i = 0; i < BLOB_SEGMENTS; i++) {
+        // Tengah gelap, dua titik tepi transparan (CCW dilihat dari atas)
+        const float triangle[9] = {
+            x, y, z,
+            x + unitX[i + 1] * radius, y, z + unitZ[i + 1] * radius,
+            x + unitX[i] * radius, y, z + unitZ[i] * radius
+        };
+        blobVertices.insert(blobVertices.end(), triangle, triangle + 9);
+        const GLubyte colors[12] = {0, 0, 0, BLOB_ALPHA, 0, 0, 0, 0, 0, 0, 0, 0};
+        blobColors.insert(blobColors.end(), colors, colors + 12);
+    }
+}
+
+static void addSceneryBlob(const SceneryObject& obj) {
+    if (!obj.castShadow) return;
+    float radius = blobRadius(obj.type) * obj.scale;
+    if (radius > 0.0f) addBlob(obj.position.x, obj.position.y, obj.position.z, radius);
+}
+
+void drawBlobShadows() {
+    blobVertices.clear();
+    blobColors.clear();
+
+    float centerX = player.position.x, centerZ = player.position.z;
+    float distanceSq = BLOB_SHADOW_DISTANCE * BLOB_SHADOW_DISTANCE;
+    for (const auto& obj : sceneryObjects) {
+        float dx = obj.position.x - centerX, dz = obj.position.z - centerZ;
+        if (dx * dx + dz * dz <= distanceSq) addSceneryBlob(obj);
+    }
+    forEachWorldSceneryNear(centerX, centerZ, BLOB_SHADOW_DISTANCE, addSceneryBlob);
+    for (size_t i = 0; i < enemyPool.size(); i++) {
+        const Position& pos = enemyPool.position[i];
+        float dx = pos.x - centerX, dz = pos.z - centerZ;
+        if (dx * dx + dz * dz > distanceSq) continue;
+        addBlob(pos.x, pos.y, pos.z, 0.55f * enemyPool.scale[i]);
+    }
+    if (!isFirstPersonView) {
+        addBlob(player.position.x, player.position.y, player.position.z, 0.5f);
+    }
+
+    shadowStats.blobs = (int)(blobVertices.size() / (9 * BLOB_SEGMENTS));
+    if (blobVertices.empty()) return;
+
+    // Satu setup state untuk semua blob. Lighting, tekstur dan blending
+    // sudah diatur render queue (item translucent, lihat renderScene)
+    static const GLenum blobCaps[] = {GL_CULL_FACE, GL_POLYGON_OFFSET_FILL};
+    GLStateBlock stateBlock(blobCaps, 2, GLStateBlock::DEPTH_MASK);
+    glsDisable(GL_CULL_FACE);
+    glsDepthMask(GL_FALSE);
+    glsEnable(GL_POLYGON_OFFSET_FILL);
+    glPolygonOffset(-1.5f, -1.5f);
+
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glEnableClientState(GL_COLOR_ARRAY);
+    glVertexPointer(3, GL_FLOAT, 0, blobVertices.data());
+    glColorPointer(4, GL_UNSIGNED_BYTE, 0, blobColors.data());
+    glDrawArrays(GL_TRIANGLES, 0, (GLsizei)(blobVertices.size() / 3));
+    glDisableClientState(GL_COLOR_ARRAY);
+    glDisableClientState(GL_VERTEX_ARRAY);
+    // Warna saat ini tidak terdefinisi setelah color array
+    glsInvalidateColor();
+}
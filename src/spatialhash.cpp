@@ -0,0 +1,59 @@
+/*
+ * ==========================================================================
+ * DYNAMIC SPATIAL HASH
+ * ==========================================================================
+ *
+ * File: spatialhash.cpp
+ * Author: Project Team
+ * Date: June 2025
+ *
+ * DESCRIPTION:
+ * -----------
+ * Spatial hash untuk query tetangga dalam radius (musuh dan player).
+ * Dibangun ulang setiap tick dari posisi terbaru; query hanya mengunjungi
+ * sel di sekitar titik sehingga biayanya hampir konstan walaupun jumlah
+ * musuh ribuan.
+ *
+ * FUNCTIONS:
+ * ---------
+ * SpatialHash::reset()       - Mengosongkan hash dan menyesuaikan ukuran tabel
+ * SpatialHash::insert()      - Menambah entri
+ * SpatialHash::forEachNear() - Query radius (di spatialhash.h)
+ *
+ * ==========================================================================
+ */
+
+#include "spatialhash.h"
+
+void SpatialHash::reset(float newCellSize, size_t expectedCount) {
+    cellSize = newCellSize;
+
+    // Tabel minimal 2x jumlah entri agar bucket tetap pendek
+    size_t tableSize = 1024;
+    while (tableSize < expectedCount * 2) {
+        tableSize *= 2;
+    }
+    mask = (unsigned int)(tableSize - 1);
+    head.assign(tableSize, -1);
+
+    next.clear();
+    id.clear();
+    cellX.clear();
+    cellZ.clear();
+    x.clear();
+    z.clear();
+}
+
+void SpatialHash::insert(int entryId, float px, float pz) {
+    int cx = cellOf(px), cz = cellOf(pz);
+    unsigned int bucket = bucketOf(cx, cz);
+    int entry = (int)id.size();
+
+    id.push_back(entryId);
+    cellX.push_back(cx);
+    cellZ.push_back(cz);
+    x.push_back(px);
+    z.push_back(pz);
+    next.push_back(head[bucket]);
+    head[bucket] = entry;
+}
@@ -0,0 +1,381 @@
+/*
+ * ==========================================================================
+ * BATCHED BITMAP TEXT
+ * ==========================================================================
+ *
+ * File: text.cpp
+ * Author: Project Team
+ * Date: June 2025
+ *
+ * DESCRIPTION:
+ * -----------
+ * Teks HUD dan menu tanpa glutBitmapCharacter per karakter:
+ * - initText() menggambar setiap glyph ASCII dari tiga font GLUT yang
+ *   dipakai game sekali ke satu tekstur atlas (lewat FBO, atau back
+ *   buffer + glCopyTexSubImage2D jika FBO tidak ada).
+ * - drawText() hanya menambahkan satu quad per glyph ke vertex array
+ *   frame ini, dengan warna saat ini.
+ * - flushText() menggambar semua quad dengan satu glDrawArrays sebelum
+ *   glutSwapBuffers(). Alpha test memotong pixel kosong sehingga hasilnya
+ *   sama persis dengan glBitmap.
+ *
+ * Karena teks digambar paling akhir, teks selalu berada di atas elemen
+ * 2D lain frame itu (tombol, kotak, overlay).
+ *
+ * textWidth() mengganti loop glutBitmapWidth dan meng-cache lebar per
+ * string; cache dikosongkan jika terlalu besar (string dinamis seperti
+ * nomor wave).
+ *
+ * Font lain atau atlas yang gagal dibuat tetap memakai
+ * glutBitmapCharacter langsung.
+ *
+ * FUNCTIONS:
+ * ---------
+ * initText()  - Buat atlas glyph
+ * drawText()  - Tambahkan teks ke batch
+ * textWidth() - Lebar teks (di-cache)
+ * flushText() - Gambar batch teks frame ini
+ *
+ * DEPENDENCIES:
+ * -----------
+ * - text.h    - Deklarasi
+ * - glstate.h - Cache state GL dan warna saat ini
+ * - shader.h  - getGLProcAddress
+ *
+ * ==========================================================================
+ */
+
+#include "text.h"
+#include "glstate.h"
+#include "shader.h"
+#include <GL/glext.h>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+TextStats textStats = {0, 0, false};
+
+static const int FIRST_GLYPH = 32;          // ' '
+static const int GLYPH_COUNT = 95;          // ' ' .. '~'
+static const int GLYPH_PADDING = 2;         // Ruang kiri/kanan untuk glyph yang melewati advance
+static const int ATLAS_WIDTH = 512;
+static const int MAX_ATLAS_HEIGHT = 512;
+static const size_t MAX_CACHED_WIDTHS = 256;
+
+// Sel glyph di atlas (pixel)
+struct Glyph {
+    short x, y;
+    short width;                // advance + 2 * GLYPH_PADDING
+    short advance;              // glutBitmapWidth
+    bool blank;                 // Tanpa pixel (spasi): tidak perlu quad
+};
+
+struct AtlasFont {
+    void* font;
+    int cellHeight;             // Tinggi sel, cukup untuk ascent + descent
+    int baseline;               // Jarak baseline dari bawah sel
+    Glyph glyphs[GLYPH_COUNT];
+    std::unordered_map<std::string, int> widths;
+
+    AtlasFont(void* font, int cellHeight, int baseline)
+        : font(font), cellHeight(cellHeight), baseline(baseline), glyphs(), widths() {}
+};
+
+static AtlasFont fonts[] = {
+    {GLUT_BITMAP_HELVETICA_12, 20, 6},
+    {GLUT_BITMAP_HELVETICA_18, 28, 8},
+    {GLUT_BITMAP_TIMES_ROMAN_24, 34, 10}
+};
+static const int FONT_COUNT = sizeof(fonts) / sizeof(fonts[0]);
+
+struct TextVertex {
+    GLfloat x, y;
+    GLfloat s, t;
+    GLubyte color[4];
+};
+
+static std::vector<TextVertex> vertices;
+static GLuint atlasTexture = 0;
+static int atlasHeight = 0;
+static bool enabled = false;
+
+static AtlasFont* findFont(void* font) {
+    for (int i = 0; i < FONT_COUNT; i++) {
+        if (fonts[i].font == font) return &fonts[i];
+    }
+    return nullptr;
+}
+
+// Susun sel glyph baris demi baris; setiap font mulai di baris baru.
+// Mengembalikan tinggi yang terpakai.
+static int layoutGlyphs() {
+    int x = 0, y = 0;
+    for (int f = 0; f < FONT_COUNT; f++) {
+        AtlasFont& font = fonts[f];
+        for (int i = 0; i < GLYPH_COUNT; i++) {
+            int advance = glutBitmapWidth(font.font, FIRST_GLYPH + i);
+            int width = advance + 2 * GLYPH_PADDING;
+            if (x + width > ATLAS_WIDTH) {
+                x = 0;
+                y += font.cellHeight;
+            }
+            Glyph glyph = {(short)x, (short)y, (short)width, (short)advance, false};
+            font.glyphs[i] = glyph;
+            x += width;
+        }
+        x = 0;
+        y += font.cellHeight;
+    }
+    return y;
+}
+
+// Gambar semua glyph dengan glutBitmapCharacter ke framebuffer yang
+// sedang terpasang, pada posisi sel masing-masing
+static void rasterizeGlyphs() {
+    static const GLenum caps[] = {GL_LIGHTING, GL_DEPTH_TEST, GL_TEXTURE_2D, GL_BLEND,
+                                  GL_FOG, GL_ALPHA_TEST, GL_CULL_FACE};
+    GLStateBlock stateBlock(caps, 7, GLStateBlock::COLOR);
+    for (GLenum cap : caps) glsDisable(cap);
+
+    GLint viewport[4];
+    glGetIntegerv(GL_VIEWPORT, viewport);
+    glViewport(0, 0, ATLAS_WIDTH, atlasHeight);
+    glMatrixMode(GL_PROJECTION);
+    glPushMatrix();
+    glLoadIdentity();
+    gluOrtho2D(0, ATLAS_WIDTH, 0, atlasHeight);
+    glMatrixMode(GL_MODELVIEW);
+    glPushMatrix();
+    glLoadIdentity();
+
+    glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glsColor4f(1.0f, 1.0f, 1.0f, 1.0f);
+    for (int f = 0; f < FONT_COUNT; f++) {
+        const AtlasFont& font = fonts[f];
+        for (int i = 0; i < GLYPH_COUNT; i++) {
+            const Glyph& glyph = font.glyphs[i];
+            glRasterPos2i(glyph.x + GLYPH_PADDING, glyph.y + font.baseline);
+            glutBitmapCharacter(font.font, FIRST_GLYPH + i);
+        }
+    }
+
+    glMatrixMode(GL_PROJECTION);
+    glPopMatrix();
+    glMatrixMode(GL_MODELVIEW);
+    glPopMatrix();
+    glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+}
+
+void initText() {
+    int usedHeight = layoutGlyphs();
+    atlasHeight = 64;
+    while (atlasHeight < usedHeight) atlasHeight *= 2;
+    if (atlasHeight > MAX_ATLAS_HEIGHT) {
+        std::cout << "Text atlas too large, using bitmap characters" << std::endl;
+        return;
+    }
+
+    glGenTextures(1, &atlasTexture);
+    glsBindTexture(atlasTexture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, ATLAS_WIDTH, atlasHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+    // Langsung ke tekstur lewat FBO; tanpa FBO lewat back buffer
+    const char* extensions = (const char*)glGetString(GL_EXTENSIONS);
+    PFNGLGENFRAMEBUFFERSEXTPROC genFramebuffers = nullptr;
+    PFNGLBINDFRAMEBUFFEREXTPROC bindFramebuffer = nullptr;
+    PFNGLFRAMEBUFFERTEXTURE2DEXTPROC framebufferTexture2D = nullptr;
+    PFNGLCHECKFRAMEBUFFERSTATUSEXTPROC checkFramebufferStatus = nullptr;
+    PFNGLDELETEFRAMEBUFFERSEXTPROC deleteFramebuffers = nullptr;
+    if (extensions != nullptr && std::strstr(extensions, "GL_EXT_framebuffer_object")) {
+        genFramebuffers = (PFNGLGENFRAMEBUFFERSEXTPROC)getGLProcAddress("glGenFramebuffersEXT");
+        bindFramebuffer = (PFNGLBINDFRAMEBUFFEREXTPROC)getGLProcAddress("glBindFramebufferEXT");
+        framebufferTexture2D = (PFNGLFRAMEBUFFERTEXTURE2DEXTPROC)getGLProcAddress("glFramebufferTexture2DEXT");
+        checkFramebufferStatus = (PFNGLCHECKFRAMEBUFFERSTATUSEXTPROC)getGLProcAddress("glCheckFramebufferStatusEXT");
+        deleteFramebuffers = (PFNGLDELETEFRAMEBUFFERSEXTPROC)getGLProcAddress("glDeleteFramebuffersEXT");
+    }
+    GLuint framebuffer = 0;
+    if (genFramebuffers && bindFramebuffer && framebufferTexture2D && checkFramebufferStatus && deleteFramebuffers) {
+        genFramebuffers(1, &framebuffer);
+        bindFramebuffer(GL_FRAMEBUFFER_EXT, framebuffer);
+        framebufferTexture2D(GL_FRAMEBUFFER_EXT, GL_COLOR_ATTACHMENT0_EXT, GL_TEXTURE_2D, atlasTexture, 0);
+        if (checkFramebufferStatus(GL_FRAMEBUFFER_EXT) != GL_FRAMEBUFFER_COMPLETE_EXT) {
+            bindFramebuffer(GL_FRAMEBUFFER_EXT, 0);
+            deleteFramebuffers(1, &framebuffer);
+            framebuffer = 0;
+        }
+    }
+
+    if (framebuffer != 0) {
+        rasterizeGlyphs();
+        bindFramebuffer(GL_FRAMEBUFFER_EXT, 0);
+        deleteFramebuffers(1, &framebuffer);
+    } else {
+        GLint viewport[4];
+        glGetIntegerv(GL_VIEWPORT, viewport);
+        if (viewport[2] < ATLAS_WIDTH || viewport[3] < atlasHeight) {
+            std::cout << "Text atlas: window too small and no FBO, using bitmap characters" << std::endl;
+            glDeleteTextures(1, &atlasTexture);
+            atlasTexture = 0;
+            return;
+        }
+        rasterizeGlyphs();
+        // Window tidak punya kanal alpha (tanpa GLUT_ALPHA), jadi alpha
+        // glyph diambil dari kanal merah hasil rasterisasi putih di atas hitam
+        std::vector<GLubyte> red(ATLAS_WIDTH * atlasHeight);
+        glReadBuffer(GL_BACK);
+        glPixelStorei(GL_PACK_ALIGNMENT, 1);
+        glReadPixels(0, 0, ATLAS_WIDTH, atlasHeight, GL_RED, GL_UNSIGNED_BYTE, red.data());
+        std::vector<GLubyte> texels(red.size() * 4, 255);
+        for (size_t i = 0; i < red.size(); i++) texels[i * 4 + 3] = red[i];
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, ATLAS_WIDTH, atlasHeight, GL_RGBA, GL_UNSIGNED_BYTE, texels.data());
+    }
+
+    // Tandai sel kosong. Back buffer window yang belum tampil bisa tidak
+    // terdefinisi; atlas tanpa satu pixel pun berarti rasterisasi gagal
+    std::vector<GLubyte> alpha(ATLAS_WIDTH * atlasHeight);
+    glGetTexImage(GL_TEXTURE_2D, 0, GL_ALPHA, GL_UNSIGNED_BYTE, alpha.data());
+    int coverage = 0;
+    for (int f = 0; f < FONT_COUNT; f++) {
+        for (int i = 0; i < GLYPH_COUNT; i++) {
+            Glyph& glyph = fonts[f].glyphs[i];
+            int pixels = 0;
+            for (int y = glyph.y; y < glyph.y + fonts[f].cellHeight; y++) {
+                for (int x = glyph.x; x < glyph.x + glyph.width; x++) {
+                    pixels += alpha[y * ATLAS_WIDTH + x] != 0;
+                }
+            }
+            glyph.blank = pixels == 0;
+            coverage += pixels;
+        }
+    }
+    if (coverage == 0) {
+        std::cout << "Text atlas: glyph capture failed, using bitmap characters" << std::endl;
+        glDeleteTextures(1, &atlasTexture);
+        atlasTexture = 0;
+        return;
+    }
+
+    vertices.reserve(4096);
+    enabled = true;
+    textStats.atlas = true;
+    std::cout << "Text atlas " << ATLAS_WIDTH << "x" << atlasHeight
+              << (framebuffer != 0 ? " (FBO)" : " (back buffer copy)") << std::endl;
+}
+
+void drawText(const char* text, int x, int y, void* font) {
+    AtlasFont* atlasFont = enabled ? findFont(font) : nullptr;
+    if (atlasFont == nullptr) {
+        glRasterPos2i(x, y);
+        for (const char* c = text; *c != '\0'; c++) {
+            glutBitmapCharacter(font, *c);
+        }
+        return;
+    }
+
+    GLfloat color[4];
+    glsGetColor(color);
+    GLubyte rgba[4];
+    for (int i = 0; i < 4; i++) {
+        float value = color[i] < 0.0f ? 0.0f : (color[i] > 1.0f ? 1.0f : color[i]);
+        rgba[i] = (GLubyte)(value * 255.0f + 0.5f);
+    }
+
+    float invWidth = 1.0f / ATLAS_WIDTH;
+    float invHeight = 1.0f / atlasHeight;
+    float bottom = (float)(y - atlasFont->baseline);
+    float top = bottom + atlasFont->cellHeight;
+    int penX = x;
+    for (const char* c = text; *c != '\0'; c++) {
+        int index = (unsigned char)*c - FIRST_GLYPH;
+        if (index < 0 || index >= GLYPH_COUNT) continue;
+        const Glyph& glyph = atlasFont->glyphs[index];
+        if (!glyph.blank) {
+            float left = (float)(penX - GLYPH_PADDING);
+            float right = left + glyph.width;
+            float s0 = glyph.x * invWidth, s1 = (glyph.x + glyph.width) * invWidth;
+            float t0 = glyph.y * invHeight, t1 = (glyph.y + atlasFont->cellHeight) * invHeight;
+            TextVertex quad[4] = {
+                {left, bottom, s0, t0, {rgba[0], rgba[1], rgba[2], rgba[3]}},
+                {right, bottom, s1, t0, {rgba[0], rgba[1], rgba[2], rgba[3]}},
+                {right, top, s1, t1, {rgba[0], rgba[1], rgba[2], rgba[3]}},
+                {left, top, s0, t1, {rgba[0], rgba[1], rgba[2], rgba[3]}}
+            };
+            vertices.insert(vertices.end(), quad, quad + 4);
+        }
+        penX += glyph.advance;
+    }
+}
+
+int textWidth(const char* text, void* font) {
+    AtlasFont* atlasFont = findFont(font);
+    if (atlasFont != nullptr) {
+        auto found = atlasFont->widths.find(text);
+        if (found != atlasFont->widths.end()) return found->second;
+    }
+
+    int width = 0;
+    for (const char* c = text; *c != '\0'; c++) {
+        width += glutBitmapWidth(font, *c);
+    }
+    if (atlasFont != nullptr) {
+        if (atlasFont->widths.size() >= MAX_CACHED_WIDTHS) atlasFont->widths.clear();
+        atlasFont->widths.emplace(text, width);
+    }
+    return width;
+}
+
+void flushText(int width, int height) {
+    textStats.glyphs = (int)(vertices.size() / 4);
+    textStats.draws = 0;
+    if (vertices.empty()) return;
+
+    static const GLenum caps[] = {GL_LIGHTING, GL_DEPTH_TEST, GL_TEXTURE_2D, GL_BLEND,
+                                  GL_FOG, GL_ALPHA_TEST, GL_CULL_FACE};
+    GLStateBlock stateBlock(caps, 7);
+    glsDisable(GL_LIGHTING);
+    glsDisable(GL_DEPTH_TEST);
+    glsDisable(GL_BLEND);
+    glsDisable(GL_FOG);
+    glsDisable(GL_CULL_FACE);
+    glsEnable(GL_TEXTURE_2D);
+    glsEnable(GL_ALPHA_TEST);
+    glAlphaFunc(GL_GREATER, 0.0f);
+    glsBindTexture(atlasTexture);
+    glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
+
+    glMatrixMode(GL_PROJECTION);
+    glPushMatrix();
+    glLoadIdentity();
+    gluOrtho2D(0, width, 0, height);
+    glMatrixMode(GL_MODELVIEW);
+    glPushMatrix();
+    glLoadIdentity();
+
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+    glEnableClientState(GL_COLOR_ARRAY);
+    glVertexPointer(2, GL_FLOAT, sizeof(TextVertex), &vertices[0].x);
+    glTexCoordPointer(2, GL_FLOAT, sizeof(TextVertex), &vertices[0].s);
+    glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(TextVertex), vertices[0].color);
+    glDrawArrays(GL_QUADS, 0, (GLsizei)vertices.size());
+    glDisableClientState(GL_COLOR_ARRAY);
+    glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+    glDisableClientState(GL_VERTEX_ARRAY);
+    // Warna saat ini tidak terdefinisi setelah color array
+    glsInvalidateColor();
+
+    glMatrixMode(GL_PROJECTION);
+    glPopMatrix();
+    glMatrixMode(GL_MODELVIEW);
+    glPopMatrix();
+
+    vertices.clear();
+    textStats.draws = 1;
+}
@@ -0,0 +1,585 @@
+/*
+ * ==========================================================================
+ * TEXTURE MANAGER
+ * ==========================================================================
+ *
+ * File: texture.cpp
+ * Author: Project Team
+ * Date: June 2025
+ *
+ * DESCRIPTION:
+ * -----------
+ * Memuat tekstur dari file dengan cache per path, sehingga file yang
+ * dipakai beberapa modul (mis. quartz-block.bmp untuk dinding, tangga dan
+ * gedung) hanya di-decode dan di-upload sekali.
+ *
+ * - File dibaca lewat mapFile(); decoder membaca langsung dari mapping.
+ * - BMP: header BITMAPINFOHEADER apapun ukurannya (offset piksel diambil
+ *   dari header, bukan diasumsikan 54), 24 atau 32 bit, bottom-up atau
+ *   top-down. Baris disalin dengan memcpy langsung ke posisi akhirnya
+ *   (flip vertikal sekaligus membuang padding 4 byte), tanpa swap per byte.
+ * - PNG: 8 bit per channel (gray, gray+alpha, RGB, RGBA, palette), tanpa
+ *   interlace. Data IDAT di-inflate oleh decoder DEFLATE kecil di file ini
+ *   (tidak butuh zlib), lalu filter baris PNG dibalik.
+ * - Mipmap: rantai level dibuat di CPU dengan filter kotak 2x2 lalu setiap
+ *   level di-upload (GL_LINEAR_MIPMAP_LINEAR). Tidak memakai
+ *   gluBuild2DMipmaps karena GLU Windows tidak mengenal GL_BGR.
+ * - Anisotropi: jika GL_EXT_texture_filter_anisotropic ada, setiap tekstur
+ *   memakai --anisotropy (dibatasi maksimum driver). Tanah dan dinding
+ *   yang dilihat miring tetap tajam tanpa shimmer.
+ * - Fallback: path yang gagal mendapat tekstur kotak-kotak magenta yang
+ *   juga di-cache, jadi kegagalan tidak diulang setiap frame.
+ *
+ * Orientasi mengikuti loadBMP lama: baris pertama data = baris atas gambar.
+ *
+ * FUNCTIONS:
+ * ---------
+ * loadTextureFile()   - Ambil tekstur dari cache atau muat dari file
+ * uploadTextureFile() - Upload gambar yang sudah di-decode dan simpan di cache
+ * loadTextureImage()  - Decode file ke memori tanpa upload (worker thread)
+ * createTexture()     - Upload gambar + mipmap sebagai tekstur baru
+ * makeFallbackImage() - Gambar kotak-kotak magenta untuk data yang hilang
+ *
+ * DEPENDENCIES:
+ * -----------
+ * - texture.h    - Deklarasi dan TextureStats
+ * - mappedfile.h - mapFile()/unmapFile()
+ * - options.h    - Tingkat filter anisotropik
+ *
+ * ==========================================================================
+ */
+
+#include "texture.h"
+#include "mappedfile.h"
+#include "options.h"
+#include "glstate.h"
+#include <GL/glext.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+TextureStats textureStats = {0, 0, 0, 0, 0.0f};
+
+static std::unordered_map<std::string, GLuint> textureCache;
+static GLuint fallbackTexture = 0;
+
+static uint32_t readLE32(const unsigned char* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint16_t readLE16(const unsigned char* p) {
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static uint32_t readBE32(const unsigned char* p) {
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | (uint32_t)p[3];
+}
+
+// ---------------------------------------------------------------------------
+// BMP
+// ---------------------------------------------------------------------------
+
+static bool decodeBMP(const unsigned char* data, size_t size, TextureImage& image) {
+    if (size < 54 || data[0] != 'B' || data[1] != 'M') return false;
+    uint32_t pixelOffset = readLE32(data + 10);
+    uint32_t infoSize = readLE32(data + 14);
+    if (infoSize < 40) return false;            // OS/2 BITMAPCOREHEADER tidak didukung
+    int32_t width = (int32_t)readLE32(data + 18);
+    int32_t height = (int32_t)readLE32(data + 22);
+    uint16_t bitsPerPixel = readLE16(data + 28);
+    uint32_t compression = readLE32(data + 30);
+
+    // 0 = BI_RGB; 3 = BI_BITFIELDS (32 bit, dianggap mask BGRA standar)
+    if (width <= 0 || height == 0 || (bitsPerPixel != 24 && bitsPerPixel != 32) ||
+        !(compression == 0 || (compression == 3 && bitsPerPixel == 32))) {
+        return false;
+    }
+    bool bottomUp = height > 0;
+    if (!bottomUp) height = -height;
+
+    image.width = width;
+    image.height = height;
+    image.channels = bitsPerPixel / 8;
+    image.format = image.channels == 3 ? GL_BGR : GL_BGRA;
+
+    size_t rowBytes = (size_t)width * image.channels;
+    size_t stride = (rowBytes + 3) & ~(size_t)3;     // Baris BMP rata 4 byte
+    if (pixelOffset > size || stride * height > size - pixelOffset) return false;
+
+    // Satu memcpy per baris: sumber dibaca berurutan dari mapping, tujuan
+    // langsung di baris hasil flip
+    image.pixels.resize(rowBytes * height);
+    const unsigned char* src = data + pixelOffset;
+    for (int row = 0; row < height; row++) {
+        int dstRow = bottomUp ? height - 1 - row : row;
+        std::memcpy(&image.pixels[(size_t)dstRow * rowBytes], src + (size_t)row * stride, rowBytes);
+    }
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// DEFLATE (RFC 1951) untuk PNG
+// ---------------------------------------------------------------------------
+
+namespace {
+
+struct BitReader {
+    const unsigned char* data;
+    size_t size, pos;
+    uint32_t bitBuffer;
+    int bitCount;
+    bool error;
+
+    int bits(int count) {
+        while (bitCount < count) {
+            if (pos >= size) { error = true; return 0; }
+            bitBuffer |= (uint32_t)data[pos++] << bitCount;
+            bitCount += 8;
+        }
+        int value = (int)(bitBuffer & ((1u << count) - 1));
+        bitBuffer >>= count;
+        bitCount -= count;
+        return value;
+    }
+};
+
+// Huffman kanonik: jumlah kode per panjang dan simbol terurut per kode
+struct Huffman {
+    short count[16];
+    short symbol[288];
+};
+
+bool buildHuffman(Huffman& h, const unsigned char* lengths, int n) {
+    std::memset(h.count, 0, sizeof(h.count));
+    for (int i = 0; i < n; i++) h.count[lengths[i]]++;
+    h.count[0] = 0;
+
+    short offsets[16];
+    offsets[1] = 0;
+    for (int len = 1; len < 15; len++) offsets[len + 1] = offsets[len] + h.count[len];
+    for (int i = 0; i < n; i++) {
+        if (lengths[i] != 0) h.symbol[offsets[lengths[i]]++] = (short)i;
+    }
+
+    // Tolak kode yang over-subscribed
+    int left = 1;
+    for (int len = 1; len < 16; len++) {
+        left <<= 1;
+        left -= h.count[len];
+        if (left < 0) return false;
+    }
+    return true;
+}
+
+int decodeSymbol(BitReader& in, const Huffman& h) {
+    int code = 0, first = 0, index = 0;
+    for (int len = 1; len < 16; len++) {
+        code |= in.bits(1);
+        int count = h.count[len];
+        if (code - count < first) return h.symbol[index + (code - first)];
+        index += count;
+        first += count;
+        first <<= 1;
+        code <<= 1;
+        if (in.error) return -1;
+    }
+    return -1;
+}
+
+const short LENGTH_BASE[29] = {3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+                               35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+const short LENGTH_EXTRA[29] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+                                3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+const short DIST_BASE[30] = {1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+                             257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145,
+                             8193, 12289, 16385, 24577};
+const short DIST_EXTRA[30] = {0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+                              7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+
+bool inflateCodes(BitReader& in, const Huffman& lengthCodes, const Huffman& distCodes,
+                  std::vector<unsigned char>& out) {
+    for (;;) {
+        int symbol = decodeSymbol(in, lengthCodes);
+        if (symbol < 0 || in.error) return false;
+        if (symbol < 256) {
+            out.push_back((unsigned char)symbol);
+        } else if (symbol == 256) {
+            return true;
+        } else {
+            symbol -= 257;
+            if (symbol >= 29) return false;
+            int length = LENGTH_BASE[symbol] + in.bits(LENGTH_EXTRA[symbol]);
+            int distSymbol = decodeSymbol(in, distCodes);
+            if (distSymbol < 0 || distSymbol >= 30) return false;
+            size_t dist = DIST_BASE[distSymbol] + in.bits(DIST_EXTRA[distSymbol]);
+            if (in.error || dist > out.size()) return false;
+            size_t from = out.size() - dist;
+            for (int i = 0; i < length; i++) out.push_back(out[from + i]);
+        }
+    }
+}
+
+// Tabel Huffman tetap (blok tipe 1) dari RFC 1951
+struct FixedHuffman {
+    Huffman length;
+    Huffman dist;
+};
+
+FixedHuffman buildFixedHuffman() {
+    FixedHuffman fixed;
+    unsigned char lengths[288];
+    int i = 0;
+    for (; i < 144; i++) lengths[i] = 8;
+    for (; i < 256; i++) lengths[i] = 9;
+    for (; i < 280; i++) lengths[i] = 7;
+    for (; i < 288; i++) lengths[i] = 8;
+    buildHuffman(fixed.length, lengths, 288);
+    for (i = 0; i < 30; i++) lengths[i] = 5;
+    buildHuffman(fixed.dist, lengths, 30);
+    return fixed;
+}
+
+// Inflate stream zlib (header 2 byte, checksum Adler-32 diabaikan)
+bool zlibInflate(const unsigned char* data, size_t size, std::vector<unsigned char>& out) {
+    if (size < 2 || (data[0] & 0x0F) != 8 || ((data[0] << 8) | data[1]) % 31 != 0 || (data[1] & 0x20)) {
+        return false;
+    }
+    BitReader in = {data, size, 2, 0, 0, false};
+
+    int last;
+    do {
+        last = in.bits(1);
+        int type = in.bits(2);
+        if (type == 0) {
+            // Blok tanpa kompresi: buang sisa bit lalu LEN/NLEN
+            in.bitBuffer = 0;
+            in.bitCount = 0;
+            if (in.pos + 4 > size) return false;
+            unsigned len = data[in.pos] | (data[in.pos + 1] << 8);
+            unsigned nlen = data[in.pos + 2] | (data[in.pos + 3] << 8);
+            in.pos += 4;
+            if ((len ^ 0xFFFF) != nlen || in.pos + len > size) return false;
+            out.insert(out.end(), data + in.pos, data + in.pos + len);
+            in.pos += len;
+        } else if (type == 1) {
+            // Inisialisasi static lokal C++11 thread-safe: loader memuat PNG paralel
+            static const FixedHuffman fixed = buildFixedHuffman();
+            if (!inflateCodes(in, fixed.length, fixed.dist, out)) return false;
+        } else if (type == 2) {
+            static const unsigned char ORDER[19] = {16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
+            int lengthCount = in.bits(5) + 257;
+            int distCount = in.bits(5) + 1;
+            int codeCount = in.bits(4) + 4;
+            if (lengthCount > 286 || distCount > 30) return false;
+
+            unsigned char lengths[320] = {0};
+            for (int i = 0; i < codeCount; i++) lengths[ORDER[i]] = (unsigned char)in.bits(3);
+            Huffman codeLengths;
+            if (!buildHuffman(codeLengths, lengths, 19)) return false;
+
+            int index = 0;
+            while (index < lengthCount + distCount) {
+                int symbol = decodeSymbol(in, codeLengths);
+                if (symbol < 0 || in.error) return false;
+                if (symbol < 16) {
+                    lengths[index++] = (unsigned char)symbol;
+                    continue;
+                }
+                int repeat;
+                unsigned char value = 0;
+                if (symbol == 16) {
+                    if (index == 0) return false;
+                    value = lengths[index - 1];
+                    repeat = 3 + in.bits(2);
+                } else if (symbol == 17) {
+                    repeat = 3 + in.bits(3);
+                } else {
+                    repeat = 11 + in.bits(7);
+                }
+                if (index + repeat > lengthCount + distCount) return false;
+                while (repeat--) lengths[index++] = value;
+            }
+
+            Huffman lengthCodes, distCodes;
+            if (!buildHuffman(lengthCodes, lengths, lengthCount) ||
+                !buildHuffman(distCodes, lengths + lengthCount, distCount)) {
+                return false;
+            }
+            if (!inflateCodes(in, lengthCodes, distCodes, out)) return false;
+        } else {
+            return false;
+        }
+        if (in.error) return false;
+    } while (!last);
+    return true;
+}
+
+int paeth(int a, int b, int c) {
+    int p = a + b - c;
+    int pa = p > a ? p - a : a - p;
+    int pb = p > b ? p - b : b - p;
+    int pc = p > c ? p - c : c - p;
+    if (pa <= pb && pa <= pc) return a;
+    return pb <= pc ? b : c;
+}
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// PNG
+// ---------------------------------------------------------------------------
+
+static bool decodePNG(const unsigned char* data, size_t size, TextureImage& image) {
+    static const unsigned char SIGNATURE[8] = {137, 80, 78, 71, 13, 10, 26, 10};
+    if (size < 8 || std::memcmp(data, SIGNATURE, 8) != 0) return false;
+
+    uint32_t width = 0, height = 0;
+    int bitDepth = 0, colorType = -1, interlace = 0;
+    std::vector<unsigned char> compressed;
+    const unsigned char* palette = nullptr;
+    uint32_t paletteSize = 0;
+
+    for (size_t pos = 8; pos + 12 <= size; ) {
+        uint32_t length = readBE32(data + pos);
+        const unsigned char* type = data + pos + 4;
+        const unsigned char* body = data + pos + 8;
+        if (length > size - pos - 12) return false;
+
+        if (std::memcmp(type, "IHDR", 4) == 0 && length >= 13) {
+            width = readBE32(body);
+            height = readBE32(body + 4);
+            bitDepth = body[8];
+            colorType = body[9];
+            interlace = body[12];
+        } else if (std::memcmp(type, "PLTE", 4) == 0) {
+            palette = body;
+            paletteSize = length / 3;
+        } else if (std::memcmp(type, "IDAT", 4) == 0) {
+            compressed.insert(compressed.end(), body, body + length);
+        } else if (std::memcmp(type, "IEND", 4) == 0) {
+            break;
+        }
+        pos += 12 + length;
+    }
+
+    int sourceChannels;
+    switch (colorType) {
+        case 0: sourceChannels = 1; break;  // Gray
+        case 2: sourceChannels = 3; break;  // RGB
+        case 3: sourceChannels = 1; break;  // Palette
+        case 4: sourceChannels = 2; break;  // Gray + alpha
+        case 6: sourceChannels = 4; break;  // RGBA
+        default: return false;
+    }
+    if (width == 0 || height == 0 || width > 16384 || height > 16384 ||
+        bitDepth != 8 || interlace != 0 || (colorType == 3 && palette == nullptr)) {
+        return false;
+    }
+
+    std::vector<unsigned char> raw;
+    raw.reserve((size_t)(width * sourceChannels + 1) * height);
+    if (!zlibInflate(compressed.data(), compressed.size(), raw)) return false;
+    size_t rowBytes = (size_t)width * sourceChannels;
+    if (raw.size() < (rowBytes + 1) * height) return false;
+
+    // Balik filter per baris (in place, baris sebelumnya sudah terdekode)
+    for (uint32_t y = 0; y < height; y++) {
+        unsigned char* row = &raw[y * (rowBytes + 1) + 1];
+        const unsigned char* prev = y > 0 ? row - (rowBytes + 1) : nullptr;
+        int filter = row[-1];
+        for (size_t x = 0; x < rowBytes; x++) {
+            int a = x >= (size_t)sourceChannels ? row[x - sourceChannels] : 0;
+            int b = prev ? prev[x] : 0;
+            int c = (prev && x >= (size_t)sourceChannels) ? prev[x - sourceChannels] : 0;
+            switch (filter) {
+                case 0: break;
+                case 1: row[x] = (unsigned char)(row[x] + a); break;
+                case 2: row[x] = (unsigned char)(row[x] + b); break;
+                case 3: row[x] = (unsigned char)(row[x] + ((a + b) >> 1)); break;
+                case 4: row[x] = (unsigned char)(row[x] + paeth(a, b, c)); break;
+                default: return false;
+            }
+        }
+    }
+
+    // Ubah ke RGB/RGBA; PNG sudah top-down jadi tidak perlu flip
+    bool hasAlpha = colorType == 4 || colorType == 6;
+    image.width = (int)width;
+    image.height = (int)height;
+    image.channels = hasAlpha ? 4 : 3;
+    image.format = hasAlpha ? GL_RGBA : GL_RGB;
+    image.pixels.resize((size_t)width * height * image.channels);
+    for (uint32_t y = 0; y < height; y++) {
+        const unsigned char* src = &raw[y * (rowBytes + 1) + 1];
+        unsigned char* dst = &image.pixels[(size_t)y * width * image.channels];
+        if (colorType == 2 || colorType == 6) {
+            std::memcpy(dst, src, rowBytes);
+            continue;
+        }
+        for (uint32_t x = 0; x < width; x++) {
+            if (colorType == 3) {
+                uint32_t index = src[x] < paletteSize ? src[x] : 0;
+                std::memcpy(dst + x * 3, palette + index * 3, 3);
+            } else {
+                unsigned char gray = src[x * sourceChannels];
+                dst[x * image.channels + 0] = gray;
+                dst[x * image.channels + 1] = gray;
+                dst[x * image.channels + 2] = gray;
+                if (hasAlpha) dst[x * 4 + 3] = src[x * 2 + 1];
+            }
+        }
+    }
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// Upload
+// ---------------------------------------------------------------------------
+
+// Level berikutnya: rata-rata kotak 2x2 (sisi ganjil memakai piksel tepi)
+static void downsample(const std::vector<unsigned char>& src, int width, int height, int channels,
+                       std::vector<unsigned char>& dst, int& outWidth, int& outHeight) {
+    outWidth = width > 1 ? width / 2 : 1;
+    outHeight = height > 1 ? height / 2 : 1;
+    dst.resize((size_t)outWidth * outHeight * channels);
+    for (int y = 0; y < outHeight; y++) {
+        int y0 = std::min(y * 2, height - 1), y1 = std::min(y * 2 + 1, height - 1);
+        for (int x = 0; x < outWidth; x++) {
+            int x0 = std::min(x * 2, width - 1), x1 = std::min(x * 2 + 1, width - 1);
+            for (int c = 0; c < channels; c++) {
+                int sum = src[((size_t)y0 * width + x0) * channels + c] + src[((size_t)y0 * width + x1) * channels + c]
+                        + src[((size_t)y1 * width + x0) * channels + c] + src[((size_t)y1 * width + x1) * channels + c];
+                dst[((size_t)y * outWidth + x) * channels + c] = (unsigned char)((sum + 2) / 4);
+            }
+        }
+    }
+}
+
+// Maksimum anisotropi driver; 0 = extension tidak ada, -1 = belum dicek
+static float maxAnisotropy = -1.0f;
+
+static void applyAnisotropy() {
+    if (maxAnisotropy < 0.0f) {
+        const char* extensions = (const char*)glGetString(GL_EXTENSIONS);
+        maxAnisotropy = 0.0f;
+        if (extensions && std::strstr(extensions, "GL_EXT_texture_filter_anisotropic")) {
+            glGetFloatv(GL_MAX_TEXTURE_MAX_ANISOTROPY_EXT, &maxAnisotropy);
+        }
+    }
+    if (maxAnisotropy > 1.0f && gameOptions.anisotropy > 1) {
+        glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAX_ANISOTROPY_EXT,
+                        std::min((float)gameOptions.anisotropy, maxAnisotropy));
+    }
+}
+
+// Upload level mipmap 0..maxLevel (-1 = sampai 1x1); mengembalikan
+// perkiraan byte di GPU
+static size_t uploadImage(GLuint textureID, const TextureImage& image, int maxLevel) {
+    glsBindTexture(textureID);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    applyAnisotropy();
+    if (maxLevel >= 0) {
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, maxLevel);
+    }
+
+    GLint internalFormat = image.channels == 4 ? GL_RGBA : GL_RGB;
+    std::vector<unsigned char> level = image.pixels, next;
+    int width = image.width, height = image.height;
+    size_t bytes = 0;
+    for (int mip = 0; ; mip++) {
+        glTexImage2D(GL_TEXTURE_2D, mip, internalFormat, width, height, 0,
+                     image.format, GL_UNSIGNED_BYTE, level.data());
+        bytes += (size_t)width * height * 4;    // Driver umumnya menyimpan RGBA8
+        if ((width == 1 && height == 1) || mip == maxLevel) break;
+        downsample(level, width, height, image.channels, next, width, height);
+        level.swap(next);
+    }
+    return bytes;
+}
+
+void makeFallbackImage(TextureImage& image) {
+    image.width = 8;
+    image.height = 8;
+    image.channels = 3;
+    image.format = GL_RGB;
+    image.pixels.resize(8 * 8 * 3);
+    for (int y = 0; y < 8; y++) {
+        for (int x = 0; x < 8; x++) {
+            bool magenta = ((x / 2) + (y / 2)) % 2 == 0;
+            unsigned char* p = &image.pixels[(y * 8 + x) * 3];
+            p[0] = magenta ? 255 : 0;
+            p[1] = 0;
+            p[2] = magenta ? 255 : 0;
+        }
+    }
+}
+
+static GLuint getFallbackTexture() {
+    if (fallbackTexture != 0) return fallbackTexture;
+    TextureImage image;
+    makeFallbackImage(image);
+    glGenTextures(1, &fallbackTexture);
+    textureStats.bytes += uploadImage(fallbackTexture, image, -1);
+    return fallbackTexture;
+}
+
+bool loadTextureImage(const char* path, TextureImage& image) {
+    MappedFile file;
+    if (!mapFile(path, file)) return false;
+    bool decoded = decodeBMP(file.data, file.size, image) || decodePNG(file.data, file.size, image);
+    unmapFile(file);
+    return decoded;
+}
+
+GLuint createTexture(const TextureImage& image, int maxLevel) {
+    GLuint textureID;
+    glGenTextures(1, &textureID);
+    textureStats.bytes += uploadImage(textureID, image, maxLevel);
+    textureStats.loaded++;
+    return textureID;
+}
+
+GLuint loadTextureFile(const char* path) {
+    auto cached = textureCache.find(path);
+    if (cached != textureCache.end()) {
+        textureStats.cacheHits++;
+        return cached->second;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    TextureImage image;
+    bool decoded = loadTextureImage(path, image);
+    float decodeMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+    return uploadTextureFile(path, image, decoded, decodeMs);
+}
+
+GLuint uploadTextureFile(const char* path, const TextureImage& image, bool decoded, float decodeMs) {
+    auto start = std::chrono::steady_clock::now();
+    GLuint textureID;
+    if (decoded) {
+        textureID = createTexture(image, -1);
+    } else {
+        std::cerr << "Failed to load texture: " << path << " (using fallback)" << std::endl;
+        textureID = getFallbackTexture();
+        textureStats.missing++;
+    }
+
+    float ms = decodeMs + std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+    textureStats.loadMs += ms;
+    if (decoded) {
+        std::cout << "Texture " << path << ": " << image.width << "x" << image.height
+                  << " (" << ms << " ms)" << std::endl;
+    }
+
+    textureCache[path] = textureID;
+    return textureID;
+}
@@ -0,0 +1,597 @@
+/*
+ * ==========================================================================
+ * WORLD CHUNK STREAMING
+ * ==========================================================================
+ *
+ * File: world.cpp
+ * Author: Project Team
+ * Date: June 2025
+ *
+ * DESCRIPTION:
+ * -----------
+ * Dunia dibagi menjadi chunk WORLD_CHUNK_SIZE x WORLD_CHUNK_SIZE. Scenery
+ * (pohon, semak, batu), collider dan mesh tiap chunk dibangkitkan saat
+ * player mendekat dan dibuang saat menjauh, sehingga memori dan waktu
+ * frame tidak bergantung pada ukuran peta.
+ *
+ * - Generator: thread background mengambil permintaan dari antrian
+ *   (terdekat dulu) dan memanggil generateSceneryChunk(). Hasilnya hanya
+ *   bergantung pada seed dan koordinat chunk.
+ * - Thread utama: mengambil chunk yang selesai, mem-bake display list
+ *   (butuh context GL) maksimal WORLD_BAKES_PER_FRAME per frame, dan
+ *   membuang chunk di luar radius + satu chunk (histeresis).
+ * - Batas memori (--chunk-budget-mb): memori dihitung dengan ukuran
+ *   setelah bake, termasuk chunk yang masih diminta. Jika melebihi batas,
+ *   chunk terjauh dibuang sampai WORLD_BUDGET_LOW_WATER dari batas, dan
+ *   chunk baru hanya diminta selama masih di bawah angka itu. Chunk yang
+ *   dibuang karena batas tidak diminta lagi sampai player lebih dekat
+ *   ke chunk itu daripada saat dibuang.
+ *
+ * FUNCTIONS:
+ * ---------
+ * beginWorldLoad()       - Tentukan chunk awal di sekitar player
+ * generateInitialChunk() - Chunk awal dari cache dunia atau generator (worker thread loader)
+ * addInitialChunk()      - Simpan dan bake chunk awal (thread GL)
+ * finishWorldLoad()      - Jalankan generator background
+ * shutdownWorld()        - Hentikan generator dan buang semua chunk
+ * updateWorldStreaming() - Streaming per frame di sekitar player
+ * drawWorldChunks()      - Gambar mesh chunk yang terlihat
+ * submitWorldChunks()    - Kirim chunk yang terlihat ke render queue
+ * forEachWorldSceneryNear() - Objek chunk terlihat di dekat satu titik (blob shadow)
+ * worldCheckCollision()  - Collision kotak vs collider scenery
+ *
+ * DEPENDENCIES:
+ * -----------
+ * - world.h   - Struct WorldChunk dan deklarasi fungsi
+ * - scenery.h - generateSceneryChunk(), drawSceneryObject(), getSceneryCollider()
+ * - options.h - Radius streaming dan batas memori
+ * - frustum.h - Culling chunk saat digambar
+ * - renderqueue.h - Item gambar per chunk
+ * - worldcache.h - Chunk awal dari / ke cache dunia
+ *
+ * ==========================================================================
+ */
+
+#include "world.h"
+#include "options.h"
+#include "frustum.h"
+#include "worldcache.h"
+#include "renderqueue.h"
+#include "atlas.h"
+#include "camera.h"
+#include "glstate.h"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <unordered_map>
+#include <unordered_set>
+#include <functional>
+#include <algorithm>
+#include <cstdlib>
+#include <cmath>
+#include <iostream>
+
+WorldStats worldStats = {0, 0, 0, 0, 0, 0};
+
+// Jumlah chunk yang di-bake per frame (bake = kompilasi display list)
+static const int WORLD_BAKES_PER_FRAME = 2;
+
+// Perkiraan memori display list per objek scenery (vertex + normal)
+static const size_t WORLD_LIST_BYTES_PER_OBJECT = 8192;
+
+// Batas bawah (fraksi dari batas memori): eviksi turun sampai sini dan
+// permintaan baru hanya di bawahnya, agar chunk di tepi tidak bolak-balik
+static const float WORLD_BUDGET_LOW_WATER = 0.9f;
+
+// Chunk resident hanya diganti chunk yang lebih dekat jika selisih jaraknya
+// lebih dari ini, agar dua chunk yang hampir sama jauh tidak saling tukar
+static const float WORLD_BUDGET_SWAP_MARGIN = WORLD_CHUNK_SIZE * 0.5f;
+
+// Batas tinggi isi chunk untuk frustum culling (pohon terbesar ~8 unit) dan
+// seberapa jauh objek boleh menjorok keluar dari tepi chunk (tajuk pohon)
+static const float WORLD_CHUNK_MAX_HEIGHT = 12.0f;
+static const float WORLD_CHUNK_OVERHANG = 2.0f;
+
+// Ukuran sel hash collider di dalam chunk
+static const float WORLD_COLLIDER_CELL_SIZE = 2.0f;
+
+// Radius collider terbesar (query hash diperbesar sebesar ini)
+static const float WORLD_MAX_COLLIDER_RADIUS = 1.0f;
+
+// Chunk yang dimuat (thread utama menulis, worker AI hanya membaca)
+static std::unordered_map<long long, WorldChunk*> residentChunks;
+
+// Chunk yang sudah diminta tapi belum diterima (thread utama saja)
+static std::unordered_set<long long> pendingChunks;
+
+// Chunk yang dibuang karena batas memori -> jaraknya ke player saat itu
+// (thread utama saja). Tidak diminta lagi sampai player lebih dekat.
+static std::unordered_map<long long, float> budgetEvicted;
+
+// Rata-rata ukuran chunk setelah bake, untuk menghitung permintaan yang
+// belum selesai (thread utama saja)
+static size_t bakedBytesTotal = 0;
+static unsigned int bakedChunkCount = 0;
+
+// Antrian generator (dilindungi worldMutex)
+static std::mutex worldMutex;
+static std::condition_variable worldCondition;
+static std::deque<long long> requestQueue;
+static std::vector<WorldChunk*> completedChunks;
+static bool worldStopping = false;
+static std::thread worldThread;
+static bool worldExitRegistered = false;
+
+static unsigned int worldFrame = 0;
+
+static long long chunkKey(int chunkX, int chunkZ) {
+    return (long long)(((unsigned long long)(unsigned int)chunkX << 32) | (unsigned int)chunkZ);
+}
+
+static int keyChunkX(long long key) { return (int)(unsigned int)((unsigned long long)key >> 32); }
+static int keyChunkZ(long long key) { return (int)(unsigned int)key; }
+
+static int chunkCoord(float v) {
+    return (int)std::floor(v / WORLD_CHUNK_SIZE);
+}
+
+// Jarak dari (x, z) ke persegi chunk (0 jika di dalam)
+static float chunkDistance(int chunkX, int chunkZ, float x, float z) {
+    float minX = chunkX * WORLD_CHUNK_SIZE, minZ = chunkZ * WORLD_CHUNK_SIZE;
+    float dx = std::max(std::max(minX - x, 0.0f), x - (minX + WORLD_CHUNK_SIZE));
+    float dz = std::max(std::max(minZ - z, 0.0f), z - (minZ + WORLD_CHUNK_SIZE));
+    return std::sqrt(dx * dx + dz * dz);
+}
+
+static size_t chunkMemory(const WorldChunk& chunk) {
+    size_t bytes = sizeof(WorldChunk);
+    bytes += chunk.scenery.capacity() * sizeof(SceneryObject);
+    bytes += chunk.colliders.capacity() * sizeof(WorldCollider);
+    bytes += chunk.colliderHash.head.capacity() * sizeof(int);
+    bytes += chunk.colliderHash.size() * (3 * sizeof(int) + 2 * sizeof(int) + 2 * sizeof(float));
+    if (chunk.displayList != 0) {
+        bytes += chunk.scenery.size() * WORLD_LIST_BYTES_PER_OBJECT;
+    }
+    return bytes;
+}
+
+// Memori chunk setelah di-bake (chunk yang belum di-bake diperkirakan)
+static size_t bakedMemory(const WorldChunk& chunk) {
+    if (chunk.displayList != 0) return chunk.memoryBytes;
+    return chunk.memoryBytes + chunk.scenery.size() * WORLD_LIST_BYTES_PER_OBJECT;
+}
+
+// Perkiraan memori chunk yang baru diminta
+static size_t expectedChunkBytes() {
+    return bakedChunkCount > 0 ? bakedBytesTotal / bakedChunkCount : 0;
+}
+
+// Chunk kosong yang belum di-bake
+static WorldChunk* newChunk(int chunkX, int chunkZ) {
+    WorldChunk* chunk = new WorldChunk();
+    chunk->chunkX = chunkX;
+    chunk->chunkZ = chunkZ;
+    chunk->displayList = 0;
+    chunk->lastUsedFrame = 0;
+    return chunk;
+}
+
+// Hash collider dan perkiraan memori dari scenery + collider yang sudah terisi
+static void indexChunk(WorldChunk* chunk) {
+    chunk->colliderHash.reset(WORLD_COLLIDER_CELL_SIZE, chunk->colliders.size());
+    for (size_t i = 0; i < chunk->colliders.size(); i++) {
+        chunk->colliderHash.insert((int)i, chunk->colliders[i].x, chunk->colliders[i].z);
+    }
+
+    chunk->memoryBytes = chunkMemory(*chunk);
+}
+
+// Bangkitkan isi chunk (thread manapun; tidak menyentuh state global world)
+static WorldChunk* generateChunk(int chunkX, int chunkZ) {
+    WorldChunk* chunk = newChunk(chunkX, chunkZ);
+    generateSceneryChunk(chunkX, chunkZ, WORLD_CHUNK_SIZE, chunk->scenery);
+
+    for (const auto& obj : chunk->scenery) {
+        WorldCollider collider;
+        if (getSceneryCollider(obj, collider.radius, collider.height)) {
+            collider.x = obj.position.x;
+            collider.z = obj.position.z;
+            chunk->colliders.push_back(collider);
+        }
+    }
+    indexChunk(chunk);
+    return chunk;
+}
+
+static void workerLoop() {
+    for (;;) {
+        long long key;
+        {
+            std::unique_lock<std::mutex> lock(worldMutex);
+            worldCondition.wait(lock, [] { return worldStopping || !requestQueue.empty(); });
+            if (worldStopping) return;
+            key = requestQueue.front();
+            requestQueue.pop_front();
+        }
+
+        WorldChunk* chunk = generateChunk(keyChunkX(key), keyChunkZ(key));
+
+        std::lock_guard<std::mutex> lock(worldMutex);
+        completedChunks.push_back(chunk);
+    }
+}
+
+static void bakeChunk(WorldChunk& chunk) {
+    chunk.displayList = glGenLists(1);
+    if (chunk.displayList == 0) {
+        return;
+    }
+    glsNewList(chunk.displayList);
+    for (const auto& obj : chunk.scenery) {
+        drawSceneryObject(obj);
+    }
+    glsEndList();
+
+    worldStats.memoryBytes -= chunk.memoryBytes;
+    chunk.memoryBytes = chunkMemory(chunk);
+    worldStats.memoryBytes += chunk.memoryBytes;
+    bakedBytesTotal += chunk.memoryBytes;
+    bakedChunkCount++;
+}
+
+static void addResident(WorldChunk* chunk) {
+    chunk->lastUsedFrame = worldFrame;
+    residentChunks[chunkKey(chunk->chunkX, chunk->chunkZ)] = chunk;
+    worldStats.memoryBytes += chunk->memoryBytes;
+    worldStats.generated++;
+}
+
+static void evictChunk(std::unordered_map<long long, WorldChunk*>::iterator it) {
+    WorldChunk* chunk = it->second;
+    if (chunk->displayList != 0) {
+        glDeleteLists(chunk->displayList, 1);
+    }
+    worldStats.memoryBytes -= chunk->memoryBytes;
+    worldStats.evicted++;
+    delete chunk;
+    residentChunks.erase(it);
+}
+
+static size_t memoryBudget() {
+    return (size_t)std::max(gameOptions.chunkBudgetMB, 1) * 1024 * 1024;
+}
+
+// Memori yang sudah terpakai atau akan terpakai: chunk resident dengan
+// ukuran setelah bake, ditambah permintaan yang belum selesai
+static size_t committedMemory() {
+    size_t bytes = 0;
+    for (const auto& entry : residentChunks) {
+        bytes += bakedMemory(*entry.second);
+    }
+    return bytes + pendingChunks.size() * expectedChunkBytes();
+}
+
+// Chunk dalam radius streaming, terdekat dulu
+static void collectWantedChunks(float x, float z, float radius, std::vector<long long>& out) {
+    int reach = (int)std::ceil(radius / WORLD_CHUNK_SIZE);
+    int centerX = chunkCoord(x), centerZ = chunkCoord(z);
+    std::vector<std::pair<float, long long> > wanted;
+    for (int cz = centerZ - reach; cz <= centerZ + reach; cz++) {
+        for (int cx = centerX - reach; cx <= centerX + reach; cx++) {
+            float dist = chunkDistance(cx, cz, x, z);
+            if (dist <= radius) {
+                wanted.push_back(std::make_pair(dist, chunkKey(cx, cz)));
+            }
+        }
+    }
+    std::sort(wanted.begin(), wanted.end());
+    out.clear();
+    for (size_t i = 0; i < wanted.size(); i++) {
+        out.push_back(wanted[i].second);
+    }
+}
+
+// Chunk awal yang dibangkitkan oleh loader (ditulis di beginWorldLoad,
+// setelah itu hanya dibaca)
+static std::vector<long long> initialChunks;
+
+int beginWorldLoad(float x, float z) {
+    shutdownWorld();
+    collectWantedChunks(x, z, gameOptions.chunkRadius, initialChunks);
+    return (int)initialChunks.size();
+}
+
+WorldChunk* generateInitialChunk(int index) {
+    long long key = initialChunks[index];
+    WorldChunk* chunk = newChunk(keyChunkX(key), keyChunkZ(key));
+    if (getCachedChunk(chunk->chunkX, chunk->chunkZ, chunk->scenery, chunk->colliders)) {
+        indexChunk(chunk);
+        return chunk;
+    }
+    delete chunk;
+
+    chunk = generateChunk(keyChunkX(key), keyChunkZ(key));
+    addChunkToWorldCache(*chunk);
+    return chunk;
+}
+
+void addInitialChunk(WorldChunk* chunk) {
+    addResident(chunk);
+    bakeChunk(*chunk);
+    worldStats.residentChunks = (int)residentChunks.size();
+}
+
+void finishWorldLoad() {
+    worldStats.residentChunks = (int)residentChunks.size();
+    std::cout << "World: " << residentChunks.size() << " chunks loaded ("
+              << worldStats.memoryBytes / 1024 << " KB)" << std::endl;
+
+    worldStopping = false;
+    worldThread = std::thread(workerLoop);
+    if (!worldExitRegistered) {
+        std::atexit(shutdownWorld);
+        worldExitRegistered = true;
+    }
+}
+
+void shutdownWorld() {
+    if (worldThread.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(worldMutex);
+            worldStopping = true;
+        }
+        worldCondition.notify_all();
+        worldThread.join();
+    }
+
+    requestQueue.clear();
+    for (size_t i = 0; i < completedChunks.size(); i++) {
+        delete completedChunks[i];
+    }
+    completedChunks.clear();
+    pendingChunks.clear();
+    budgetEvicted.clear();
+    bakedBytesTotal = 0;
+    bakedChunkCount = 0;
+
+    // Display list tidak dihapus di sini: saat atexit context GL sudah hilang
+    for (auto& entry : residentChunks) {
+        delete entry.second;
+    }
+    residentChunks.clear();
+    worldStats.memoryBytes = 0;
+    worldStats.residentChunks = 0;
+    worldStats.pendingChunks = 0;
+}
+
+void updateWorldStreaming(float x, float z) {
+    worldFrame++;
+    float loadRadius = gameOptions.chunkRadius;
+    float evictRadius = loadRadius + WORLD_CHUNK_SIZE;
+
+    // 1. Terima chunk yang selesai dibangkitkan
+    std::vector<WorldChunk*> completed;
+    {
+        std::lock_guard<std::mutex> lock(worldMutex);
+        completed.swap(completedChunks);
+
+        // Permintaan yang belum dikerjakan tapi sudah di luar radius dibatalkan
+        for (size_t i = 0; i < requestQueue.size(); ) {
+            long long key = requestQueue[i];
+            if (chunkDistance(keyChunkX(key), keyChunkZ(key), x, z) > evictRadius) {
+                pendingChunks.erase(key);
+                requestQueue.erase(requestQueue.begin() + i);
+            } else {
+                i++;
+            }
+        }
+    }
+    for (size_t i = 0; i < completed.size(); i++) {
+        WorldChunk* chunk = completed[i];
+        pendingChunks.erase(chunkKey(chunk->chunkX, chunk->chunkZ));
+        if (chunkDistance(chunk->chunkX, chunk->chunkZ, x, z) > evictRadius) {
+            delete chunk;
+            continue;
+        }
+        addResident(chunk);
+    }
+
+    // 2. Buang chunk di luar radius
+    for (auto it = residentChunks.begin(); it != residentChunks.end(); ) {
+        auto current = it++;
+        if (chunkDistance(current->second->chunkX, current->second->chunkZ, x, z) > evictRadius) {
+            evictChunk(current);
+        }
+    }
+
+    // Chunk yang dibuang karena batas dan sudah keluar radius dilupakan
+    for (auto it = budgetEvicted.begin(); it != budgetEvicted.end(); ) {
+        if (chunkDistance(keyChunkX(it->first), keyChunkZ(it->first), x, z) > evictRadius) {
+            it = budgetEvicted.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    // 3. Batas memori: buang chunk terjauh sampai batas bawah, kecuali chunk
+    // player dan tetangganya
+    size_t lowWater = (size_t)(memoryBudget() * WORLD_BUDGET_LOW_WATER);
+    size_t committed = committedMemory();
+    std::vector<std::pair<float, long long> > byDistance;
+    for (const auto& entry : residentChunks) {
+        float dist = chunkDistance(entry.second->chunkX, entry.second->chunkZ, x, z);
+        if (dist > WORLD_CHUNK_SIZE) {
+            byDistance.push_back(std::make_pair(dist, entry.first));
+        }
+    }
+    std::sort(byDistance.rbegin(), byDistance.rend());
+    size_t nextVictim = 0;
+    // Buang chunk terjauh berikutnya jika jaraknya lebih dari minDistance
+    auto evictFarthest = [&](float minDistance) {
+        if (nextVictim >= byDistance.size() || byDistance[nextVictim].first <= minDistance) {
+            return false;
+        }
+        auto it = residentChunks.find(byDistance[nextVictim].second);
+        committed -= bakedMemory(*it->second);
+        budgetEvicted[it->first] = byDistance[nextVictim].first;
+        evictChunk(it);
+        nextVictim++;
+        return true;
+    };
+    if (committed > memoryBudget()) {
+        while (committed > lowWater && evictFarthest(-1.0f)) {}
+    }
+
+    // 4. Minta chunk baru (terdekat dulu) selama masih di bawah batas bawah.
+    // Jika batas penuh, chunk yang jauh lebih jauh (WORLD_BUDGET_SWAP_MARGIN)
+    // dari chunk yang diminta dibuang untuk memberi tempat.
+    std::vector<long long> wanted;
+    collectWantedChunks(x, z, loadRadius, wanted);
+    std::vector<long long> requests;
+    for (size_t i = 0; i < wanted.size(); i++) {
+        long long key = wanted[i];
+        auto it = residentChunks.find(key);
+        if (it != residentChunks.end()) {
+            it->second->lastUsedFrame = worldFrame;
+            continue;
+        }
+        if (pendingChunks.count(key)) {
+            continue;
+        }
+        float dist = chunkDistance(keyChunkX(key), keyChunkZ(key), x, z);
+        auto dropped = budgetEvicted.find(key);
+        if (dropped != budgetEvicted.end() && dist >= dropped->second) {
+            continue;
+        }
+        while (committed + expectedChunkBytes() > lowWater && evictFarthest(dist + WORLD_BUDGET_SWAP_MARGIN)) {}
+        if (committed + expectedChunkBytes() > lowWater) {
+            continue;
+        }
+        budgetEvicted.erase(key);
+        pendingChunks.insert(key);
+        requests.push_back(key);
+        committed += expectedChunkBytes();
+    }
+    if (!requests.empty()) {
+        std::lock_guard<std::mutex> lock(worldMutex);
+        requestQueue.insert(requestQueue.end(), requests.begin(), requests.end());
+        worldCondition.notify_one();
+    }
+
+    // 5. Bake mesh chunk terdekat yang belum punya display list
+    int baked = 0;
+    for (size_t i = 0; i < wanted.size() && baked < WORLD_BAKES_PER_FRAME; i++) {
+        auto it = residentChunks.find(wanted[i]);
+        if (it != residentChunks.end() && it->second->displayList == 0) {
+            bakeChunk(*it->second);
+            baked++;
+        }
+    }
+
+    worldStats.residentChunks = (int)residentChunks.size();
+    worldStats.pendingChunks = (int)pendingChunks.size();
+}
+
+void drawWorldChunks() {
+    worldStats.visibleChunks = 0;
+    for (const auto& entry : residentChunks) {
+        const WorldChunk& chunk = *entry.second;
+        if (chunk.displayList == 0) continue;
+        float minX = chunk.chunkX * WORLD_CHUNK_SIZE - WORLD_CHUNK_OVERHANG;
+        float minZ = chunk.chunkZ * WORLD_CHUNK_SIZE - WORLD_CHUNK_OVERHANG;
+        float maxX = minX + WORLD_CHUNK_SIZE + 2.0f * WORLD_CHUNK_OVERHANG;
+        float maxZ = minZ + WORLD_CHUNK_SIZE + 2.0f * WORLD_CHUNK_OVERHANG;
+        if (!frustumBoxVisible(minX, -1.0f, minZ, maxX, WORLD_CHUNK_MAX_HEIGHT, maxZ)) continue;
+        glsCallList(chunk.displayList);
+        worldStats.visibleChunks++;
+    }
+}
+
+// Display list chunk yang dikirim ke render queue frame ini
+static std::vector<GLuint> submittedLists;
+
+static void drawChunkItem(int index) {
+    glsCallList(submittedLists[index]);
+}
+
+void submitWorldChunks() {
+    worldStats.visibleChunks = 0;
+    submittedLists.clear();
+    for (const auto& entry : residentChunks) {
+        const WorldChunk& chunk = *entry.second;
+        if (chunk.displayList == 0) continue;
+        float minX = chunk.chunkX * WORLD_CHUNK_SIZE - WORLD_CHUNK_OVERHANG;
+        float minZ = chunk.chunkZ * WORLD_CHUNK_SIZE - WORLD_CHUNK_OVERHANG;
+        float maxX = minX + WORLD_CHUNK_SIZE + 2.0f * WORLD_CHUNK_OVERHANG;
+        float maxZ = minZ + WORLD_CHUNK_SIZE + 2.0f * WORLD_CHUNK_OVERHANG;
+        if (!frustumBoxVisible(minX, -1.0f, minZ, maxX, WORLD_CHUNK_MAX_HEIGHT, maxZ)) continue;
+
+        // Kedalaman dari titik chunk terdekat ke kamera: chunk tempat kamera
+        // berada selalu digambar pertama
+        float dx = std::max(std::max(minX - cameraX, cameraX - maxX), 0.0f);
+        float dz = std::max(std::max(minZ - cameraZ, cameraZ - maxZ), 0.0f);
+        uint64_t key = makeRenderKey(RENDER_PASS_OPAQUE, RENDER_LIGHTING | RENDER_SHADOWED, atlasTexture,
+                                     dx * dx + dz * dz);
+        submitRenderItem(key, drawChunkItem, (int)submittedLists.size());
+        submittedLists.push_back(chunk.displayList);
+        worldStats.visibleChunks++;
+    }
+}
+
+void forEachWorldSceneryNear(float x, float z, float radius,
+                             const std::function<void(const SceneryObject&)>& fn) {
+    float radiusSq = radius * radius;
+    for (const auto& entry : residentChunks) {
+        const WorldChunk& chunk = *entry.second;
+        if (chunk.displayList == 0) continue;
+        float minX = chunk.chunkX * WORLD_CHUNK_SIZE - WORLD_CHUNK_OVERHANG;
+        float minZ = chunk.chunkZ * WORLD_CHUNK_SIZE - WORLD_CHUNK_OVERHANG;
+        float maxX = minX + WORLD_CHUNK_SIZE + 2.0f * WORLD_CHUNK_OVERHANG;
+        float maxZ = minZ + WORLD_CHUNK_SIZE + 2.0f * WORLD_CHUNK_OVERHANG;
+        float nearX = std::max(minX, std::min(x, maxX)) - x;
+        float nearZ = std::max(minZ, std::min(z, maxZ)) - z;
+        if (nearX * nearX + nearZ * nearZ > radiusSq) continue;
+        if (!frustumBoxVisible(minX, -1.0f, minZ, maxX, WORLD_CHUNK_MAX_HEIGHT, maxZ)) continue;
+        for (const auto& obj : chunk.scenery) {
+            float dx = obj.position.x - x, dz = obj.position.z - z;
+            if (dx * dx + dz * dz <= radiusSq) fn(obj);
+        }
+    }
+}
+
+bool worldCheckCollision(float minX, float minZ, float maxX, float maxZ, float entityY) {
+    float centerX = (minX + maxX) * 0.5f, centerZ = (minZ + maxZ) * 0.5f;
+    float halfX = (maxX - minX) * 0.5f, halfZ = (maxZ - minZ) * 0.5f;
+    float reach = std::sqrt(halfX * halfX + halfZ * halfZ) + WORLD_MAX_COLLIDER_RADIUS;
+
+    // Collider milik chunk tempat pusatnya berada, jadi chunk di sekitar
+    // kotak (diperbesar sebesar collider terbesar) ikut dicek
+    int chunkX0 = chunkCoord(minX - WORLD_MAX_COLLIDER_RADIUS);
+    int chunkX1 = chunkCoord(maxX + WORLD_MAX_COLLIDER_RADIUS);
+    int chunkZ0 = chunkCoord(minZ - WORLD_MAX_COLLIDER_RADIUS);
+    int chunkZ1 = chunkCoord(maxZ + WORLD_MAX_COLLIDER_RADIUS);
+
+    for (int cz = chunkZ0; cz <= chunkZ1; cz++) {
+        for (int cx = chunkX0; cx <= chunkX1; cx++) {
+            auto it = residentChunks.find(chunkKey(cx, cz));
+            if (it == residentChunks.end()) continue;
+            const WorldChunk& chunk = *it->second;
+
+            bool hit = false;
+            chunk.colliderHash.forEachNear(centerX, centerZ, reach, [&](int id, float, float, float) {
+                const WorldCollider& c = chunk.colliders[id];
+                if (hit || entityY >= c.height) return;
+                // Titik terdekat di kotak ke pusat lingkaran
+                float nearX = std::max(minX, std::min(c.x, maxX));
+                float nearZ = std::max(minZ, std::min(c.z, maxZ));
+                float dx = c.x - nearX, dz = c.z - nearZ;
+                if (dx * dx + dz * dz < c.radius * c.radius) {
+                    hit = true;
+                }
+            });
+            if (hit) return true;
+        }
+    }
+    return false;
+}
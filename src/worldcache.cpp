@@ -0,0 +1,358 @@
+/*
+ * ==========================================================================
+ * WORLD CACHE
+ * ==========================================================================
+ *
+ * File: worldcache.cpp
+ * Author: Project Team
+ * Date: June 2025
+ *
+ * DESCRIPTION:
+ * -----------
+ * Menyimpan hasil generate dunia ke disk agar start berikutnya dengan seed
+ * dan level yang sama tidak menjalankan generator sama sekali:
+ * - gedung jauh dan scenery authored (initScenery)
+ * - isi chunk awal: objek scenery dan collider (generateSceneryChunk)
+ * - sel blocked grid navigasi (initNavigation)
+ *
+ * Kunci cache = master seed + hash FNV-1a dari data level (walls, rooftops,
+ * staircases, fences, doorways, scenery authored), parameter generator
+ * (--scenery-density, --chunk-radius, ukuran chunk) dan ukuran struct.
+ * Kunci atau versi yang berbeda membuat cache diabaikan lalu ditulis ulang
+ * setelah startup selesai. Hash collider chunk dan display list dibangun
+ * ulang dari data cache (murah dan tidak bisa disimpan).
+ *
+ * FORMAT (lihat worldcache.h):
+ * ---------------------------
+ * WorldCacheHeader | WorldCacheSection x sectionCount | data section...
+ * Sama dengan file level: data section di offset kelipatan 16, file
+ * di-mmap dan record disalin langsung dari mapping.
+ *
+ * FUNCTIONS:
+ * ---------
+ * openWorldCache()       - Validasi dan mmap cache, isi gedung/scenery
+ * getCachedChunk()       - Isi chunk dari cache
+ * getCachedNavCells()    - Sel navigasi dari cache
+ * addChunkToWorldCache() - Kumpulkan chunk baru (cache miss)
+ * closeWorldCache()      - Tulis cache baru (miss) atau lepas mapping (hit)
+ *
+ * DEPENDENCIES:
+ * -----------
+ * - worldcache.h  - Struct format file
+ * - mappedfile.h  - mapFile()/unmapFile()
+ * - map.h, collision.h, level.h - Data level untuk kunci cache
+ * - navigation.h  - navGrid
+ * - random.h, options.h - Seed dan parameter generator
+ *
+ * ==========================================================================
+ */
+
+#include "worldcache.h"
+#include "mappedfile.h"
+#include "map.h"
+#include "collision.h"
+#include "level.h"
+#include "navigation.h"
+#include "random.h"
+#include "options.h"
+#include <chrono>
+#include <cstring>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+static_assert(sizeof(WorldCacheHeader) == 32, "WorldCacheHeader layout");
+static_assert(sizeof(WorldCacheSection) == 16, "WorldCacheSection layout");
+static_assert(sizeof(WorldCacheChunk) == 24, "WorldCacheChunk layout");
+
+static MappedFile cacheFile = {nullptr, 0, nullptr, nullptr, -1};
+static bool cacheHit = false;
+static bool cacheCollecting = false;    // Miss: chunk baru dikumpulkan untuk ditulis
+
+// Section yang dipakai saat hit (menunjuk ke dalam mapping)
+static const WorldCacheChunk* cachedChunks = nullptr;
+static const SceneryObject* cachedChunkScenery = nullptr;
+static const WorldCollider* cachedChunkColliders = nullptr;
+static const unsigned char* cachedNavCells = nullptr;
+static uint32_t cachedNavCount = 0;
+static std::unordered_map<long long, uint32_t> cachedChunkIndex;
+
+// Chunk yang dibangkitkan saat miss (dilindungi collectMutex)
+static std::mutex collectMutex;
+static std::vector<WorldCacheChunk> collectedChunks;
+static std::vector<SceneryObject> collectedScenery;
+static std::vector<WorldCollider> collectedColliders;
+
+static long long cacheChunkKey(int chunkX, int chunkZ) {
+    return (long long)(((unsigned long long)(unsigned int)chunkX << 32) | (unsigned int)chunkZ);
+}
+
+static void hashBytes(uint64_t& hash, const void* data, size_t size) {
+    const unsigned char* bytes = (const unsigned char*)data;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+}
+
+template <typename T>
+static void hashValue(uint64_t& hash, const T& value) {
+    hashBytes(hash, &value, sizeof(T));
+}
+
+// Record level tanpa padding (lihat static_assert di level.cpp)
+template <typename T>
+static void hashRecords(uint64_t& hash, const std::vector<T>& records) {
+    hashValue(hash, (uint64_t)records.size());
+    if (!records.empty()) {
+        hashBytes(hash, records.data(), records.size() * sizeof(T));
+    }
+}
+
+static uint64_t computeContentHash() {
+    uint64_t hash = 14695981039346656037ULL;
+    hashValue(hash, WORLD_CACHE_VERSION);
+    hashValue(hash, (uint32_t)sizeof(SceneryObject));
+    hashValue(hash, (uint32_t)sizeof(Building));
+    hashValue(hash, (uint32_t)sizeof(WorldCollider));
+
+    hashRecords(hash, walls);
+    hashRecords(hash, rooftops);
+    hashRecords(hash, staircases);
+    hashRecords(hash, fences);
+    hashRecords(hash, doorways);
+
+    // SceneryObject punya padding dan warna yang tidak diisi: hash per field
+    std::vector<SceneryObject> authored;
+    hashValue(hash, (uint32_t)getLevelScenery(authored));
+    for (const auto& obj : authored) {
+        hashValue(hash, obj.position);
+        hashValue(hash, obj.rotationY);
+        hashValue(hash, obj.scale);
+        hashValue(hash, (int32_t)obj.type);
+        hashValue(hash, (uint32_t)obj.castShadow);
+    }
+
+    hashValue(hash, gameOptions.sceneryDensity);
+    hashValue(hash, gameOptions.chunkRadius);
+    hashValue(hash, WORLD_CHUNK_SIZE);
+    return hash;
+}
+
+template <typename T>
+static void copySection(const WorldCacheSection* section, std::vector<T>& out) {
+    const T* records = (const T*)(cacheFile.data + section->offset);
+    out.assign(records, records + section->count);
+}
+
+// Tolak cache dan siapkan pengumpulan chunk untuk ditulis ulang
+static bool cacheMiss(const char* path, const char* reason) {
+    std::cout << "World cache " << path << " not used: " << reason << std::endl;
+    unmapFile(cacheFile);
+    cacheHit = false;
+    cacheCollecting = true;
+    return false;
+}
+
+bool openWorldCache(const char* path) {
+    auto start = std::chrono::steady_clock::now();
+    cacheHit = false;
+    cacheCollecting = false;
+    cachedChunkIndex.clear();
+
+    if (!mapFile(path, cacheFile)) {
+        return cacheMiss(path, "no cache file");
+    }
+
+    const WorldCacheHeader* header = (const WorldCacheHeader*)cacheFile.data;
+    if (cacheFile.size < sizeof(WorldCacheHeader) || std::memcmp(header->magic, WORLD_CACHE_MAGIC, 4) != 0
+        || header->fileSize != cacheFile.size) {
+        return cacheMiss(path, "not a world cache or truncated");
+    }
+    if (header->version != WORLD_CACHE_VERSION) {
+        return cacheMiss(path, "version changed");
+    }
+    if (header->seed != getMasterSeed() || header->contentHash != computeContentHash()) {
+        return cacheMiss(path, "seed, level or generator parameters changed");
+    }
+
+    size_t tableEnd = sizeof(WorldCacheHeader) + (size_t)header->sectionCount * sizeof(WorldCacheSection);
+    if (tableEnd > cacheFile.size) {
+        return cacheMiss(path, "corrupt section table");
+    }
+    const WorldCacheSection* table = (const WorldCacheSection*)(cacheFile.data + sizeof(WorldCacheHeader));
+    const WorldCacheSection* sections[WORLD_CACHE_NAV_CELLS + 1] = {nullptr};
+    static const uint32_t strides[WORLD_CACHE_NAV_CELLS + 1] = {
+        0, sizeof(Building), sizeof(SceneryObject), sizeof(WorldCacheChunk),
+        sizeof(SceneryObject), sizeof(WorldCollider), 1
+    };
+    for (uint32_t i = 0; i < header->sectionCount; i++) {
+        const WorldCacheSection& entry = table[i];
+        size_t end = (size_t)entry.offset + (size_t)entry.count * entry.stride;
+        if (entry.type < WORLD_CACHE_BUILDINGS || entry.type > WORLD_CACHE_NAV_CELLS
+            || entry.stride != strides[entry.type] || entry.offset < tableEnd || end > cacheFile.size) {
+            return cacheMiss(path, "corrupt section");
+        }
+        sections[entry.type] = &entry;
+    }
+    for (int type = WORLD_CACHE_BUILDINGS; type <= WORLD_CACHE_NAV_CELLS; type++) {
+        if (sections[type] == nullptr) {
+            return cacheMiss(path, "missing section");
+        }
+    }
+
+    // Range chunk harus berada di dalam section scenery/collider
+    cachedChunks = (const WorldCacheChunk*)(cacheFile.data + sections[WORLD_CACHE_CHUNKS]->offset);
+    for (uint32_t i = 0; i < sections[WORLD_CACHE_CHUNKS]->count; i++) {
+        const WorldCacheChunk& chunk = cachedChunks[i];
+        if ((uint64_t)chunk.firstScenery + chunk.sceneryCount > sections[WORLD_CACHE_CHUNK_SCENERY]->count
+            || (uint64_t)chunk.firstCollider + chunk.colliderCount > sections[WORLD_CACHE_CHUNK_COLLIDERS]->count) {
+            cachedChunkIndex.clear();
+            return cacheMiss(path, "corrupt chunk table");
+        }
+        cachedChunkIndex[cacheChunkKey(chunk.chunkX, chunk.chunkZ)] = i;
+    }
+    cachedChunkScenery = (const SceneryObject*)(cacheFile.data + sections[WORLD_CACHE_CHUNK_SCENERY]->offset);
+    cachedChunkColliders = (const WorldCollider*)(cacheFile.data + sections[WORLD_CACHE_CHUNK_COLLIDERS]->offset);
+    cachedNavCells = cacheFile.data + sections[WORLD_CACHE_NAV_CELLS]->offset;
+    cachedNavCount = sections[WORLD_CACHE_NAV_CELLS]->count;
+
+    copySection(sections[WORLD_CACHE_BUILDINGS], buildings);
+    copySection(sections[WORLD_CACHE_SCENERY], sceneryObjects);
+    cacheHit = true;
+
+    float ms = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "World cache " << path << ": " << cachedChunkIndex.size() << " chunks, "
+              << buildings.size() << " buildings (" << ms << " ms)" << std::endl;
+    return true;
+}
+
+bool worldCacheHit() {
+    return cacheHit;
+}
+
+bool getCachedChunk(int chunkX, int chunkZ, std::vector<SceneryObject>& scenery,
+                    std::vector<WorldCollider>& colliders) {
+    if (!cacheHit) return false;
+    auto found = cachedChunkIndex.find(cacheChunkKey(chunkX, chunkZ));
+    if (found == cachedChunkIndex.end()) return false;
+    const WorldCacheChunk& chunk = cachedChunks[found->second];
+    scenery.assign(cachedChunkScenery + chunk.firstScenery,
+                   cachedChunkScenery + chunk.firstScenery + chunk.sceneryCount);
+    colliders.assign(cachedChunkColliders + chunk.firstCollider,
+                     cachedChunkColliders + chunk.firstCollider + chunk.colliderCount);
+    return true;
+}
+
+const unsigned char* getCachedNavCells(size_t& count) {
+    if (!cacheHit) return nullptr;
+    count = cachedNavCount;
+    return cachedNavCells;
+}
+
+void addChunkToWorldCache(const WorldChunk& chunk) {
+    if (!cacheCollecting) return;
+    std::lock_guard<std::mutex> lock(collectMutex);
+    WorldCacheChunk entry;
+    entry.chunkX = chunk.chunkX;
+    entry.chunkZ = chunk.chunkZ;
+    entry.firstScenery = (uint32_t)collectedScenery.size();
+    entry.sceneryCount = (uint32_t)chunk.scenery.size();
+    entry.firstCollider = (uint32_t)collectedColliders.size();
+    entry.colliderCount = (uint32_t)chunk.colliders.size();
+    collectedChunks.push_back(entry);
+    collectedScenery.insert(collectedScenery.end(), chunk.scenery.begin(), chunk.scenery.end());
+    collectedColliders.insert(collectedColliders.end(), chunk.colliders.begin(), chunk.colliders.end());
+}
+
+static bool writeWorldCache(const char* path) {
+    struct PendingSection {
+        uint32_t type, stride, count;
+        const void* data;
+    };
+    const PendingSection pending[] = {
+        {WORLD_CACHE_BUILDINGS, sizeof(Building), (uint32_t)buildings.size(), buildings.data()},
+        {WORLD_CACHE_SCENERY, sizeof(SceneryObject), (uint32_t)sceneryObjects.size(), sceneryObjects.data()},
+        {WORLD_CACHE_CHUNKS, sizeof(WorldCacheChunk), (uint32_t)collectedChunks.size(), collectedChunks.data()},
+        {WORLD_CACHE_CHUNK_SCENERY, sizeof(SceneryObject), (uint32_t)collectedScenery.size(), collectedScenery.data()},
+        {WORLD_CACHE_CHUNK_COLLIDERS, sizeof(WorldCollider), (uint32_t)collectedColliders.size(), collectedColliders.data()},
+        {WORLD_CACHE_NAV_CELLS, 1, (uint32_t)navGrid.blocked.size(), navGrid.blocked.data()}
+    };
+    const uint32_t sectionCount = sizeof(pending) / sizeof(pending[0]);
+
+    std::vector<WorldCacheSection> table(sectionCount);
+    uint32_t offset = sizeof(WorldCacheHeader) + sectionCount * sizeof(WorldCacheSection);
+    for (uint32_t i = 0; i < sectionCount; i++) {
+        offset = (offset + WORLD_CACHE_SECTION_ALIGN - 1) / WORLD_CACHE_SECTION_ALIGN * WORLD_CACHE_SECTION_ALIGN;
+        table[i].type = pending[i].type;
+        table[i].offset = offset;
+        table[i].count = pending[i].count;
+        table[i].stride = pending[i].stride;
+        offset += pending[i].count * pending[i].stride;
+    }
+
+    std::vector<unsigned char> file(offset, 0);
+    WorldCacheHeader header;
+    std::memcpy(header.magic, WORLD_CACHE_MAGIC, 4);
+    header.version = WORLD_CACHE_VERSION;
+    header.fileSize = offset;
+    header.sectionCount = sectionCount;
+    header.seed = getMasterSeed();
+    header.contentHash = computeContentHash();
+    std::memcpy(file.data(), &header, sizeof(header));
+    std::memcpy(file.data() + sizeof(header), table.data(), sectionCount * sizeof(WorldCacheSection));
+    for (uint32_t i = 0; i < sectionCount; i++) {
+        if (pending[i].count > 0) {
+            std::memcpy(file.data() + table[i].offset, pending[i].data, pending[i].count * pending[i].stride);
+        }
+    }
+
+    // File sementara lalu rename: start yang terputus tidak meninggalkan
+    // cache setengah jadi
+    std::string tempPath = std::string(path) + ".tmp";
+    {
+        std::ofstream out(tempPath.c_str(), std::ios::binary);
+        if (!out || !out.write((const char*)file.data(), file.size())) {
+            std::cerr << "World cache: cannot write " << tempPath << std::endl;
+            return false;
+        }
+    }
+#ifdef _WIN32
+    bool renamed = MoveFileExA(tempPath.c_str(), path, MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+    bool renamed = std::rename(tempPath.c_str(), path) == 0;
+#endif
+    if (!renamed) {
+        std::cerr << "World cache: cannot replace " << path << std::endl;
+        std::remove(tempPath.c_str());
+        return false;
+    }
+    std::cout << "World cache " << path << " written (" << collectedChunks.size() << " chunks, "
+              << file.size() / 1024 << " KB)" << std::endl;
+    return true;
+}
+
+void closeWorldCache(const char* path) {
+    if (cacheCollecting) {
+        writeWorldCache(path);
+        std::lock_guard<std::mutex> lock(collectMutex);
+        collectedChunks.clear();
+        collectedScenery.clear();
+        collectedColliders.clear();
+        cacheCollecting = false;
+    }
+    cachedChunkIndex.clear();
+    cachedChunks = nullptr;
+    cachedChunkScenery = nullptr;
+    cachedChunkColliders = nullptr;
+    cachedNavCells = nullptr;
+    unmapFile(cacheFile);
+    cacheHit = false;
+}